@@ -7,6 +7,15 @@
 #include <xAODAnaHelpers/HelperFunctions.h>
 #include "xAODEventInfo/EventInfo.h"
 
+// EL include(s):
+#include <EventLoop/Worker.h>
+
+// ROOT include(s):
+#include "TFile.h"
+#include "TH1F.h"
+#include "TTree.h"
+#include "TSystem.h"
+
 std::map<std::string, int> xAH::Algorithm::m_instanceRegistry = {};
 
 // this is needed to distribute the algorithm to the workers
@@ -33,14 +42,137 @@ StatusCode xAH::Algorithm::algInitialize(){
     // deprecating m_verbose, but this is around for backwards compatibility
     m_verbose = msgLvl(MSG::VERBOSE);
 
+    if(m_doProfiling) ANA_CHECK( initializeProfiling() );
+
     return StatusCode::SUCCESS;
 }
 
 StatusCode xAH::Algorithm::algFinalize(){
+    if(m_doProfiling) ANA_CHECK( finalizeProfiling() );
     unregisterInstance();
     return StatusCode::SUCCESS;
 }
 
+StatusCode xAH::Algorithm::initializeProfiling(){
+    TFile* file(nullptr);
+    try {
+      file = wk()->getOutputFile(m_profilingStreamName);
+    } catch (const std::exception&) {
+      ANA_MSG_ERROR("Profiling is enabled but the output stream '" << m_profilingStreamName << "' does not exist. Add an EL::OutputStream with this name to the job.");
+      return StatusCode::FAILURE;
+    }
+
+    // one directory per instance, names are unique within a job
+    TDirectory* dir = file->GetDirectory(m_name.c_str());
+    if(!dir) dir = file->mkdir(m_name.c_str());
+
+    TDirectory* prevDir = gDirectory;
+    dir->cd();
+    m_profileWallTime  = new TH1F("wallTime",  (m_className+"::execute() wall time").c_str(), 500, 0., 100.);
+    m_profileWallTime->GetXaxis()->SetTitle("wall time [ms]");
+    m_profileCPUTime   = new TH1F("cpuTime",   (m_className+"::execute() CPU time").c_str(),  500, 0., 100.);
+    m_profileCPUTime->GetXaxis()->SetTitle("CPU time [ms]");
+    m_profileRSSGrowth = new TH1F("rssGrowth", (m_className+"::execute() RSS growth").c_str(), 200, -10., 10.);
+    m_profileRSSGrowth->GetXaxis()->SetTitle("#Delta RSS [MB]");
+    prevDir->cd();
+
+    m_profileNCalls         = 0;
+    m_profileTotalWallTime  = 0.0;
+    m_profileTotalCPUTime   = 0.0;
+    m_profileMaxWallTime    = 0.0;
+    m_profileRSSTotalGrowth = 0;
+
+    ANA_MSG_INFO("Profiling execute() of " << m_className << "::" << m_name << " into stream " << m_profilingStreamName);
+    return StatusCode::SUCCESS;
+}
+
+StatusCode xAH::Algorithm::finalizeProfiling(){
+    if(!m_profileWallTime) return StatusCode::SUCCESS;
+
+    double meanWallTime = m_profileNCalls ? m_profileTotalWallTime/m_profileNCalls : 0.0;
+    double meanCPUTime  = m_profileNCalls ? m_profileTotalCPUTime/m_profileNCalls  : 0.0;
+    double rssGrowth    = m_profileRSSTotalGrowth/1024.;
+
+    ANA_MSG_INFO("Profile of " << m_className << "::" << m_name << ": " << m_profileNCalls << " calls, "
+                 << "wall " << m_profileTotalWallTime/1e3 << " s (" << meanWallTime << " ms/call, max " << m_profileMaxWallTime << " ms), "
+                 << "CPU " << m_profileTotalCPUTime/1e3 << " s (" << meanCPUTime << " ms/call), "
+                 << "RSS growth " << rssGrowth << " MB");
+
+    std::string name      = m_name;
+    std::string className = m_className;
+    std::string* namePtr      = &name;
+    std::string* classNamePtr = &className;
+    ULong64_t nCalls = m_profileNCalls;
+
+    // all instances share one summary tree in the profiling stream
+    TFile* file = wk()->getOutputFile(m_profilingStreamName);
+    TTree* summary = dynamic_cast<TTree*>(file->Get("summary"));
+    if(!summary){
+      TDirectory* prevDir = gDirectory;
+      file->cd();
+      summary = new TTree("summary", "xAH::Algorithm execute() profiling summary");
+      summary->SetDirectory(file);
+      summary->Branch("name",         &namePtr);
+      summary->Branch("className",    &classNamePtr);
+      summary->Branch("nCalls",       &nCalls,                 "nCalls/l");
+      summary->Branch("wallTime",     &m_profileTotalWallTime, "wallTime/D");
+      summary->Branch("cpuTime",      &m_profileTotalCPUTime,  "cpuTime/D");
+      summary->Branch("meanWallTime", &meanWallTime,           "meanWallTime/D");
+      summary->Branch("meanCPUTime",  &meanCPUTime,            "meanCPUTime/D");
+      summary->Branch("maxWallTime",  &m_profileMaxWallTime,   "maxWallTime/D");
+      summary->Branch("rssGrowth",    &rssGrowth,              "rssGrowth/D");
+      prevDir->cd();
+    } else {
+      summary->SetBranchAddress("name",         &namePtr);
+      summary->SetBranchAddress("className",    &classNamePtr);
+      summary->SetBranchAddress("nCalls",       &nCalls);
+      summary->SetBranchAddress("wallTime",     &m_profileTotalWallTime);
+      summary->SetBranchAddress("cpuTime",      &m_profileTotalCPUTime);
+      summary->SetBranchAddress("meanWallTime", &meanWallTime);
+      summary->SetBranchAddress("meanCPUTime",  &meanCPUTime);
+      summary->SetBranchAddress("maxWallTime",  &m_profileMaxWallTime);
+      summary->SetBranchAddress("rssGrowth",    &rssGrowth);
+    }
+    summary->Fill();
+    // addresses point into this instance, do not let the next one inherit them
+    summary->ResetBranchAddresses();
+
+    m_profileWallTime  = nullptr;
+    m_profileCPUTime   = nullptr;
+    m_profileRSSGrowth = nullptr;
+
+    return StatusCode::SUCCESS;
+}
+
+void xAH::Algorithm::profileStart(){
+    ProcInfo_t info;
+    gSystem->GetProcInfo(&info);
+    m_profileRSSStart = info.fMemResident;
+    m_profileWatch.Start(kTRUE);
+}
+
+void xAH::Algorithm::profileStop(){
+    m_profileWatch.Stop();
+    // TStopwatch reports seconds, we book in ms
+    double wallTime = m_profileWatch.RealTime()*1e3;
+    double cpuTime  = m_profileWatch.CpuTime()*1e3;
+
+    ProcInfo_t info;
+    gSystem->GetProcInfo(&info);
+    long rssGrowth = info.fMemResident - m_profileRSSStart;
+
+    m_profileNCalls++;
+    m_profileTotalWallTime  += wallTime;
+    m_profileTotalCPUTime   += cpuTime;
+    m_profileRSSTotalGrowth += rssGrowth;
+    if(wallTime > m_profileMaxWallTime) m_profileMaxWallTime = wallTime;
+
+    if(!m_profileWallTime) return;
+    m_profileWallTime->Fill(wallTime);
+    m_profileCPUTime->Fill(cpuTime);
+    m_profileRSSGrowth->Fill(rssGrowth/1024.);
+}
+
 StatusCode xAH::Algorithm::parseSystValVector(){
 
     std::stringstream ss(m_systValVectorString);
@@ -0,0 +1,91 @@
+#include <xAODAnaHelpers/AsyncTreeWriter.h>
+
+#include <TTree.h>
+
+using namespace xAH;
+
+AsyncTreeWriter::AsyncTreeWriter(std::size_t maxQueued) :
+  m_maxQueued(maxQueued > 0 ? maxQueued : 1),
+  m_worker(&AsyncTreeWriter::workerLoop, this)
+{
+}
+
+AsyncTreeWriter::~AsyncTreeWriter()
+{
+  drain();
+  {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_stop = true;
+  }
+  m_wake.notify_all();
+  m_worker.join();
+}
+
+std::shared_ptr<AsyncTreeWriter> AsyncTreeWriter::shared(std::size_t maxQueued)
+{
+  static std::mutex mutex;
+  static std::weak_ptr<AsyncTreeWriter> instance;
+
+  std::lock_guard<std::mutex> lock(mutex);
+  std::shared_ptr<AsyncTreeWriter> writer = instance.lock();
+  if(!writer){
+    writer = std::make_shared<AsyncTreeWriter>(maxQueued);
+    instance = writer;
+  }
+  return writer;
+}
+
+void AsyncTreeWriter::fill(TTree* tree)
+{
+  {
+    std::unique_lock<std::mutex> lock(m_mutex);
+    m_done.wait(lock, [this]{ return m_queue.size() < m_maxQueued; });
+    m_queue.push_back(tree);
+    ++m_pending[tree];
+  }
+  m_wake.notify_one();
+}
+
+void AsyncTreeWriter::wait(const TTree* tree)
+{
+  std::unique_lock<std::mutex> lock(m_mutex);
+  m_done.wait(lock, [this, tree]{ return m_pending.find(tree) == m_pending.end(); });
+}
+
+void AsyncTreeWriter::drain()
+{
+  std::unique_lock<std::mutex> lock(m_mutex);
+  m_done.wait(lock, [this]{ return m_pending.empty(); });
+}
+
+unsigned long AsyncTreeWriter::nFailed() const
+{
+  std::lock_guard<std::mutex> lock(m_mutex);
+  return m_nFailed;
+}
+
+void AsyncTreeWriter::workerLoop()
+{
+  while(true){
+    TTree* tree(nullptr);
+    {
+      std::unique_lock<std::mutex> lock(m_mutex);
+      m_wake.wait(lock, [this]{ return m_stop || !m_queue.empty(); });
+      if(m_queue.empty()) return;
+      tree = m_queue.front();
+      m_queue.pop_front();
+    }
+    // the slot is free as soon as the tree is off the queue
+    m_done.notify_all();
+
+    const bool failed = tree->Fill() < 0;
+
+    {
+      std::lock_guard<std::mutex> lock(m_mutex);
+      if(failed) ++m_nFailed;
+      auto pending = m_pending.find(tree);
+      if(--pending->second == 0) m_pending.erase(pending);
+    }
+    m_done.notify_all();
+  }
+}
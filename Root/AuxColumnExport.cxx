@@ -0,0 +1,85 @@
+#include <xAODAnaHelpers/AuxColumnExport.h>
+
+#include <algorithm>
+
+using namespace xAH;
+
+AuxColumnExport::~AuxColumnExport()
+{
+  for(Column& column : m_columns){
+    delete column.floats;
+    delete column.ints;
+  }
+}
+
+void AuxColumnExport::add(const std::string& auxName, const std::string& branchName, Type type, float units)
+{
+  Column column;
+  column.branchName = branchName;
+  column.type       = type;
+  column.units      = units;
+  if(type == FLOAT) {
+    column.auxid  = SG::AuxTypeRegistry::instance().getAuxID<float>(auxName);
+    column.floats = new std::vector<float>();
+  } else {
+    column.auxid  = SG::AuxTypeRegistry::instance().getAuxID<int>(auxName);
+    column.ints   = new std::vector<int>();
+  }
+  m_columns.push_back(column);
+}
+
+void AuxColumnExport::setBranches(TTree* tree)
+{
+  for(Column& column : m_columns){
+    if(column.type == FLOAT) tree->Branch(column.branchName.c_str(), column.floats);
+    else                     tree->Branch(column.branchName.c_str(), column.ints);
+  }
+}
+
+void AuxColumnExport::clear()
+{
+  for(Column& column : m_columns){
+    if(column.type == FLOAT) column.floats->clear();
+    else                     column.ints->clear();
+  }
+}
+
+void AuxColumnExport::fillRange(const SG::AuxVectorData* store, std::size_t first, std::size_t n)
+{
+  for(Column& column : m_columns){
+    const bool available = store->isAvailable(column.auxid);
+
+    if(column.type == FLOAT) {
+      std::vector<float>& dest = *column.floats;
+      const std::size_t offset = dest.size();
+      dest.resize(offset + n, -999);
+      if(!available) continue;
+
+      const float* src = static_cast<const float*>(store->getDataArray(column.auxid)) + first;
+      float* out = dest.data() + offset;
+      const float units = column.units;
+      for(std::size_t i = 0; i < n; ++i) out[i] = src[i] / units;
+    } else {
+      std::vector<int>& dest = *column.ints;
+      const std::size_t offset = dest.size();
+      dest.resize(offset + n, -999);
+      if(!available) continue;
+
+      const int* src = static_cast<const int*>(store->getDataArray(column.auxid)) + first;
+      std::copy(src, src + n, dest.begin() + offset);
+    }
+  }
+}
+
+void AuxColumnExport::fillElement(const SG::AuxVectorData* store, std::size_t index)
+{
+  for(Column& column : m_columns){
+    const bool available = store && store->isAvailable(column.auxid);
+
+    if(column.type == FLOAT) {
+      column.floats->push_back( available ? static_cast<const float*>(store->getDataArray(column.auxid))[index] / column.units : -999 );
+    } else {
+      column.ints->push_back( available ? static_cast<const int*>(store->getDataArray(column.auxid))[index] : -999 );
+    }
+  }
+}
@@ -0,0 +1,18 @@
+#include <xAODAnaHelpers/AuxColumnTable.h>
+
+using namespace xAH;
+
+void AuxColumnTable::resolve(const SG::AuxVectorData* container)
+{
+  for(Column& column : m_columns){
+    if(container && container->isAvailable(column.auxid)){
+      column.data = container->getDataArray(column.auxid);
+      column.copy = column.copyValue;
+    } else {
+      column.data = nullptr;
+      column.copy = column.copyDefault;
+    }
+  }
+  m_container = container;
+  m_resolved  = true;
+}
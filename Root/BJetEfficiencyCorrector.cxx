@@ -158,6 +158,8 @@ EL::StatusCode BJetEfficiencyCorrector :: initialize ()
     return EL::StatusCode::FAILURE;
   }
 
+  m_inContainerKeys.setPrefix( m_inContainerName );
+
   if ( !m_isMC ) {
     ANA_MSG_WARNING( "Attempting to run BTagging Jet Scale Factors on data.  Turning off scale factors." );
     m_getScaleFactors = false;
@@ -268,6 +270,7 @@ EL::StatusCode BJetEfficiencyCorrector :: initialize ()
 
 EL::StatusCode BJetEfficiencyCorrector :: execute ()
 {
+  xAH::ExecuteProfiler profiler(this);
   ANA_MSG_DEBUG( "Applying BJet Efficency Corrector... ");
 
   //
@@ -286,7 +289,10 @@ EL::StatusCode BJetEfficiencyCorrector :: execute ()
   if (systNames_ptr) systNames = *systNames_ptr;
 
   // loop over systematic sets available
-  for ( auto systName : systNames ) {
+  xAH::SystematicRegistry& systRegistry = xAH::SystematicRegistry::instance();
+  for ( const auto& systName : systNames ) {
+
+    unsigned int systID = systRegistry.id( systName );
 
     bool doNominal = (systName == "");
 
@@ -294,9 +300,9 @@ EL::StatusCode BJetEfficiencyCorrector :: execute ()
     const xAOD::JetContainer* inJets(nullptr);
 
     // some systematics might have rejected the event
-    if ( m_store->contains<xAOD::JetContainer>( m_inContainerName+systName ) ) {
+    if ( m_store->contains<xAOD::JetContainer>( m_inContainerKeys.key(systID) ) ) {
       // Check the existence of the container
-      ANA_CHECK( HelperFunctions::retrieve(inJets, m_inContainerName+systName, m_event, m_store, msg()) );
+      ANA_CHECK( HelperFunctions::retrieve(inJets, m_inContainerKeys.key(systID), m_event, m_store, msg()) );
 
       executeEfficiencyCorrection( inJets, eventInfo, doNominal );
     }
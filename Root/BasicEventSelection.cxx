@@ -29,6 +29,10 @@
 #include "TSystem.h"
 #include "xAODCore/tools/IOStats.h"
 #include "xAODCore/tools/ReadStats.h"
+#include <fstream>
+#include <map>
+#include <set>
+#include <sstream>
 
 
 // this is needed to distribute the algorithm to the workers
@@ -245,11 +249,31 @@ EL::StatusCode BasicEventSelection :: fileExecute ()
 
 }
 
-EL::StatusCode BasicEventSelection :: changeInput (bool /*firstFile*/)
+EL::StatusCode BasicEventSelection :: changeInput (bool firstFile)
 {
   // Here you do everything you need to do when we change input files,
   // e.g. resetting branch addresses on trees.  If you are using
   // D3PDReader or a similar service this method is not needed.
+
+  // the aux item lists have to be known before any container is read, and stay set for all the files
+  if ( firstFile && !m_auxItemList.empty() ) {
+    xAOD::TEvent* event = wk()->xaodEvent();
+    std::istringstream ss(m_auxItemList);
+    std::string token;
+    while ( ss >> token ) {
+      const std::size_t colon = token.find(':');
+      if ( colon == std::string::npos || colon == 0 ) {
+        ANA_MSG_ERROR( "Cannot parse '" << token << "' in m_auxItemList, expected Container:var1.var2...");
+        return EL::StatusCode::FAILURE;
+      }
+      const std::string container = token.substr(0, colon);
+      const std::string items     = token.substr(colon+1);
+      ANA_MSG_DEBUG( "Reading only " << items << " of " << container );
+      event->setAuxItemList( container + "Aux.", items );
+    }
+    ANA_MSG_INFO( "Restricted the aux variables read from the input with m_auxItemList" );
+  }
+
   return EL::StatusCode::SUCCESS;
 }
 
@@ -549,6 +573,7 @@ EL::StatusCode BasicEventSelection :: initialize ()
 
 EL::StatusCode BasicEventSelection :: execute ()
 {
+  xAH::ExecuteProfiler profiler(this);
   // Here you do everything that needs to be done on every single
   // events, e.g. read input variables, apply cuts, and fill
   // histograms and trees.  This is where most of your actual analysis
@@ -831,6 +856,14 @@ EL::StatusCode BasicEventSelection :: execute ()
   m_cutflowHist ->Fill( m_cutflow_npv, 1 );
   m_cutflowHistW->Fill( m_cutflow_npv, mcEvtWeight);
 
+  // share the primary vertex location and NPV with the algorithms downstream, see HelperFunctions::cachePrimaryVertexInfo
+  if ( !m_truthLevelOnly ) {
+    if ( !vertices && m_event->contains<xAOD::VertexContainer>(m_vertexContainerName) ) {
+      ANA_CHECK( HelperFunctions::retrieve(vertices, m_vertexContainerName, m_event, m_store, msg()) );
+    }
+    if ( vertices ) { HelperFunctions::cachePrimaryVertexInfo( eventInfo, vertices, msg() ); }
+  }
+
   //---------------------
   // Trigger decision cut
   //---------------------
@@ -973,6 +1006,10 @@ EL::StatusCode BasicEventSelection :: finalize ()
     xAOD::IOStats::instance().stats().printSmartSlimmingBranchList();
   }
 
+  if ( !m_recordAuxReads.empty() ) {
+    ANA_CHECK( writeAuxReads() );
+  }
+
   return EL::StatusCode::SUCCESS;
 }
 
@@ -993,3 +1030,40 @@ EL::StatusCode BasicEventSelection :: histFinalize ()
   ANA_CHECK( xAH::Algorithm::algFinalize());
   return EL::StatusCode::SUCCESS;
 }
+
+EL::StatusCode BasicEventSelection :: writeAuxReads ()
+{
+  // branch statistics are named like "ElectronsAux.pt" or "ElectronsAuxDyn.pt"
+  std::map< std::string, std::set< std::string > > items;
+  for ( const auto& prefix : xAOD::IOStats::instance().stats().branches() ) {
+    for ( const xAOD::BranchStats* branch : prefix.second ) {
+      if ( !branch || !branch->readEntries() ) continue;
+      const std::string name = branch->GetName();
+      const std::size_t dot = name.rfind('.');
+      if ( dot == std::string::npos ) continue;
+      std::string container = name.substr(0, dot);
+      for ( const std::string suffix : {"Dyn", "Aux"} ) {
+        if ( container.size() > suffix.size() && container.compare(container.size()-suffix.size(), suffix.size(), suffix) == 0 )
+          container.erase(container.size()-suffix.size());
+      }
+      items[container].insert( name.substr(dot+1) );
+    }
+  }
+
+  std::ofstream out( m_recordAuxReads );
+  if ( !out ) {
+    ANA_MSG_ERROR( "Cannot write the aux variables read to " << m_recordAuxReads );
+    return EL::StatusCode::FAILURE;
+  }
+  out << "# aux variables read by the job, for BasicEventSelection::m_auxItemList (xAH_run.py --auxReadList)\n";
+  if ( !m_auxReadsFingerprint.empty() ) out << "# fingerprint " << m_auxReadsFingerprint << "\n";
+  for ( const auto& container : items ) {
+    out << container.first << ":";
+    std::string separator = "";
+    for ( const auto& item : container.second ) { out << separator << item; separator = "."; }
+    out << "\n";
+  }
+  ANA_MSG_INFO( "Wrote the aux variables read of " << items.size() << " containers to " << m_recordAuxReads );
+
+  return EL::StatusCode::SUCCESS;
+}
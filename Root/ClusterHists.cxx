@@ -36,7 +36,7 @@ StatusCode ClusterHists::execute( const xAOD::CaloClusterContainer* ccls, float
     ANA_CHECK( this->execute( (*ccl_itr), eventWeight ));
   }
 
-  m_ccl_n -> Fill( ccls->size(), eventWeight );
+  fill( m_ccl_n,  ccls->size(), eventWeight );
 
   return StatusCode::SUCCESS;
 }
@@ -48,14 +48,14 @@ StatusCode ClusterHists::execute( const xAOD::CaloCluster* ccl, float eventWeigh
   float cclEta = ccl->eta();
   float cclPhi = ccl->phi();
 
-  m_ccl_e          -> Fill( cclE,   eventWeight );
-  m_ccl_eta        -> Fill( cclEta, eventWeight );
-  m_ccl_phi        -> Fill( cclPhi, eventWeight );
+  fill( m_ccl_e,           cclE,   eventWeight );
+  fill( m_ccl_eta,         cclEta, eventWeight );
+  fill( m_ccl_phi,         cclPhi, eventWeight );
 
   // 2D plots
-  m_ccl_eta_vs_phi -> Fill( cclPhi, cclEta,  eventWeight );
-  m_ccl_e_vs_eta   -> Fill( cclEta, cclE,    eventWeight );
-  m_ccl_e_vs_phi   -> Fill( cclPhi, cclE,    eventWeight );
+  fill( m_ccl_eta_vs_phi,  cclPhi, cclEta,  eventWeight );
+  fill( m_ccl_e_vs_eta,    cclEta, cclE,    eventWeight );
+  fill( m_ccl_e_vs_phi,    cclPhi, cclE,    eventWeight );
 
   return StatusCode::SUCCESS;
 
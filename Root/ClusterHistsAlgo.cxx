@@ -58,6 +58,7 @@ EL::StatusCode ClusterHistsAlgo :: initialize ()
 
 EL::StatusCode ClusterHistsAlgo :: execute ()
 {
+  xAH::ExecuteProfiler profiler(this);
   const xAOD::EventInfo* eventInfo(nullptr);
   ANA_CHECK( HelperFunctions::retrieve(eventInfo, m_eventInfoContainerName, m_event, m_store, msg()) );
 
@@ -0,0 +1,31 @@
+#include <xAODAnaHelpers/CutflowCounter.h>
+
+#include <TH1D.h>
+
+using namespace xAH;
+
+void CutflowCounter::setHistogram(TH1D* hist)
+{
+  m_hist = hist;
+  if(m_hist) m_counts.assign(m_hist->GetNbinsX()+2, 0);
+}
+
+void CutflowCounter::flush()
+{
+  if(!m_hist) return;
+
+  // the axis can have been extended by other algorithms in the meantime, the bins we counted in stay where they are
+  double nEntries(0);
+  TArrayD* sumw2 = m_hist->GetSumw2N() ? m_hist->GetSumw2() : nullptr;
+  for(std::size_t bin = 0; bin < m_counts.size(); ++bin){
+    if(m_counts[bin] == 0) continue;
+    const double count = m_counts[bin];
+    m_hist->AddBinContent(bin, count);
+    // unit weights, so the sum of squares grows by the count as well
+    if(sumw2) sumw2->fArray[bin] += count;
+    nEntries += count;
+  }
+  m_hist->SetEntries(m_hist->GetEntries() + nEntries);
+
+  m_counts.assign(m_counts.size(), 0);
+}
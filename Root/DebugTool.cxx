@@ -93,6 +93,7 @@ EL::StatusCode DebugTool :: initialize ()
 
 EL::StatusCode DebugTool :: execute ()
 {
+  xAH::ExecuteProfiler profiler(this);
   ANA_MSG_INFO( m_name);
 
   //
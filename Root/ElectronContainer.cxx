@@ -140,6 +140,21 @@ ElectronContainer::ElectronContainer(const std::string& name, const std::string&
     //}
   }
 
+  //
+  // aux variables copied as they are, for every electron in FillParticle
+  //
+  if ( m_infoSwitch.m_isolation ) {
+    m_auxColumns.add<char, int>("isIsolated_LooseTrackOnly", m_isIsolated_LooseTrackOnly, -1);
+    m_auxColumns.add<char, int>("isIsolated_Loose", m_isIsolated_Loose, -1);
+    m_auxColumns.add<char, int>("isIsolated_Tight", m_isIsolated_Tight, -1);
+    m_auxColumns.add<char, int>("isIsolated_Gradient", m_isIsolated_Gradient, -1);
+    m_auxColumns.add<char, int>("isIsolated_GradientLoose", m_isIsolated_GradientLoose, -1);
+    m_auxColumns.add<char, int>("isIsolated_FixedCutLoose", m_isIsolated_FixedCutLoose, -1);
+    m_auxColumns.add<char, int>("isIsolated_FixedCutTight", m_isIsolated_FixedCutTight, -1);
+    m_auxColumns.add<char, int>("isIsolated_FixedCutTightTrackOnly", m_isIsolated_FixedCutTightTrackOnly, -1);
+    m_auxColumns.add<char, int>("isIsolated_UserDefinedFixEfficiency", m_isIsolated_UserDefinedFixEfficiency, -1);
+    m_auxColumns.add<char, int>("isIsolated_UserDefinedCut", m_isIsolated_UserDefinedCut, -1);
+  }
 
 }
 
@@ -625,7 +640,7 @@ void ElectronContainer::clear()
 
   if ( m_infoSwitch.m_trigger ){
     m_isTrigMatched               ->clear();
-    m_isTrigMatchedToChain        ->clear();
+    clearColumn( m_isTrigMatchedToChain );
     m_listTrigChains              ->clear();
   }
 
@@ -685,18 +700,18 @@ void ElectronContainer::clear()
   if ( m_infoSwitch.m_effSF && m_mc ) {
 
     for (auto& PID : m_infoSwitch.m_PIDWPs) {
-      (*m_PIDEff_SF)[ PID ].clear();
+      clearColumn( (*m_PIDEff_SF)[ PID ] );
       for (auto& isol : m_infoSwitch.m_isolWPs) {
         if(!isol.empty())
-          (*m_IsoEff_SF)[ PID+isol ].clear();
+          clearColumn( (*m_IsoEff_SF)[ PID+isol ] );
         for (auto& trig : m_infoSwitch.m_trigWPs) {
-          (*m_TrigEff_SF)[ trig+PID+isol ].clear();
-          (*m_TrigMCEff)[ trig+PID+isol ].clear();
+          clearColumn( (*m_TrigEff_SF)[ trig+PID+isol ] );
+          clearColumn( (*m_TrigMCEff)[ trig+PID+isol ] );
         }
       }
     }
 
-    m_RecoEff_SF->clear();
+    clearColumn( m_RecoEff_SF );
 
   }
 
@@ -763,7 +778,7 @@ void ElectronContainer::FillElectron( const xAOD::IParticle* particle, const xAO
     //
     static SG::AuxElement::Accessor< std::map<std::string,char> > isTrigMatchedMapElAcc("isTrigMatchedMapEl");
 
-    std::vector<int> matches;
+    std::vector<int>& matches = newRow( m_isTrigMatchedToChain );
 
     if ( isTrigMatchedMapElAcc.isAvailable( *elec ) ) {
       // loop over map and fill branches
@@ -777,47 +792,12 @@ void ElectronContainer::FillElectron( const xAOD::IParticle* particle, const xAO
       m_listTrigChains->push_back("NONE");
     }
 
-    m_isTrigMatchedToChain->push_back(matches);
-
     // if at least one match among the chains is found, say this electron is trigger matched
     if ( std::find(matches.begin(), matches.end(), 1) != matches.end() ) { m_isTrigMatched->push_back(1); }
     else { m_isTrigMatched->push_back(0); }
 
   }
 
-  if ( m_infoSwitch.m_isolation ) {
-
-    static SG::AuxElement::Accessor<char> isIsoLooseTrackOnlyAcc ("isIsolated_LooseTrackOnly");
-    safeFill<char, int, xAOD::Electron>(elec, isIsoLooseTrackOnlyAcc, m_isIsolated_LooseTrackOnly, -1);
-
-    static SG::AuxElement::Accessor<char> isIsoLooseAcc ("isIsolated_Loose");
-    safeFill<char, int, xAOD::Electron>(elec, isIsoLooseAcc, m_isIsolated_Loose, -1);
-
-    static SG::AuxElement::Accessor<char> isIsoTightAcc ("isIsolated_Tight");
-    safeFill<char, int, xAOD::Electron>(elec, isIsoTightAcc, m_isIsolated_Tight, -1);
-
-    static SG::AuxElement::Accessor<char> isIsoGradientAcc ("isIsolated_Gradient");
-    safeFill<char, int, xAOD::Electron>(elec, isIsoGradientAcc, m_isIsolated_Gradient, -1);
-
-    static SG::AuxElement::Accessor<char> isIsoGradientLooseAcc ("isIsolated_GradientLoose");
-    safeFill<char, int, xAOD::Electron>(elec, isIsoGradientLooseAcc, m_isIsolated_GradientLoose, -1);
-
-    static SG::AuxElement::Accessor<char> isIsoFixedCutLooseAcc ("isIsolated_FixedCutLoose");
-    safeFill<char, int, xAOD::Electron>(elec, isIsoFixedCutLooseAcc, m_isIsolated_FixedCutLoose, -1);
-
-    static SG::AuxElement::Accessor<char> isIsoFixedCutTightAcc ("isIsolated_FixedCutTight");
-    safeFill<char, int, xAOD::Electron>(elec, isIsoFixedCutTightAcc, m_isIsolated_FixedCutTight, -1);
-
-    static SG::AuxElement::Accessor<char> isIsoFixedCutTightTrackOnlyAcc ("isIsolated_FixedCutTightTrackOnly");
-    safeFill<char, int, xAOD::Electron>(elec, isIsoFixedCutTightTrackOnlyAcc, m_isIsolated_FixedCutTightTrackOnly, -1);
-
-    static SG::AuxElement::Accessor<char> isIsoUserDefinedFixEfficiencyAcc ("isIsolated_UserDefinedFixEfficiency");
-    safeFill<char, int, xAOD::Electron>(elec, isIsoUserDefinedFixEfficiencyAcc, m_isIsolated_UserDefinedFixEfficiency, -1);
-
-    static SG::AuxElement::Accessor<char> isIsoUserDefinedCutAcc ("isIsolated_UserDefinedCut");
-    safeFill<char, int, xAOD::Electron>(elec, isIsoUserDefinedCutAcc, m_isIsolated_UserDefinedCut, -1);
-  }
-
   if ( m_infoSwitch.m_isolationKinematics ) {
     m_etcone20    ->push_back( elec->isolation( xAOD::Iso::etcone20 )    /m_units );
     m_ptcone20    ->push_back( elec->isolation( xAOD::Iso::ptcone20 )    /m_units );
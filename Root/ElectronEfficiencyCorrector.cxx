@@ -109,6 +109,8 @@ EL::StatusCode ElectronEfficiencyCorrector :: initialize ()
     return EL::StatusCode::FAILURE;
   }
 
+  m_inContainerKeys.setPrefix( m_inContainerName );
+
 
   const xAOD::EventInfo* eventInfo(nullptr);
   ANA_CHECK( HelperFunctions::retrieve(eventInfo, m_eventInfoContainerName, m_event, m_store, msg()) );
@@ -452,6 +454,7 @@ EL::StatusCode ElectronEfficiencyCorrector :: initialize ()
 
 EL::StatusCode ElectronEfficiencyCorrector :: execute ()
 {
+  xAH::ExecuteProfiler profiler(this);
   // Here you do everything that needs to be done on every single
   // events, e.g. read input variables, apply cuts, and fill
   // histograms and trees.  This is where most of your actual analysis
@@ -481,15 +484,18 @@ EL::StatusCode ElectronEfficiencyCorrector :: execute ()
   bool writeSystNames(true);
 
   // loop over systematic sets available
-  for ( auto systName : systNames ) {
+  xAH::SystematicRegistry& systRegistry = xAH::SystematicRegistry::instance();
+  for ( const auto& systName : systNames ) {
+
+    unsigned int systID = systRegistry.id( systName );
 
     const xAOD::ElectronContainer* inputElectrons(nullptr);
 
     // some systematics might have rejected the event
-    if ( m_store->contains<xAOD::ElectronContainer>( m_inContainerName+systName ) ) {
+    if ( m_store->contains<xAOD::ElectronContainer>( m_inContainerKeys.key(systID) ) ) {
 
       // retrieve input electrons
-      ANA_CHECK( HelperFunctions::retrieve(inputElectrons, m_inContainerName+systName, m_event, m_store, msg()) );
+      ANA_CHECK( HelperFunctions::retrieve(inputElectrons, m_inContainerKeys.key(systID), m_event, m_store, msg()) );
 
       ANA_MSG_DEBUG( "Number of electrons: " << static_cast<int>(inputElectrons->size()) );
       ANA_MSG_DEBUG( "Input syst: " << systName );
@@ -1,10 +1,34 @@
 #include <xAODAnaHelpers/ElectronHists.h>
+#include <xAODPrimitives/tools/getIsolationAccessor.h>
 #include <sstream>
 
 #include "xAODAnaHelpers/HelperFunctions.h"
 
 ANA_MSG_SOURCE(msgElectronHists, "ElectronHists")
 
+namespace {
+
+  // the accessors of the isolation flags, shared by execute and auxIDs
+  const SG::AuxElement::ConstAccessor<char> isIsoLooseTrackOnlyAcc ("isIsolated_LooseTrackOnly");
+  const SG::AuxElement::ConstAccessor<char> isIsoLooseAcc ("isIsolated_Loose");
+  const SG::AuxElement::ConstAccessor<char> isIsoTightAcc ("isIsolated_Tight");
+  const SG::AuxElement::ConstAccessor<char> isIsoGradientAcc ("isIsolated_Gradient");
+  const SG::AuxElement::ConstAccessor<char> isIsoGradientLooseAcc ("isIsolated_GradientLoose");
+  const SG::AuxElement::ConstAccessor<char> isIsoFixedCutLooseAcc ("isIsolated_FixedCutLoose");
+  const SG::AuxElement::ConstAccessor<char> isIsoFixedCutTightAcc ("isIsolated_FixedCutTight");
+  const SG::AuxElement::ConstAccessor<char> isIsoFixedCutTightTrackOnlyAcc ("isIsolated_FixedCutTightTrackOnly");
+  const SG::AuxElement::ConstAccessor<char> isIsoUserDefinedFixEfficiencyAcc ("isIsolated_UserDefinedFixEfficiency");
+  const SG::AuxElement::ConstAccessor<char> isIsoUserDefinedCutAcc ("isIsolated_UserDefinedCut");
+
+  // the isolation variables filled for m_isolation
+  const xAOD::Iso::IsolationType isolationTypes[] = {
+    xAOD::Iso::ptcone20,    xAOD::Iso::ptcone30,    xAOD::Iso::ptcone40,
+    xAOD::Iso::ptvarcone20, xAOD::Iso::ptvarcone30, xAOD::Iso::ptvarcone40,
+    xAOD::Iso::topoetcone20, xAOD::Iso::topoetcone30, xAOD::Iso::topoetcone40
+  };
+
+}
+
 ElectronHists :: ElectronHists (std::string name, std::string detailStr) :
   IParticleHists(name, detailStr, "electron", "electron"),
   m_infoSwitch(new HelperClasses::ElectronInfoSwitch(m_detailStr))
@@ -86,48 +110,37 @@ StatusCode ElectronHists::execute( const xAOD::IParticle* particle, float eventW
   // isolation
   if ( m_infoSwitch->m_isolation ) {
 
-    static SG::AuxElement::Accessor<char> isIsoLooseTrackOnlyAcc ("isIsolated_LooseTrackOnly");
-    static SG::AuxElement::Accessor<char> isIsoLooseAcc ("isIsolated_Loose");
-    static SG::AuxElement::Accessor<char> isIsoTightAcc ("isIsolated_Tight");
-    static SG::AuxElement::Accessor<char> isIsoGradientAcc ("isIsolated_Gradient");
-    static SG::AuxElement::Accessor<char> isIsoGradientLooseAcc ("isIsolated_GradientLoose");
-    static SG::AuxElement::Accessor<char> isIsoFixedCutLooseAcc ("isIsolated_FixedCutLoose");
-    static SG::AuxElement::Accessor<char> isIsoFixedCutTightAcc ("isIsolated_FixedCutTight");
-    static SG::AuxElement::Accessor<char> isIsoFixedCutTightTrackOnlyAcc ("isIsolated_FixedCutTightTrackOnly");
-    static SG::AuxElement::Accessor<char> isIsoUserDefinedFixEfficiencyAcc ("isIsolated_UserDefinedFixEfficiency");
-    static SG::AuxElement::Accessor<char> isIsoUserDefinedCutAcc ("isIsolated_UserDefinedCut");
-
-    if (isIsoLooseTrackOnlyAcc.isAvailable(*electron)) {m_isIsolated_LooseTrackOnly->Fill(isIsoLooseTrackOnlyAcc(*electron), eventWeight);} else {m_isIsolated_LooseTrackOnly->Fill(-1,eventWeight);}
-    if (isIsoLooseAcc.isAvailable(*electron) )         {m_isIsolated_Loose->Fill( isIsoLooseAcc( *electron ) ,  eventWeight ); } else { m_isIsolated_Loose->Fill( -1 ,  eventWeight ); }
-    if (isIsoTightAcc.isAvailable( *electron ) )       { m_isIsolated_Tight->Fill( isIsoTightAcc( *electron ) ,  eventWeight ); } else { m_isIsolated_Tight->Fill( -1 ,  eventWeight ); }
-    if (isIsoGradientAcc.isAvailable( *electron ) )       { m_isIsolated_Gradient->Fill( isIsoGradientAcc( *electron ) ,  eventWeight ); } else { m_isIsolated_Gradient->Fill( -1 ,  eventWeight ); }
-    if (isIsoGradientLooseAcc.isAvailable(*electron))  { m_isIsolated_GradientLoose->Fill( isIsoGradientLooseAcc( *electron ) ,  eventWeight ); } else { m_isIsolated_GradientLoose->Fill( -1 ,  eventWeight ); }
-    if (isIsoFixedCutLooseAcc.isAvailable(*electron))          { m_isIsolated_FixedCutLoose->Fill( isIsoFixedCutLooseAcc( *electron ) ,  eventWeight ); } else { m_isIsolated_FixedCutLoose->Fill( -1 ,  eventWeight ); }
-    if (isIsoFixedCutTightAcc.isAvailable(*electron))          { m_isIsolated_FixedCutTight->Fill( isIsoFixedCutTightAcc( *electron ) ,  eventWeight ); } else { m_isIsolated_FixedCutTight->Fill( -1 ,  eventWeight ); }
-    if (isIsoFixedCutTightTrackOnlyAcc.isAvailable(*electron))          { m_isIsolated_FixedCutTightTrackOnly->Fill( isIsoFixedCutTightTrackOnlyAcc( *electron ) ,  eventWeight ); } else { m_isIsolated_FixedCutTightTrackOnly->Fill( -1 ,  eventWeight ); }
-    if ( isIsoUserDefinedFixEfficiencyAcc.isAvailable(*electron)) {m_isIsolated_UserDefinedFixEfficiency->Fill(isIsoUserDefinedFixEfficiencyAcc(*electron), eventWeight);} else {m_isIsolated_UserDefinedFixEfficiency->Fill(-1,eventWeight);}
-    if ( isIsoUserDefinedCutAcc.isAvailable( *electron ) )           { m_isIsolated_UserDefinedCut->Fill( isIsoUserDefinedCutAcc( *electron ) ,  eventWeight ); } else { m_isIsolated_UserDefinedCut->Fill( -1 ,  eventWeight ); }
-
-    m_ptcone20    ->Fill( electron->isolation( xAOD::Iso::ptcone20    ) / 1e3, eventWeight );
-    m_ptcone30    ->Fill( electron->isolation( xAOD::Iso::ptcone30    ) / 1e3, eventWeight );
-    m_ptcone40    ->Fill( electron->isolation( xAOD::Iso::ptcone40    ) / 1e3, eventWeight );
-    m_ptvarcone20 ->Fill( electron->isolation( xAOD::Iso::ptvarcone20 ) / 1e3, eventWeight );
-    m_ptvarcone30 ->Fill( electron->isolation( xAOD::Iso::ptvarcone30 ) / 1e3, eventWeight );
-    m_ptvarcone40 ->Fill( electron->isolation( xAOD::Iso::ptvarcone40 ) / 1e3, eventWeight );
-    m_topoetcone20->Fill( electron->isolation( xAOD::Iso::topoetcone20) / 1e3, eventWeight );
-    m_topoetcone30->Fill( electron->isolation( xAOD::Iso::topoetcone30) / 1e3, eventWeight );
-    m_topoetcone40->Fill( electron->isolation( xAOD::Iso::topoetcone40) / 1e3, eventWeight );
+    if (isIsoLooseTrackOnlyAcc.isAvailable(*electron)) {fill( m_isIsolated_LooseTrackOnly, isIsoLooseTrackOnlyAcc(*electron), eventWeight );} else {fill( m_isIsolated_LooseTrackOnly, -1,eventWeight );}
+    if (isIsoLooseAcc.isAvailable(*electron) )         {fill( m_isIsolated_Loose, isIsoLooseAcc( *electron ) ,  eventWeight ); } else { fill( m_isIsolated_Loose, -1 ,  eventWeight ); }
+    if (isIsoTightAcc.isAvailable( *electron ) )       { fill( m_isIsolated_Tight, isIsoTightAcc( *electron ) ,  eventWeight ); } else { fill( m_isIsolated_Tight, -1 ,  eventWeight ); }
+    if (isIsoGradientAcc.isAvailable( *electron ) )       { fill( m_isIsolated_Gradient, isIsoGradientAcc( *electron ) ,  eventWeight ); } else { fill( m_isIsolated_Gradient, -1 ,  eventWeight ); }
+    if (isIsoGradientLooseAcc.isAvailable(*electron))  { fill( m_isIsolated_GradientLoose, isIsoGradientLooseAcc( *electron ) ,  eventWeight ); } else { fill( m_isIsolated_GradientLoose, -1 ,  eventWeight ); }
+    if (isIsoFixedCutLooseAcc.isAvailable(*electron))          { fill( m_isIsolated_FixedCutLoose, isIsoFixedCutLooseAcc( *electron ) ,  eventWeight ); } else { fill( m_isIsolated_FixedCutLoose, -1 ,  eventWeight ); }
+    if (isIsoFixedCutTightAcc.isAvailable(*electron))          { fill( m_isIsolated_FixedCutTight, isIsoFixedCutTightAcc( *electron ) ,  eventWeight ); } else { fill( m_isIsolated_FixedCutTight, -1 ,  eventWeight ); }
+    if (isIsoFixedCutTightTrackOnlyAcc.isAvailable(*electron))          { fill( m_isIsolated_FixedCutTightTrackOnly, isIsoFixedCutTightTrackOnlyAcc( *electron ) ,  eventWeight ); } else { fill( m_isIsolated_FixedCutTightTrackOnly, -1 ,  eventWeight ); }
+    if ( isIsoUserDefinedFixEfficiencyAcc.isAvailable(*electron)) {fill( m_isIsolated_UserDefinedFixEfficiency, isIsoUserDefinedFixEfficiencyAcc(*electron), eventWeight );} else {fill( m_isIsolated_UserDefinedFixEfficiency, -1,eventWeight );}
+    if ( isIsoUserDefinedCutAcc.isAvailable( *electron ) )           { fill( m_isIsolated_UserDefinedCut, isIsoUserDefinedCutAcc( *electron ) ,  eventWeight ); } else { fill( m_isIsolated_UserDefinedCut, -1 ,  eventWeight ); }
+
+    fill( m_ptcone20,     electron->isolation( xAOD::Iso::ptcone20    ) / 1e3, eventWeight );
+    fill( m_ptcone30,     electron->isolation( xAOD::Iso::ptcone30    ) / 1e3, eventWeight );
+    fill( m_ptcone40,     electron->isolation( xAOD::Iso::ptcone40    ) / 1e3, eventWeight );
+    fill( m_ptvarcone20,  electron->isolation( xAOD::Iso::ptvarcone20 ) / 1e3, eventWeight );
+    fill( m_ptvarcone30,  electron->isolation( xAOD::Iso::ptvarcone30 ) / 1e3, eventWeight );
+    fill( m_ptvarcone40,  electron->isolation( xAOD::Iso::ptvarcone40 ) / 1e3, eventWeight );
+    fill( m_topoetcone20, electron->isolation( xAOD::Iso::topoetcone20) / 1e3, eventWeight );
+    fill( m_topoetcone30, electron->isolation( xAOD::Iso::topoetcone30) / 1e3, eventWeight );
+    fill( m_topoetcone40, electron->isolation( xAOD::Iso::topoetcone40) / 1e3, eventWeight );
 
     float electronPt = electron->pt();
-    m_ptcone20_rel     ->Fill( electron->isolation( xAOD::Iso::ptcone20 )     / electronPt,  eventWeight );
-    m_ptcone30_rel     ->Fill( electron->isolation( xAOD::Iso::ptcone30 )     / electronPt,  eventWeight );
-    m_ptcone40_rel     ->Fill( electron->isolation( xAOD::Iso::ptcone40 )     / electronPt,  eventWeight );
-    m_ptvarcone20_rel  ->Fill( electron->isolation( xAOD::Iso::ptvarcone20 )  / electronPt,  eventWeight );
-    m_ptvarcone30_rel  ->Fill( electron->isolation( xAOD::Iso::ptvarcone30 )  / electronPt,  eventWeight );
-    m_ptvarcone40_rel  ->Fill( electron->isolation( xAOD::Iso::ptvarcone40 )  / electronPt,  eventWeight );
-    m_topoetcone20_rel ->Fill( electron->isolation( xAOD::Iso::topoetcone20 ) / electronPt,  eventWeight );
-    m_topoetcone30_rel ->Fill( electron->isolation( xAOD::Iso::topoetcone30 ) / electronPt,  eventWeight );
-    m_topoetcone40_rel ->Fill( electron->isolation( xAOD::Iso::topoetcone40 ) / electronPt,  eventWeight );
+    fill( m_ptcone20_rel,      electron->isolation( xAOD::Iso::ptcone20 )     / electronPt,  eventWeight );
+    fill( m_ptcone30_rel,      electron->isolation( xAOD::Iso::ptcone30 )     / electronPt,  eventWeight );
+    fill( m_ptcone40_rel,      electron->isolation( xAOD::Iso::ptcone40 )     / electronPt,  eventWeight );
+    fill( m_ptvarcone20_rel,   electron->isolation( xAOD::Iso::ptvarcone20 )  / electronPt,  eventWeight );
+    fill( m_ptvarcone30_rel,   electron->isolation( xAOD::Iso::ptvarcone30 )  / electronPt,  eventWeight );
+    fill( m_ptvarcone40_rel,   electron->isolation( xAOD::Iso::ptvarcone40 )  / electronPt,  eventWeight );
+    fill( m_topoetcone20_rel,  electron->isolation( xAOD::Iso::topoetcone20 ) / electronPt,  eventWeight );
+    fill( m_topoetcone30_rel,  electron->isolation( xAOD::Iso::topoetcone30 ) / electronPt,  eventWeight );
+    fill( m_topoetcone40_rel,  electron->isolation( xAOD::Iso::topoetcone40 ) / electronPt,  eventWeight );
 
   }
 
@@ -154,55 +167,69 @@ StatusCode ElectronHists::execute( const xAH::Particle* particle, float eventWei
       return StatusCode::FAILURE;
     }
 
-  m_isIsolated_LooseTrackOnly           ->Fill( elec->isIsolated_LooseTrackOnly ,  eventWeight );
-  m_isIsolated_Loose                    ->Fill( elec->isIsolated_Loose ,  eventWeight );
-  m_isIsolated_Tight                    ->Fill( elec->isIsolated_Tight ,  eventWeight );
-  m_isIsolated_Gradient                 ->Fill( elec->isIsolated_Gradient ,  eventWeight );
-  m_isIsolated_GradientLoose            ->Fill( elec->isIsolated_GradientLoose ,  eventWeight );
+  fill( m_isIsolated_LooseTrackOnly,            elec->isIsolated_LooseTrackOnly ,  eventWeight );
+  fill( m_isIsolated_Loose,                     elec->isIsolated_Loose ,  eventWeight );
+  fill( m_isIsolated_Tight,                     elec->isIsolated_Tight ,  eventWeight );
+  fill( m_isIsolated_Gradient,                  elec->isIsolated_Gradient ,  eventWeight );
+  fill( m_isIsolated_GradientLoose,             elec->isIsolated_GradientLoose ,  eventWeight );
   //m_isIsolated_GradientT1               ->Fill( elec->isIsolated_GradientLoose ,  eventWeight );
   //m_isIsolated_GradientT2               ->Fill( elec->isIsoGradientT2Acc ,  eventWeight );
   //m_isIsolated_MU0p06                   ->Fill( elec->isIsoMU0p06Acc ,  eventWeight );
-  m_isIsolated_FixedCutLoose            ->Fill( elec->isIsolated_FixedCutLoose ,  eventWeight );
+  fill( m_isIsolated_FixedCutLoose,             elec->isIsolated_FixedCutLoose ,  eventWeight );
   //m_isIsolated_FixedCutTight            ->Fill( elec->isIsolated_FixedCutTight ,  eventWeight );
-  m_isIsolated_FixedCutTightTrackOnly   ->Fill( elec->isIsolated_FixedCutTightTrackOnly ,  eventWeight );
-  m_isIsolated_UserDefinedFixEfficiency ->Fill( elec->isIsolated_UserDefinedFixEfficiency ,  eventWeight );
-  m_isIsolated_UserDefinedCut           ->Fill( elec->isIsolated_UserDefinedCut ,  eventWeight );
+  fill( m_isIsolated_FixedCutTightTrackOnly,    elec->isIsolated_FixedCutTightTrackOnly ,  eventWeight );
+  fill( m_isIsolated_UserDefinedFixEfficiency,  elec->isIsolated_UserDefinedFixEfficiency ,  eventWeight );
+  fill( m_isIsolated_UserDefinedCut,            elec->isIsolated_UserDefinedCut ,  eventWeight );
 
 
   // isolation
   if ( m_infoSwitch->m_isolation ) {
-    m_ptcone20    ->Fill( elec->ptcone20    , eventWeight );
-    m_ptcone30    ->Fill( elec->ptcone30    , eventWeight );
-    m_ptcone40    ->Fill( elec->ptcone40    , eventWeight );
-    m_ptvarcone20 ->Fill( elec->ptvarcone20 , eventWeight );
-    m_ptvarcone30 ->Fill( elec->ptvarcone30 , eventWeight );
-    m_ptvarcone40 ->Fill( elec->ptvarcone40 , eventWeight );
-    m_topoetcone20->Fill( elec->topoetcone20, eventWeight );
-    m_topoetcone30->Fill( elec->topoetcone30, eventWeight );
-    m_topoetcone40->Fill( elec->topoetcone40, eventWeight );
+    fill( m_ptcone20,     elec->ptcone20    , eventWeight );
+    fill( m_ptcone30,     elec->ptcone30    , eventWeight );
+    fill( m_ptcone40,     elec->ptcone40    , eventWeight );
+    fill( m_ptvarcone20,  elec->ptvarcone20 , eventWeight );
+    fill( m_ptvarcone30,  elec->ptvarcone30 , eventWeight );
+    fill( m_ptvarcone40,  elec->ptvarcone40 , eventWeight );
+    fill( m_topoetcone20, elec->topoetcone20, eventWeight );
+    fill( m_topoetcone30, elec->topoetcone30, eventWeight );
+    fill( m_topoetcone40, elec->topoetcone40, eventWeight );
 
 
     float elecPt = elec->p4.Pt();
-    m_ptcone20_rel     ->Fill( elec->ptcone20/elecPt        ,  eventWeight );
-    m_ptcone30_rel     ->Fill( elec->ptcone30/elecPt        ,  eventWeight );
-    m_ptcone40_rel     ->Fill( elec->ptcone40/elecPt        ,  eventWeight );
-    m_ptvarcone20_rel  ->Fill( elec->ptvarcone20 /elecPt    ,  eventWeight );
-    m_ptvarcone30_rel  ->Fill( elec->ptvarcone30 /elecPt    ,  eventWeight );
-    m_ptvarcone40_rel  ->Fill( elec->ptvarcone40 /elecPt    ,  eventWeight );
-    m_topoetcone20_rel ->Fill( elec->topoetcone20/elecPt    ,  eventWeight );
-    m_topoetcone30_rel ->Fill( elec->topoetcone30/elecPt    ,  eventWeight );
-    m_topoetcone40_rel ->Fill( elec->topoetcone40/elecPt    ,  eventWeight );
+    fill( m_ptcone20_rel,      elec->ptcone20/elecPt        ,  eventWeight );
+    fill( m_ptcone30_rel,      elec->ptcone30/elecPt        ,  eventWeight );
+    fill( m_ptcone40_rel,      elec->ptcone40/elecPt        ,  eventWeight );
+    fill( m_ptvarcone20_rel,   elec->ptvarcone20 /elecPt    ,  eventWeight );
+    fill( m_ptvarcone30_rel,   elec->ptvarcone30 /elecPt    ,  eventWeight );
+    fill( m_ptvarcone40_rel,   elec->ptvarcone40 /elecPt    ,  eventWeight );
+    fill( m_topoetcone20_rel,  elec->topoetcone20/elecPt    ,  eventWeight );
+    fill( m_topoetcone30_rel,  elec->topoetcone30/elecPt    ,  eventWeight );
+    fill( m_topoetcone40_rel,  elec->topoetcone40/elecPt    ,  eventWeight );
   }
 
 
   if ( m_infoSwitch->m_quality ) {
 
     //m_isVeryLoose->Fill( elec->  isVeryLoose,  eventWeight );
-    m_LHLoose    ->Fill( elec->  LHLoose    ,  eventWeight );
-    m_LHMedium   ->Fill( elec->  LHMedium   ,  eventWeight );
-    m_LHTight    ->Fill( elec->  LHTight    ,  eventWeight );
+    fill( m_LHLoose,     elec->  LHLoose    ,  eventWeight );
+    fill( m_LHMedium,    elec->  LHMedium   ,  eventWeight );
+    fill( m_LHTight,     elec->  LHTight    ,  eventWeight );
 
   }
 
   return StatusCode::SUCCESS;
 }
+
+void ElectronHists::auxIDs( std::set< SG::auxid_t >& auxids ) const {
+  IParticleHists::auxIDs( auxids );
+
+  if ( m_infoSwitch->m_isolation ) {
+    for ( const auto* acc : { &isIsoLooseTrackOnlyAcc, &isIsoLooseAcc, &isIsoTightAcc, &isIsoGradientAcc, &isIsoGradientLooseAcc,
+                              &isIsoFixedCutLooseAcc, &isIsoFixedCutTightAcc, &isIsoFixedCutTightTrackOnlyAcc, &isIsoUserDefinedFixEfficiencyAcc, &isIsoUserDefinedCutAcc } ) {
+      auxids.insert( acc->auxid() );
+    }
+    for ( xAOD::Iso::IsolationType type : isolationTypes ) {
+      auxids.insert( xAOD::getIsolationAccessor( type )->auxid() );
+    }
+  }
+}
@@ -117,6 +117,8 @@ EL::StatusCode ElectronSelector :: initialize ()
 
   ANA_MSG_INFO( "Initializing ElectronSelector Interface... ");
 
+  m_kinematicPreFilter.setCuts( m_pT_min, m_pT_max, m_eta_max );
+
   // Let's see if the algorithm has been already used before:
   // if yes, will write object cutflow in a different histogram!
   //
@@ -176,6 +178,9 @@ EL::StatusCode ElectronSelector :: initialize ()
       m_el_cutflow_iso_cut     = m_el_cutflowHist_2->GetXaxis()->FindBin("iso_cut");
     }
 
+    m_el_cutflowCounter_1.setHistogram( m_el_cutflowHist_1 );
+    if ( m_isUsedBefore ) m_el_cutflowCounter_2.setHistogram( m_el_cutflowHist_2 );
+
   }
 
   m_event = wk()->xaodEvent();
@@ -221,6 +226,9 @@ EL::StatusCode ElectronSelector :: initialize ()
     return EL::StatusCode::FAILURE;
   }
 
+  m_inContainerKeys.setPrefix( m_inContainerName );
+  m_outContainerKeys.setPrefix( m_outContainerName );
+
 
   m_numEvent      = 0;
   m_numObject     = 0;
@@ -381,6 +389,7 @@ EL::StatusCode ElectronSelector :: initialize ()
 
 EL::StatusCode ElectronSelector :: execute ()
 {
+  xAH::ExecuteProfiler profiler(this);
   // Here you do everything that needs to be done on every single
   // events, e.g. read input variables, apply cuts, and fill
   // histograms and trees.  This is where most of your actual analysis
@@ -482,11 +491,14 @@ EL::StatusCode ElectronSelector :: execute ()
     // loop over systematic sets
     //
     bool eventPassThisSyst(false);
-    for ( auto systName : *systNames ) {
+    xAH::SystematicRegistry& systRegistry = xAH::SystematicRegistry::instance();
+    for ( const auto& systName : *systNames ) {
 
-      ANA_MSG_DEBUG( " syst name: " << systName << "  input container name: " << m_inContainerName+systName );
+      unsigned int systID = systRegistry.id( systName );
 
-      ANA_CHECK( HelperFunctions::retrieve(inElectrons, m_inContainerName + systName, m_event, m_store, msg()) );
+      ANA_MSG_DEBUG( " syst name: " << systName << "  input container name: " << m_inContainerKeys.key(systID) );
+
+      ANA_CHECK( HelperFunctions::retrieve(inElectrons, m_inContainerKeys.key(systID), m_event, m_store, msg()) );
 
       // create output container (if requested) - one for each systematic
       //
@@ -508,12 +520,12 @@ EL::StatusCode ElectronSelector :: execute ()
       //
       eventPass = ( eventPass || eventPassThisSyst );
 
-      ANA_MSG_DEBUG( " syst name: " << systName << "  output container name: " << m_outContainerName+systName );
+      ANA_MSG_DEBUG( " syst name: " << systName << "  output container name: " << m_outContainerKeys.key(systID) );
 
       if ( m_createSelectedContainer ) {
         if ( eventPassThisSyst ) {
           // add ConstDataVector to TStore
-          ANA_CHECK( m_store->record( selectedElectrons, m_outContainerName+systName ));
+          ANA_CHECK( m_store->record( selectedElectrons, m_outContainerKeys.key(systID) ));
         } else {
           // if the event does not pass the selection for this syst, CDV won't be ever recorded to TStore, so we have to delete it!
           delete selectedElectrons; selectedElectrons = nullptr;
@@ -549,11 +561,19 @@ bool ElectronSelector :: executeSelection ( const xAOD::ElectronContainer* inEle
 
   const xAOD::VertexContainer* vertices(nullptr);
   ANA_CHECK( HelperFunctions::retrieve(vertices, "PrimaryVertices", m_event, m_store, msg()) );
-  const xAOD::Vertex *pvx = HelperFunctions::getPrimaryVertex(vertices, msg());
+  const xAOD::EventInfo* eventInfo(nullptr);
+  ANA_CHECK( HelperFunctions::retrieve(eventInfo, m_eventInfoContainerName, m_event, m_store, msg()) );
+  const xAOD::Vertex *pvx = HelperFunctions::getPrimaryVertex(vertices, eventInfo, msg());
 
   int nPass(0); int nObj(0);
   static SG::AuxElement::Decorator< char > passSelDecor( "passSel" );
 
+  // cheap kinematic cuts for all electrons at once, passCuts only has to look at the survivors
+  const bool usePreFilter = m_doKinematicPreFilter && m_kinematicPreFilter.active();
+  if ( usePreFilter ) {
+    m_kinematicPreFilter.apply( *inElectrons, [](const xAOD::Electron* electron) { return ( electron->caloCluster() ) ? electron->caloCluster()->etaBE(2) : -999.0; } );
+  }
+
   for ( auto el_itr : *inElectrons ) { // duplicated of basic loop
 
     // if only looking at a subset of electrons make sure all are decorated
@@ -568,7 +588,13 @@ bool ElectronSelector :: executeSelection ( const xAOD::ElectronContainer* inEle
     }
 
     nObj++;
-    bool passSel = this->passCuts( el_itr, pvx );
+    bool passSel(false);
+    if ( usePreFilter && !m_kinematicPreFilter.passed( nObj-1 ) ) {
+      if(m_useCutFlow) m_el_cutflowCounter_1.fill( m_el_cutflow_all );
+      if ( m_isUsedBefore && m_useCutFlow ) { m_el_cutflowCounter_2.fill( m_el_cutflow_all ); }
+    } else {
+      passSel = this->passCuts( el_itr, pvx );
+    }
     if ( m_decorateSelectedObjects ) {
       passSelDecor( *el_itr ) = passSel;
     }
@@ -662,9 +688,6 @@ bool ElectronSelector :: executeSelection ( const xAOD::ElectronContainer* inEle
 
       ANA_MSG_DEBUG( "Doing di-electron trigger matching...");
 
-      const xAOD::EventInfo* eventInfo(nullptr);
-      ANA_CHECK( HelperFunctions::retrieve(eventInfo, m_eventInfoContainerName, m_event, m_store, msg()) );
-
       typedef std::pair< std::pair<unsigned int,unsigned int>, char>     dielectron_trigmatch_pair;
       typedef std::multimap< std::string, dielectron_trigmatch_pair >    dielectron_trigmatch_pair_map;
       static SG::AuxElement::Decorator< dielectron_trigmatch_pair_map >  diElectronTrigMatchPairMapDecor( "diElectronTrigMatchPairMap" );
@@ -741,6 +764,8 @@ EL::StatusCode ElectronSelector :: finalize ()
     ANA_MSG_INFO( "Filling cutflow");
     m_cutflowHist ->SetBinContent( m_cutflow_bin, m_numEventPass        );
     m_cutflowHistW->SetBinContent( m_cutflow_bin, m_weightNumEventPass  );
+    m_el_cutflowCounter_1.flush();
+    m_el_cutflowCounter_2.flush();
   }
 
   return EL::StatusCode::SUCCESS;
@@ -777,8 +802,8 @@ int ElectronSelector :: passCuts( const xAOD::Electron* electron, const xAOD::Ve
   float eta   = ( electron->caloCluster() ) ? electron->caloCluster()->etaBE(2) : -999.0;
 
   // fill cutflow bin 'all' before any cut
-  if(m_useCutFlow) m_el_cutflowHist_1->Fill( m_el_cutflow_all, 1 );
-  if ( m_isUsedBefore && m_useCutFlow ) { m_el_cutflowHist_2->Fill( m_el_cutflow_all, 1 ); }
+  if(m_useCutFlow) m_el_cutflowCounter_1.fill( m_el_cutflow_all );
+  if ( m_isUsedBefore && m_useCutFlow ) { m_el_cutflowCounter_2.fill( m_el_cutflow_all ); }
 
   // *********************************************************************************************************************************************************************
   //
@@ -790,8 +815,8 @@ int ElectronSelector :: passCuts( const xAOD::Electron* electron, const xAOD::Ve
       return 0;
     }
   }
-  if(m_useCutFlow) m_el_cutflowHist_1->Fill( m_el_cutflow_author_cut, 1 );
-  if ( m_isUsedBefore && m_useCutFlow ) { m_el_cutflowHist_2->Fill( m_el_cutflow_author_cut, 1 ); }
+  if(m_useCutFlow) m_el_cutflowCounter_1.fill( m_el_cutflow_author_cut );
+  if ( m_isUsedBefore && m_useCutFlow ) { m_el_cutflowCounter_2.fill( m_el_cutflow_author_cut ); }
 
   // *********************************************************************************************************************************************************************
   //
@@ -803,8 +828,8 @@ int ElectronSelector :: passCuts( const xAOD::Electron* electron, const xAOD::Ve
       return 0;
     }
   }
-  if(m_useCutFlow) m_el_cutflowHist_1->Fill( m_el_cutflow_OQ_cut, 1 );
-  if ( m_isUsedBefore && m_useCutFlow ) { m_el_cutflowHist_2->Fill( m_el_cutflow_OQ_cut, 1 ); }
+  if(m_useCutFlow) m_el_cutflowCounter_1.fill( m_el_cutflow_OQ_cut );
+  if ( m_isUsedBefore && m_useCutFlow ) { m_el_cutflowCounter_2.fill( m_el_cutflow_OQ_cut ); }
 
   // *********************************************************************************************************************************************************************
   //
@@ -816,8 +841,8 @@ int ElectronSelector :: passCuts( const xAOD::Electron* electron, const xAOD::Ve
       return 0;
     }
   }
-  if(m_useCutFlow) m_el_cutflowHist_1->Fill( m_el_cutflow_ptmax_cut, 1 );
-  if ( m_isUsedBefore && m_useCutFlow ) { m_el_cutflowHist_2->Fill( m_el_cutflow_ptmax_cut, 1 ); }
+  if(m_useCutFlow) m_el_cutflowCounter_1.fill( m_el_cutflow_ptmax_cut );
+  if ( m_isUsedBefore && m_useCutFlow ) { m_el_cutflowCounter_2.fill( m_el_cutflow_ptmax_cut ); }
 
   // *********************************************************************************************************************************************************************
   //
@@ -829,8 +854,8 @@ int ElectronSelector :: passCuts( const xAOD::Electron* electron, const xAOD::Ve
       return 0;
     }
   }
-  if(m_useCutFlow) m_el_cutflowHist_1->Fill( m_el_cutflow_ptmin_cut, 1 );
-  if ( m_isUsedBefore && m_useCutFlow ) { m_el_cutflowHist_2->Fill( m_el_cutflow_ptmin_cut, 1 ); }
+  if(m_useCutFlow) m_el_cutflowCounter_1.fill( m_el_cutflow_ptmin_cut );
+  if ( m_isUsedBefore && m_useCutFlow ) { m_el_cutflowCounter_2.fill( m_el_cutflow_ptmin_cut ); }
 
   // *********************************************************************************************************************************************************************
   //
@@ -853,8 +878,8 @@ int ElectronSelector :: passCuts( const xAOD::Electron* electron, const xAOD::Ve
       return 0;
     }
   }
-  if(m_useCutFlow) m_el_cutflowHist_1->Fill( m_el_cutflow_eta_cut, 1 );
-  if ( m_isUsedBefore && m_useCutFlow ) { m_el_cutflowHist_2->Fill( m_el_cutflow_eta_cut, 1 ); }
+  if(m_useCutFlow) m_el_cutflowCounter_1.fill( m_el_cutflow_eta_cut );
+  if ( m_isUsedBefore && m_useCutFlow ) { m_el_cutflowCounter_2.fill( m_el_cutflow_eta_cut ); }
 
 
   // *********************************************************************************************************************************************************************
@@ -887,8 +912,8 @@ int ElectronSelector :: passCuts( const xAOD::Electron* electron, const xAOD::Ve
       return 0;
     }
   }
-  if ( m_useCutFlow ) m_el_cutflowHist_1->Fill( m_el_cutflow_z0sintheta_cut, 1 );
-  if ( m_isUsedBefore && m_useCutFlow ) { m_el_cutflowHist_2->Fill( m_el_cutflow_z0sintheta_cut, 1 ); }
+  if ( m_useCutFlow ) m_el_cutflowCounter_1.fill( m_el_cutflow_z0sintheta_cut );
+  if ( m_isUsedBefore && m_useCutFlow ) { m_el_cutflowCounter_2.fill( m_el_cutflow_z0sintheta_cut ); }
 
   // decorate electron w/ z0*sin(theta) info
   static SG::AuxElement::Decorator< float > z0sinthetaDecor("z0sintheta");
@@ -902,8 +927,8 @@ int ElectronSelector :: passCuts( const xAOD::Electron* electron, const xAOD::Ve
       return 0;
     }
   }
-  if ( m_useCutFlow ) m_el_cutflowHist_1->Fill( m_el_cutflow_d0_cut, 1 );
-  if ( m_isUsedBefore && m_useCutFlow ) { m_el_cutflowHist_2->Fill( m_el_cutflow_d0_cut, 1 ); }
+  if ( m_useCutFlow ) m_el_cutflowCounter_1.fill( m_el_cutflow_d0_cut );
+  if ( m_isUsedBefore && m_useCutFlow ) { m_el_cutflowCounter_2.fill( m_el_cutflow_d0_cut ); }
 
   // d0sig cut
   //
@@ -913,8 +938,8 @@ int ElectronSelector :: passCuts( const xAOD::Electron* electron, const xAOD::Ve
       return 0;
     }
   }
-  if ( m_useCutFlow) m_el_cutflowHist_1->Fill( m_el_cutflow_d0sig_cut, 1 );
-  if ( m_isUsedBefore && m_useCutFlow ) { m_el_cutflowHist_2->Fill( m_el_cutflow_d0sig_cut, 1 ); }
+  if ( m_useCutFlow) m_el_cutflowCounter_1.fill( m_el_cutflow_d0sig_cut );
+  if ( m_isUsedBefore && m_useCutFlow ) { m_el_cutflowCounter_2.fill( m_el_cutflow_d0sig_cut ); }
 
   // decorate electron w/ d0sig info
   static SG::AuxElement::Decorator< float > d0SigDecor("d0sig");
@@ -940,8 +965,8 @@ int ElectronSelector :: passCuts( const xAOD::Electron* electron, const xAOD::Ve
       return 0;
     }
   }
-  if ( m_useCutFlow ) m_el_cutflowHist_1->Fill( m_el_cutflow_BL_cut, 1 );
-  if ( m_isUsedBefore && m_useCutFlow ) { m_el_cutflowHist_2->Fill( m_el_cutflow_BL_cut, 1 ); }
+  if ( m_useCutFlow ) m_el_cutflowCounter_1.fill( m_el_cutflow_BL_cut );
+  if ( m_isUsedBefore && m_useCutFlow ) { m_el_cutflowCounter_2.fill( m_el_cutflow_BL_cut ); }
 
   // *********************************************************************************************************************************************************************
   //
@@ -1078,8 +1103,8 @@ int ElectronSelector :: passCuts( const xAOD::Electron* electron, const xAOD::Ve
     }
   }// if m_doCutBasedPID
 
-  if(m_useCutFlow) m_el_cutflowHist_1->Fill( m_el_cutflow_PID_cut, 1 );
-  if ( m_isUsedBefore && m_useCutFlow ) { m_el_cutflowHist_2->Fill( m_el_cutflow_PID_cut, 1 ); }
+  if(m_useCutFlow) m_el_cutflowCounter_1.fill( m_el_cutflow_PID_cut );
+  if ( m_isUsedBefore && m_useCutFlow ) { m_el_cutflowCounter_2.fill( m_el_cutflow_PID_cut ); }
 
 
   // *********************************************************************************************************************************************************************
@@ -1109,8 +1134,8 @@ int ElectronSelector :: passCuts( const xAOD::Electron* electron, const xAOD::Ve
     ANA_MSG_DEBUG( "Electron failed isolation cut " << m_MinIsoWPCut );
     return 0;
   }
-  if(m_useCutFlow) m_el_cutflowHist_1->Fill( m_el_cutflow_iso_cut, 1 );
-  if ( m_isUsedBefore && m_useCutFlow ) { m_el_cutflowHist_2->Fill( m_el_cutflow_iso_cut, 1 ); }
+  if(m_useCutFlow) m_el_cutflowCounter_1.fill( m_el_cutflow_iso_cut );
+  if ( m_isUsedBefore && m_useCutFlow ) { m_el_cutflowCounter_2.fill( m_el_cutflow_iso_cut ); }
 
   return 1;
 }
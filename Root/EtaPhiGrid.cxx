@@ -0,0 +1,46 @@
+#include <xAODAnaHelpers/EtaPhiGrid.h>
+
+#include <algorithm>
+
+using namespace xAH;
+
+EtaPhiGrid::EtaPhiGrid(float maxDeltaR) :
+  m_cellSize(maxDeltaR),
+  m_etaMax(5.0)
+{
+  m_nEta = std::max(1, static_cast<int>(std::ceil(2*m_etaMax/m_cellSize)));
+  // phi cells must not be smaller than maxDeltaR, so round the number of cells down
+  m_nPhi = std::max(1, static_cast<int>(std::floor(2*M_PI/m_cellSize)));
+  m_phiCellSize = 2*M_PI/m_nPhi;
+  m_cells.resize(m_nEta*m_nPhi);
+}
+
+void EtaPhiGrid::clear()
+{
+  for(int cell : m_usedCells) m_cells[cell].clear();
+  m_usedCells.clear();
+  m_size = 0;
+}
+
+void EtaPhiGrid::insert(float eta, float phi, int category, std::size_t index)
+{
+  const int cell = etaBin(eta)*m_nPhi + phiBin(phi);
+  if(m_cells[cell].empty()) m_usedCells.push_back(cell);
+  m_cells[cell].push_back(Entry{eta, phi, category, index});
+  ++m_size;
+}
+
+int EtaPhiGrid::etaBin(float eta) const
+{
+  // clamping only ever moves objects closer together, so no neighbour is lost in the outermost cells
+  const int bin = static_cast<int>(std::floor((eta + m_etaMax)/m_cellSize));
+  return std::min(std::max(bin, 0), m_nEta-1);
+}
+
+int EtaPhiGrid::phiBin(float phi) const
+{
+  float shifted = std::fmod(phi + static_cast<float>(M_PI), 2*static_cast<float>(M_PI));
+  if(shifted < 0) shifted += 2*static_cast<float>(M_PI);
+  const int bin = static_cast<int>(shifted/m_phiCellSize);
+  return std::min(bin, m_nPhi-1);
+}
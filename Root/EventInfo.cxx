@@ -293,7 +293,7 @@ void EventInfo::FillEvent( const xAOD::EventInfo* eventInfo,  xAOD::TEvent* even
     if ( event ) {
       const xAOD::VertexContainer* vertices(nullptr);
       HelperFunctions::retrieve( vertices, "PrimaryVertices", event, 0 );
-      m_npv = HelperFunctions::countPrimaryVertices(vertices, 2);
+      m_npv = HelperFunctions::countPrimaryVertices(vertices, eventInfo, 2);
     } else {
       m_npv = -1;
     }
@@ -516,7 +516,7 @@ void FatJetContainer::clear()
 
   if( m_infoSwitch.m_trackJets ){
     m_trkJets->clear();
-    m_trkJetsIdx->clear();
+    clearColumn( m_trkJetsIdx );
   }
 
   return;
@@ -749,7 +749,7 @@ void FatJetContainer::FillFatJet( const xAOD::IParticle* particle ){
       //Warning("execute()", "Unable to fetch \"%s\" link from leading calo-jet", m_infoSwitch.m_trackJetName.data());
     }
 
-    m_trkJetsIdx->push_back(std::vector<unsigned int>());
+    newRow( m_trkJetsIdx );
     for(auto TrackJet : assotrkjets){
       if(!SelectTrackJet(TrackJet)) continue;
       m_trkJetsIdx->back().push_back(m_trkJets->m_n);
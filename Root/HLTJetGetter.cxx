@@ -112,6 +112,7 @@ EL::StatusCode HLTJetGetter :: initialize ()
 
 EL::StatusCode HLTJetGetter :: execute ()
 {
+  xAH::ExecuteProfiler profiler(this);
     ANA_MSG_DEBUG( "Getting HLT jets... ");
 
     //
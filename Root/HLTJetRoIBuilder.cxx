@@ -129,6 +129,7 @@ EL::StatusCode HLTJetRoIBuilder :: initialize ()
 
 EL::StatusCode HLTJetRoIBuilder :: execute ()
 {
+  xAH::ExecuteProfiler profiler(this);
   ANA_MSG_DEBUG( "Doing HLT JEt ROI Building... ");
 
   if(m_doHLTBJet){
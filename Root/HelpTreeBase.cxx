@@ -54,12 +54,19 @@ HelpTreeBase::HelpTreeBase(xAOD::TEvent* event, TTree* tree, TFile* file, const
 
 HelpTreeBase::~HelpTreeBase() {
 
+    // the branch buffers are deleted below, so the writer must be done with them
+    WaitForFill();
+
     //delete all the info switches that have been built earlier on
     //event
     if(m_eventInfo) delete m_eventInfo;
 
     //trig
-    if(m_trigInfoSwitch) delete m_trigInfoSwitch;
+    if(m_trigInfoSwitch) {
+      // the tree is written out with the file after this, so the menu goes in now
+      if(m_trigInfoSwitch->m_trigBitset) m_triggerBits.writeMenu(m_tree);
+      delete m_trigInfoSwitch;
+    }
 
     //muon
     for (auto muon: m_muons)
@@ -111,7 +118,28 @@ HelpTreeBase::HelpTreeBase(TTree* tree, TFile* file, xAOD::TEvent* event, xAOD::
 
 
 void HelpTreeBase::Fill() {
-  m_tree->Fill();
+  // containers written with reduced precision round their float branches now that they are complete
+  for(auto& item : m_muons)         item.second->reducePrecision();
+  for(auto& item : m_elecs)         item.second->reducePrecision();
+  for(auto& item : m_photons)       item.second->reducePrecision();
+  for(auto& item : m_jets)          item.second->reducePrecision();
+  for(auto& item : m_fatjets)       item.second->reducePrecision();
+  for(auto& item : m_truth_fatjets) item.second->reducePrecision();
+  for(auto& item : m_taus)          item.second->reducePrecision();
+  for(auto& item : m_truth)         item.second->reducePrecision();
+  for(auto& item : m_tracks)        item.second->reducePrecision();
+
+  if(m_writer) m_writer->fill(m_tree);
+  else         m_tree->Fill();
+}
+
+void HelpTreeBase::WaitForFill() {
+  if(m_writer) m_writer->wait(m_tree);
+}
+
+void HelpTreeBase::SetWriter(std::shared_ptr<xAH::AsyncTreeWriter> writer) {
+  WaitForFill();
+  m_writer = writer;
 }
 
 /*********************
@@ -138,6 +166,21 @@ void HelpTreeBase::FillEvent( const xAOD::EventInfo* eventInfo, xAOD::TEvent* /*
   this->FillEventUser(eventInfo);
 }
 
+void HelpTreeBase::AddNominalLink() {
+
+  if(m_debug)  Info("AddNominalLink()", "Adding link to the nominal tree");
+
+  m_tree->Branch("inNominal", &m_inNominal, "inNominal/O");
+}
+
+void HelpTreeBase::FillNominalLink( const xAOD::EventInfo* eventInfo, bool inNominal ) {
+
+  // same as xAH::EventInfo::FillEvent, so the entry can be matched to nominal without the rest of the event info
+  m_eventInfo->m_runNumber   = eventInfo->runNumber();
+  m_eventInfo->m_eventNumber = eventInfo->eventNumber();
+  m_inNominal                = inNominal;
+}
+
 /*********************
  *
  *   TRIGGER
@@ -175,6 +218,11 @@ void HelpTreeBase::AddTrigger( const std::string detailStr ) {
     m_tree->Branch("isPassBitsNames",      &m_isPassBitsNames     );
   }
 
+  // the passed chains as a bitset, the chain names and prescales go to the tree's user info at the end
+  if ( m_trigInfoSwitch->m_trigBitset ) {
+    m_triggerBits.setBranches(m_tree);
+  }
+
   //this->AddTriggerUser();
 }
 
@@ -243,6 +291,24 @@ void HelpTreeBase::FillTrigger( const xAOD::EventInfo* eventInfo ) {
 
   }
 
+  if ( m_trigInfoSwitch->m_trigBitset ) {
+
+    static const std::vector< std::string > noChains;
+    static const std::vector< float >       noPrescales;
+    static SG::AuxElement::ConstAccessor< std::vector< std::string > > allChains("isPassedBitsNames");
+    static SG::AuxElement::ConstAccessor< std::vector< std::string > > passTrigs("passTriggers");
+    static SG::AuxElement::ConstAccessor< std::vector< float > >       trigPrescales("triggerPrescales");
+    static SG::AuxElement::ConstAccessor< int > L1PSKey("L1PSKey");
+    static SG::AuxElement::ConstAccessor< int > HLTPSKey("HLTPSKey");
+
+    m_triggerBits.fill( allChains.isAvailable( *eventInfo )     ? allChains( *eventInfo )     : noChains,
+                        passTrigs.isAvailable( *eventInfo )     ? passTrigs( *eventInfo )     : noChains,
+                        trigPrescales.isAvailable( *eventInfo ) ? trigPrescales( *eventInfo ) : noPrescales,
+                        L1PSKey.isAvailable( *eventInfo )       ? L1PSKey( *eventInfo )       : -999,
+                        HLTPSKey.isAvailable( *eventInfo )      ? HLTPSKey( *eventInfo )      : -999 );
+
+  }
+
 }
 
 // Clear Trigger
@@ -259,6 +325,7 @@ void HelpTreeBase::ClearTrigger() {
   m_triggerPrescales.clear();
   m_isPassBits.clear();
   m_isPassBitsNames.clear();
+  m_triggerBits.clear();
 
 }
 
@@ -376,6 +443,7 @@ void HelpTreeBase::FillMuons( const xAOD::MuonContainer* muons, const xAOD::Vert
   for( auto muon_itr : *muons ) {
     this->FillMuon(muon_itr, primaryVertex, muonName);
   }
+  m_muons[muonName]->FillAuxColumns(muons);
 
 }
 
@@ -454,6 +522,7 @@ void HelpTreeBase::FillElectrons( const xAOD::ElectronContainer* electrons, cons
   for ( auto el_itr : *electrons ) {
     this->FillElectron(el_itr, primaryVertex, elecName);
   }
+  m_elecs[elecName]->FillAuxColumns(electrons);
 }
 
 void HelpTreeBase::FillElectron ( const xAOD::Electron* elec, const xAOD::Vertex* primaryVertex, const std::string elecName ) {
@@ -502,6 +571,7 @@ void HelpTreeBase::FillPhotons( const xAOD::PhotonContainer* photons, const std:
   for ( auto ph_itr : *photons ) {
     this->FillPhoton(ph_itr, photonName);
   }
+  m_photons[photonName]->FillAuxColumns(photons);
 }
 
 void HelpTreeBase::FillPhoton( const xAOD::Photon* photon, const std::string photonName ) {
@@ -592,9 +662,12 @@ void HelpTreeBase::FillJets( const xAOD::JetContainer* jets, int pvLocation, con
 
   xAH::JetContainer* thisJet = m_jets[jetName];
 
+  const xAOD::EventInfo* eventInfo(nullptr);
+  HelperFunctions::retrieve(eventInfo, "EventInfo", m_event, m_store);
+
   if( thisJet->m_infoSwitch.m_trackPV || thisJet->m_infoSwitch.m_allTrack ) {
     HelperFunctions::retrieve( vertices, "PrimaryVertices", m_event, 0);
-    pvLocation = HelperFunctions::getPrimaryVertexLocation( vertices );
+    pvLocation = HelperFunctions::getPrimaryVertexLocation( vertices, eventInfo, HelperFunctions::msg() );
     if ( pvLocation >= 0 ) pv = vertices->at( pvLocation );
   }
 
@@ -603,9 +676,6 @@ void HelpTreeBase::FillJets( const xAOD::JetContainer* jets, int pvLocation, con
   // Global event BTag SF weight (--> the product of each object's weight)
   //
   if ( m_isMC ) {
-    const xAOD::EventInfo* eventInfo(nullptr);
-    HelperFunctions::retrieve(eventInfo, "EventInfo", m_event, m_store);
-
     thisJet->FillGlobalBTagSF(eventInfo);
 
   }
@@ -613,6 +683,7 @@ void HelpTreeBase::FillJets( const xAOD::JetContainer* jets, int pvLocation, con
   for( auto jet_itr : *jets ) {
     this->FillJet(jet_itr, pv, pvLocation, jetName);
   }
+  thisJet->FillAuxColumns(jets);
 
 }
 
@@ -726,6 +797,7 @@ void HelpTreeBase::FillTracks( const std::string trackName, const xAOD::TrackPar
 
     this->FillTrack(track_itr, trackName);
   }
+  m_tracks[trackName]->FillAuxColumns(trackParts);
 
 }
 
@@ -797,6 +869,7 @@ void HelpTreeBase::FillFatJets( const xAOD::JetContainer* fatJets , const std::s
     this->FillFatJet(fatjet_itr, fatjetName, suffix);
 
   } // loop over fat jets
+  m_fatjets[FatJetCollectionName(fatjetName, suffix)]->FillAuxColumns(fatJets);
 
 }
 
@@ -885,6 +958,7 @@ void HelpTreeBase::FillTaus( const xAOD::TauJetContainer* taus, const std::strin
   for( auto tau_itr : *taus ) {
     this->FillTau(tau_itr, tauName);
   }
+  m_taus[tauName]->FillAuxColumns(taus);
 }
 
 void HelpTreeBase::FillTau( const xAOD::TauJet* tau, const std::string tauName ) {
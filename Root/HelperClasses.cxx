@@ -121,6 +121,7 @@ namespace HelperClasses{
     m_menuKeys          = has_exact("menuKeys");
     m_passTriggers      = has_exact("passTriggers");
     m_passTrigBits      = has_exact("passTrigBits");
+    m_trigBitset        = has_exact("trigBitset");
   }
 
   void JetTriggerInfoSwitch::initialize(){
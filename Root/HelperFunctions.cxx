@@ -60,6 +60,47 @@ int HelperFunctions::getPrimaryVertexLocation(const xAOD::VertexContainer* verte
   return -1;
 }
 
+namespace {
+  SG::AuxElement::ConstAccessor< int > pvLocationAcc("PVLocation");
+  SG::AuxElement::ConstAccessor< int > npvAcc("NPV");
+
+  // the cached location is only used if it points at the primary vertex of this container,
+  // which there is only one of
+  bool hasCachedPrimaryVertex(const xAOD::VertexContainer* vertexContainer, const xAOD::EventInfo* eventInfo)
+  {
+    if ( !eventInfo || !pvLocationAcc.isAvailable( *eventInfo ) ) { return false; }
+    const int location = pvLocationAcc( *eventInfo );
+    return location >= 0 && static_cast<std::size_t>(location) < vertexContainer->size()
+      && vertexContainer->at(location)->vertexType() == xAOD::VxType::VertexType::PriVtx;
+  }
+}
+
+void HelperFunctions::cachePrimaryVertexInfo(const xAOD::EventInfo* eventInfo, const xAOD::VertexContainer* vertexContainer, MsgStream& msg)
+{
+  static SG::AuxElement::Decorator< int > pvLocationDecor("PVLocation");
+  static SG::AuxElement::Decorator< int > npvDecor("NPV");
+  pvLocationDecor( *eventInfo ) = getPrimaryVertexLocation( vertexContainer, msg );
+  npvDecor( *eventInfo )        = countPrimaryVertices( vertexContainer, 2 );
+}
+
+int HelperFunctions::getPrimaryVertexLocation(const xAOD::VertexContainer* vertexContainer, const xAOD::EventInfo* eventInfo, MsgStream& msg)
+{
+  if ( hasCachedPrimaryVertex( vertexContainer, eventInfo ) ) { return pvLocationAcc( *eventInfo ); }
+  return getPrimaryVertexLocation( vertexContainer, msg );
+}
+
+const xAOD::Vertex* HelperFunctions::getPrimaryVertex(const xAOD::VertexContainer* vertexContainer, const xAOD::EventInfo* eventInfo, MsgStream& msg)
+{
+  if ( hasCachedPrimaryVertex( vertexContainer, eventInfo ) ) { return vertexContainer->at( pvLocationAcc( *eventInfo ) ); }
+  return getPrimaryVertex( vertexContainer, msg );
+}
+
+int HelperFunctions::countPrimaryVertices(const xAOD::VertexContainer* vertexContainer, const xAOD::EventInfo* eventInfo, int Ntracks)
+{
+  if ( Ntracks == 2 && hasCachedPrimaryVertex( vertexContainer, eventInfo ) && npvAcc.isAvailable( *eventInfo ) ) { return npvAcc( *eventInfo ); }
+  return countPrimaryVertices( vertexContainer, Ntracks );
+}
+
 bool HelperFunctions::applyPrimaryVertexSelection( const xAOD::JetContainer* jets, const xAOD::VertexContainer* vertices )
 {
 
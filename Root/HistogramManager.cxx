@@ -11,7 +11,11 @@
  *
  ******************************************/
 
+#include <algorithm>
+
 #include <AsgTools/MsgStream.h>
+#include <TArrayD.h>
+#include <TArrayF.h>
 #include "xAODAnaHelpers/HistogramManager.h"
 
 /* constructors and destructors */
@@ -31,7 +35,224 @@ HistogramManager::HistogramManager(std::string name, std::string detailStr):
   m_msg.setLevel(MSG::INFO);
 }
 
-HistogramManager::~HistogramManager() {}
+HistogramManager::~HistogramManager()
+{
+  // nested sets may be gone already, they flush in their own destructor
+  flushOwnFills();
+  closeOwnLazyBooking();
+  for( auto hist : m_dropped ) { delete hist; }
+}
+
+void HistogramManager::fill(TH1* hist, double x, double w)
+{
+  if( !m_fillBufferSize && !m_fastFill && !m_nUnallocated ) {
+    hist->Fill( x, w );
+    return;
+  }
+  FillBuffer* buffer = fillBuffer( hist, false );
+  if( buffer && buffer->uniform ) {
+    buffer->uniform->fill( x, w );
+    return;
+  }
+  if( !buffer || !m_fillBufferSize ) {
+    hist->Fill( x, w );
+    return;
+  }
+  buffer->x.push_back( x );
+  buffer->w.push_back( w );
+  if( buffer->x.size() >= m_fillBufferSize ) { flush( *buffer ); }
+}
+
+void HistogramManager::fill(TH2* hist, double x, double y, double w)
+{
+  if( !m_fillBufferSize && !m_fastFill && !m_nUnallocated ) {
+    hist->Fill( x, y, w );
+    return;
+  }
+  FillBuffer* buffer = fillBuffer( hist, true );
+  if( buffer && buffer->uniform ) {
+    buffer->uniform->fill( x, y, w );
+    return;
+  }
+  if( !buffer || !m_fillBufferSize ) {
+    hist->Fill( x, y, w );
+    return;
+  }
+  buffer->x.push_back( x );
+  buffer->y.push_back( y );
+  buffer->w.push_back( w );
+  if( buffer->x.size() >= m_fillBufferSize ) { flush( *buffer ); }
+}
+
+void HistogramManager::setFillBuffer(unsigned int size)
+{
+  flushOwnFills();
+  m_fillBufferSize = size;
+  for( auto& buffer : m_fillBuffers ) { buffer.ready = false; }
+  for( auto nested : m_nested ) { nested->setFillBuffer( size ); }
+}
+
+void HistogramManager::setFastFill(bool fast)
+{
+  // the fast counts are made when a histogram is first filled, start over
+  flushOwnFills();
+  m_fastFill = fast;
+  for( auto& buffer : m_fillBuffers ) {
+    buffer.uniform.reset();
+    buffer.ready = false;
+  }
+  for( auto nested : m_nested ) { nested->setFastFill( fast ); }
+}
+
+void HistogramManager::flushFills()
+{
+  flushOwnFills();
+  for( auto nested : m_nested ) { nested->flushFills(); }
+}
+
+void HistogramManager::flushOwnFills()
+{
+  for( auto& buffer : m_fillBuffers ) { flush( buffer ); }
+}
+
+void HistogramManager::setLazyBooking(bool lazy)
+{
+  flushOwnFills();
+  m_lazyBooking = lazy;
+  for( auto& buffer : m_fillBuffers ) {
+    if( lazy ) { release( buffer ); }
+    else       { allocate( buffer ); }
+  }
+  for( auto nested : m_nested ) { nested->setLazyBooking( lazy ); }
+}
+
+void HistogramManager::closeLazyBooking()
+{
+  closeOwnLazyBooking();
+  for( auto nested : m_nested ) { nested->closeLazyBooking(); }
+}
+
+void HistogramManager::closeOwnLazyBooking()
+{
+  for( auto& buffer : m_fillBuffers ) {
+    if( buffer.heldBack ) {
+      // never filled: left out of the output, hadd takes the union of the files
+      if( buffer.unallocated ) { m_dropped.push_back( buffer.hist ); }
+      else                     { m_worker->addOutput( buffer.hist ); }
+      buffer.heldBack = false;
+    }
+    // recorded before their bins were freed, they are written with their booked binning
+    else if( std::find( m_dropped.begin(), m_dropped.end(), buffer.hist ) == m_dropped.end() ) {
+      allocate( buffer );
+    }
+  }
+  m_lazyBooking = false;
+}
+
+void HistogramManager::release(FillBuffer& buffer)
+{
+  TH1* hist = buffer.hist;
+  // profiles keep more than the bins, 3D histograms are filled directly
+  if( buffer.unallocated || hist->GetDimension() > 2 || hist->InheritsFrom( TProfile::Class() ) || hist->GetEntries() != 0 ) { return; }
+  TArray* bins = dynamic_cast<TArray*>( hist );
+  if( !bins ) { return; }
+  buffer.unallocated = true;
+  buffer.sumw2       = hist->GetSumw2N() > 0;
+  buffer.ready       = false;
+  ++m_nUnallocated;
+  bins->Set( 0 );
+  hist->GetSumw2()->Set( 0 );
+}
+
+void HistogramManager::allocate(FillBuffer& buffer)
+{
+  if( !buffer.unallocated ) { return; }
+  TH1* hist = buffer.hist;
+  // TArray::Set zeroes what it adds
+  dynamic_cast<TArray*>( hist )->Set( hist->GetNcells() );
+  if( buffer.sumw2 ) { hist->GetSumw2()->Set( hist->GetNcells() ); }
+  buffer.unallocated = false;
+  --m_nUnallocated;
+}
+
+HistogramManager::MemoryUsage& HistogramManager::MemoryUsage::operator+=(const MemoryUsage& other)
+{
+  histograms += other.histograms;
+  empty      += other.empty;
+  binBytes   += other.binBytes;
+  fillBytes  += other.fillBytes;
+  return *this;
+}
+
+HistogramManager::MemoryUsage HistogramManager::memoryUsage() const
+{
+  MemoryUsage usage;
+  for( auto hist : m_allHists ) {
+    usage.histograms += 1;
+    if( hist->GetEntries() == 0 ) { usage.empty += 1; }
+    usage.binBytes += binBytes( hist );
+  }
+  for( const auto& buffer : m_fillBuffers ) {
+    usage.fillBytes += ( buffer.x.capacity() + buffer.y.capacity() + buffer.w.capacity() ) * sizeof(double);
+    if( buffer.uniform ) { usage.fillBytes += buffer.uniform->bytes(); }
+  }
+  for( auto nested : m_nested ) { usage += nested->memoryUsage(); }
+  return usage;
+}
+
+std::size_t HistogramManager::binBytes(const TH1* hist)
+{
+  std::size_t bytes = hist->GetSumw2N() * sizeof(Double_t);
+  if( auto bins = dynamic_cast<const TArrayF*>( hist ) )      { bytes += bins->GetSize() * sizeof(Float_t); }
+  else if( auto bins = dynamic_cast<const TArrayD*>( hist ) ) { bytes += bins->GetSize() * sizeof(Double_t); }
+  // entries per bin
+  if( hist->InheritsFrom( TProfile::Class() ) ) { bytes += hist->GetNcells() * sizeof(Double_t); }
+  return bytes;
+}
+
+HistogramManager::FillBuffer* HistogramManager::fillBuffer(TH1* hist, bool is2D)
+{
+  // record() numbers the histograms in booking order, no lookup on the fill path
+  const UInt_t slot = hist->GetUniqueID();
+  FillBuffer* buffer = nullptr;
+  if( slot > 0 && slot <= m_fillBuffers.size() && m_fillBuffers[slot-1].hist == hist ) {
+    buffer = &m_fillBuffers[slot-1];
+  }
+  else {
+    // the unique ID was changed since booking
+    auto found = std::find( m_allHists.begin(), m_allHists.end(), hist );
+    if( found == m_allHists.end() ) { return nullptr; }
+    buffer = &m_fillBuffers[found - m_allHists.begin()];
+  }
+  if( !buffer->ready ) { prepare( *buffer, is2D ); }
+  return buffer;
+}
+
+void HistogramManager::prepare(FillBuffer& buffer, bool is2D)
+{
+  allocate( buffer );
+  buffer.is2D = is2D;
+  if( m_fastFill && xAH::UniformHist::supports( buffer.hist ) && ( buffer.hist->GetDimension() == 2 ) == is2D ) {
+    buffer.uniform.reset( new xAH::UniformHist( buffer.hist ) );
+  }
+  else {
+    buffer.x.reserve( m_fillBufferSize );
+    buffer.y.reserve( is2D ? m_fillBufferSize : 0 );
+    buffer.w.reserve( m_fillBufferSize );
+  }
+  buffer.ready = true;
+}
+
+void HistogramManager::flush(FillBuffer& buffer)
+{
+  if( buffer.uniform ) { buffer.uniform->flush(); }
+  if( buffer.x.empty() ) { return; }
+  if( buffer.is2D ) { buffer.hist->FillN( buffer.x.size(), buffer.x.data(), buffer.y.data(), buffer.w.data() ); }
+  else              { buffer.hist->FillN( buffer.x.size(), buffer.x.data(), buffer.w.data() ); }
+  buffer.x.clear();
+  buffer.y.clear();
+  buffer.w.clear();
+}
 
 /* Main book() functions for 1D, 2D, 3D histograms */
 TH1F* HistogramManager::book(std::string name, std::string title,
@@ -150,11 +371,19 @@ void HistogramManager::Sumw2(TH1* hist, bool flag /*=true*/) {
 
 void HistogramManager::record(TH1* hist) {
   m_allHists.push_back( hist );
+  m_fillBuffers.push_back( FillBuffer{hist} );
+  hist->SetUniqueID( m_allHists.size() );
 }
 
 void HistogramManager::record(EL::Worker* wk) {
-  for( auto hist : m_allHists ){
-    wk->addOutput(hist);
+  m_worker = wk;
+  for( auto& buffer : m_fillBuffers ){
+    // only handed over in closeLazyBooking(), if they were filled
+    if( buffer.unallocated ) {
+      buffer.heldBack = true;
+      continue;
+    }
+    wk->addOutput(buffer.hist);
   }
 }
 
@@ -91,6 +91,14 @@ StatusCode IParticleHists::initialize() {
   return StatusCode::SUCCESS;
 }
 
+void IParticleHists::auxIDs( std::set< SG::auxid_t >& auxids ) const {
+  // the four-momentum, for every detail
+  SG::AuxTypeRegistry& registry = SG::AuxTypeRegistry::instance();
+  for( const char* name : { "pt", "eta", "phi", "m" } ) {
+    auxids.insert( registry.getAuxID<float>( name ) );
+  }
+}
+
 StatusCode IParticleHists::execute( const xAOD::IParticleContainer* particles, float eventWeight, const xAOD::EventInfo* eventInfo) {
   using namespace msgIParticleHists;
   for( auto particle_itr : *particles ) {
@@ -100,21 +108,21 @@ StatusCode IParticleHists::execute( const xAOD::IParticleContainer* particles, f
   if( m_infoSwitch->m_numLeading > 0){
     int numParticles = std::min( m_infoSwitch->m_numLeading, (int)particles->size() );
     for(int iParticle=0; iParticle < numParticles; ++iParticle){
-      m_NPt_l.at(iParticle)->        Fill( particles->at(iParticle)->pt()/1e3,   eventWeight);
-      m_NPt.at(iParticle)->        Fill( particles->at(iParticle)->pt()/1e3,   eventWeight);
-      m_NPt_m.at(iParticle)->        Fill( particles->at(iParticle)->pt()/1e3,   eventWeight);
-      m_NPt_s.at(iParticle)->        Fill( particles->at(iParticle)->pt()/1e3,   eventWeight);
-      m_NEta.at(iParticle)->       Fill( particles->at(iParticle)->eta(),      eventWeight);
-      m_NPhi.at(iParticle)->       Fill( particles->at(iParticle)->phi(),      eventWeight);
-      m_NM.at(iParticle)->         Fill( particles->at(iParticle)->m()/1e3,    eventWeight);
-      m_NE.at(iParticle)->         Fill( particles->at(iParticle)->e()/1e3,    eventWeight);
-      m_NRapidity.at(iParticle)->  Fill( particles->at(iParticle)->rapidity(), eventWeight);
+      fill( m_NPt_l.at(iParticle),        particles->at(iParticle)->pt()/1e3,   eventWeight );
+      fill( m_NPt.at(iParticle),        particles->at(iParticle)->pt()/1e3,   eventWeight );
+      fill( m_NPt_m.at(iParticle),        particles->at(iParticle)->pt()/1e3,   eventWeight );
+      fill( m_NPt_s.at(iParticle),        particles->at(iParticle)->pt()/1e3,   eventWeight );
+      fill( m_NEta.at(iParticle),       particles->at(iParticle)->eta(),      eventWeight );
+      fill( m_NPhi.at(iParticle),       particles->at(iParticle)->phi(),      eventWeight );
+      fill( m_NM.at(iParticle),         particles->at(iParticle)->m()/1e3,    eventWeight );
+      fill( m_NE.at(iParticle),         particles->at(iParticle)->e()/1e3,    eventWeight );
+      fill( m_NRapidity.at(iParticle),  particles->at(iParticle)->rapidity(), eventWeight );
 
       if(m_infoSwitch->m_kinematic){
 	float et = particles->at(iParticle)->e()/cosh(particles->at(iParticle)->eta())/1e3;
-	m_NEt  .at(iParticle)->        Fill( et,   eventWeight);
-	m_NEt_m.at(iParticle)->        Fill( et,   eventWeight);
-	m_NEt_s.at(iParticle)->        Fill( et,   eventWeight);
+	fill( m_NEt.at(iParticle),          et,   eventWeight );
+	fill( m_NEt_m.at(iParticle),        et,   eventWeight );
+	fill( m_NEt_s.at(iParticle),        et,   eventWeight );
       }
 
     }
@@ -128,28 +136,28 @@ StatusCode IParticleHists::execute( const xAOD::IParticle* particle, float event
   if(m_debug) std::cout << "IParticleHists: in execute " <<std::endl;
 
   //basic
-  m_Pt_l ->      Fill( particle->pt()/1e3,    eventWeight );
-  m_Pt ->        Fill( particle->pt()/1e3,    eventWeight );
-  m_Pt_m ->      Fill( particle->pt()/1e3,    eventWeight );
-  m_Pt_s ->      Fill( particle->pt()/1e3,    eventWeight );
-  m_Eta->        Fill( particle->eta(),       eventWeight );
-  m_Phi->        Fill( particle->phi(),       eventWeight );
-  m_M->          Fill( particle->m()/1e3,     eventWeight );
-  m_E->          Fill( particle->e()/1e3,     eventWeight );
-  m_Rapidity->   Fill( particle->rapidity(),  eventWeight );
+  fill( m_Pt_l,     particle->pt()/1e3,        eventWeight );
+  fill( m_Pt,       particle->pt()/1e3,        eventWeight );
+  fill( m_Pt_m,     particle->pt()/1e3,        eventWeight );
+  fill( m_Pt_s,     particle->pt()/1e3,        eventWeight );
+  fill( m_Eta,      particle->eta(),           eventWeight );
+  fill( m_Phi,      particle->phi(),           eventWeight );
+  fill( m_M,        particle->m()/1e3,         eventWeight );
+  fill( m_E,        particle->e()/1e3,         eventWeight );
+  fill( m_Rapidity, particle->rapidity(),      eventWeight );
 
   // kinematic
   if( m_infoSwitch->m_kinematic ) {
 
 
-    m_Px->  Fill( particle->p4().Px()/1e3,  eventWeight );
-    m_Py->  Fill( particle->p4().Py()/1e3,  eventWeight );
-    m_Pz->  Fill( particle->p4().Pz()/1e3,  eventWeight );
+    fill( m_Px,       particle->p4().Px()/1e3,   eventWeight );
+    fill( m_Py,       particle->p4().Py()/1e3,   eventWeight );
+    fill( m_Pz,       particle->p4().Pz()/1e3,   eventWeight );
 
 
-    m_Et ->        Fill( particle->p4().Et()/1e3,    eventWeight );
-    m_Et_m ->      Fill( particle->p4().Et()/1e3,    eventWeight );
-    m_Et_s ->      Fill( particle->p4().Et()/1e3,    eventWeight );
+    fill( m_Et,       particle->p4().Et()/1e3,   eventWeight );
+    fill( m_Et_m,     particle->p4().Et()/1e3,   eventWeight );
+    fill( m_Et_s,     particle->p4().Et()/1e3,   eventWeight );
   } // fillKinematic
 
   return StatusCode::SUCCESS;
@@ -165,25 +173,25 @@ StatusCode IParticleHists::execute( const xAH::Particle* particle, float eventWe
   const TLorentzVector& partP4 = particle->p4;
 
   //basic
-  m_Pt_l ->      Fill( partP4.Pt(),    eventWeight );
-  m_Pt ->        Fill( partP4.Pt(),    eventWeight );
-  m_Pt_m ->      Fill( partP4.Pt(),    eventWeight );
-  m_Pt_s ->      Fill( partP4.Pt(),    eventWeight );
-  m_Eta->        Fill( partP4.Eta(),       eventWeight );
-  m_Phi->        Fill( partP4.Phi(),       eventWeight );
-  m_M->          Fill( partP4.M(),     eventWeight );
-  m_E->          Fill( partP4.E(),     eventWeight );
-  m_Rapidity->   Fill( partP4.Rapidity(),  eventWeight );
+  fill( m_Pt_l,       partP4.Pt(),    eventWeight );
+  fill( m_Pt,         partP4.Pt(),    eventWeight );
+  fill( m_Pt_m,       partP4.Pt(),    eventWeight );
+  fill( m_Pt_s,       partP4.Pt(),    eventWeight );
+  fill( m_Eta,        partP4.Eta(),       eventWeight );
+  fill( m_Phi,        partP4.Phi(),       eventWeight );
+  fill( m_M,          partP4.M(),     eventWeight );
+  fill( m_E,          partP4.E(),     eventWeight );
+  fill( m_Rapidity,   partP4.Rapidity(),  eventWeight );
 
   // kinematic
   if( m_infoSwitch->m_kinematic ) {
-    m_Px->  Fill( partP4.Px(),  eventWeight );
-    m_Py->  Fill( partP4.Py(),  eventWeight );
-    m_Pz->  Fill( partP4.Pz(),  eventWeight );
+    fill( m_Px,  partP4.Px(),  eventWeight );
+    fill( m_Py,  partP4.Py(),  eventWeight );
+    fill( m_Pz,  partP4.Pz(),  eventWeight );
 
-    m_Et ->        Fill( partP4.Et(),    eventWeight );
-    m_Et_m ->      Fill( partP4.Et(),    eventWeight );
-    m_Et_s ->      Fill( partP4.Et(),    eventWeight );
+    fill( m_Et,         partP4.Et(),    eventWeight );
+    fill( m_Et_m,       partP4.Et(),    eventWeight );
+    fill( m_Et_s,       partP4.Et(),    eventWeight );
   } // fillKinematic
 
   return StatusCode::SUCCESS;
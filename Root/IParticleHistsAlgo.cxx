@@ -2,8 +2,11 @@
 #include <EventLoop/StatusCode.h>
 #include <EventLoop/Worker.h>
 
+#include <set>
+
 #include <xAODBase/IParticleContainer.h>
 #include <xAODEventInfo/EventInfo.h>
+#include <AthContainers/AuxVectorData.h>
 #include <AthContainers/ConstDataVector.h>
 
 #include <xAODAnaHelpers/IParticleHistsAlgo.h>
@@ -40,12 +43,53 @@ EL::StatusCode IParticleHistsAlgo::AddHists( std::string name ) {
   IParticleHists* particleHists = new IParticleHists( fullname, m_detailStr, m_histPrefix, m_histTitle ); // add systematic
   particleHists->m_debug = msgLvl(MSG::DEBUG);
   ANA_CHECK( particleHists->initialize());
+  configureHists( particleHists );
   particleHists->record( wk() );
-  m_plots[name] = particleHists;
+  setPlots( name, particleHists );
 
   return EL::StatusCode::SUCCESS;
 }
 
+void IParticleHistsAlgo::configureHists( IParticleHists* plots ) const {
+  if( m_fillBufferSize > 0 ) { plots->setFillBuffer( m_fillBufferSize ); }
+  if( m_fastFill ) { plots->setFastFill( true ); }
+  if( m_lazyBooking ) { plots->setLazyBooking( true ); }
+}
+
+void IParticleHistsAlgo::setPlots( const std::string& systName, IParticleHists* plots ) {
+  unsigned int systID = xAH::SystematicRegistry::instance().id( systName );
+  if( systID >= m_plots.size() ) m_plots.resize( systID+1, nullptr );
+  m_plots[systID] = plots;
+  // the sets are booked serially, before the threads fill them
+  if( m_systTaskPool ) { plots->auxIDs( m_auxIDs ); }
+}
+
+IParticleHists* IParticleHistsAlgo::getPlots( unsigned int systID ) {
+  if( systID >= m_plots.size() || !m_plots[systID] ) {
+    this->AddHists( xAH::SystematicRegistry::instance().name( systID ) );
+  }
+  return m_plots[systID];
+}
+
+void IParticleHistsAlgo::loadAuxData( const std::vector< const xAOD::IParticleContainer* >& containers, const xAOD::EventInfo* eventInfo ) const {
+  // the containers the particles live in: the shallow copies, or the input itself for view containers
+  std::set< const SG::AuxVectorData* > auxData;
+  auxData.insert( eventInfo->container() );
+  for( auto particles : containers ) {
+    for( auto particle : *particles ) {
+      auxData.insert( particle->container() );
+      // some xAOD types cache their four-momentum on first use
+      particle->p4();
+    }
+  }
+  for( auto data : auxData ) {
+    if( !data ) continue;
+    for( SG::auxid_t auxid : m_auxIDs ) {
+      if( data->isAvailable( auxid ) ) { data->getDataArray( auxid ); }
+    }
+  }
+}
+
 EL::StatusCode IParticleHistsAlgo :: fileExecute () { return EL::StatusCode::SUCCESS; }
 EL::StatusCode IParticleHistsAlgo :: changeInput (bool /*firstFile*/) { return EL::StatusCode::SUCCESS; }
 
@@ -60,8 +104,18 @@ EL::StatusCode IParticleHistsAlgo :: initialize ()
   }
 
 
+  m_inContainerKeys.setPrefix( m_inContainerName );
+
   // only running 1 collection
   if(m_inputAlgo.empty()) { AddHists( "" ); }
+  else if(m_nSystThreads > 1) {
+    if( !concurrentFillSafe() ) {
+      ANA_MSG_ERROR( "The histograms of m_detailStr \"" << m_detailStr << "\" follow links into other containers, they cannot be filled with m_nSystThreads > 1" );
+      return EL::StatusCode::FAILURE;
+    }
+    ANA_MSG_INFO( "Filling systematics on " << m_nSystThreads << " threads" );
+    m_systTaskPool = new xAH::TaskPool( m_nSystThreads );
+  }
   m_event = wk()->xaodEvent();
   m_store = wk()->xaodStore();
   return EL::StatusCode::SUCCESS;
@@ -76,12 +130,23 @@ EL::StatusCode IParticleHistsAlgo :: postExecute () { return EL::StatusCode::SUC
 
 EL::StatusCode IParticleHistsAlgo :: finalize () {
   ANA_MSG_DEBUG( m_name );
+  delete m_systTaskPool;
+  m_systTaskPool = nullptr;
+  HistogramManager::MemoryUsage usage;
+  unsigned int nSets = 0;
   for( auto plots : m_plots ) {
-    if(plots.second){
-      plots.second->finalize();
-      delete plots.second;
+    if(plots){
+      plots->flushFills();
+      usage += plots->memoryUsage();
+      nSets += 1;
+      plots->closeLazyBooking();
+      plots->finalize();
+      delete plots;
     }
   }
+  m_plots.clear();
+  ANA_MSG_INFO( nSets << " sets of histograms, " << usage.histograms << " histograms of which " << usage.empty << " never filled, "
+                << usage.binBytes/1048576. << " MB of bins and " << usage.fillBytes/1048576. << " MB of fill buffers" );
   return EL::StatusCode::SUCCESS;
 }
 
@@ -373,6 +373,79 @@ JetContainer::JetContainer(const std::string& name, const std::string& detailStr
     m_charge   =new std::vector<double>();
   }
 
+  //
+  // aux variables copied as they are, for every jet in FillParticle
+  //
+  if(m_infoSwitch.m_clean) {
+    m_auxColumns.add<float, float>("Timing", m_Timing, -999);
+    m_auxColumns.add<float, float>("LArQuality", m_LArQuality, -999);
+    m_auxColumns.add<float, float>("HECQuality", m_HECQuality, -999);
+    m_auxColumns.add<float, float>("NegativeE", m_NegativeE, -999, m_units);
+    m_auxColumns.add<float, float>("AverageLArQF", m_AverageLArQF, -999);
+    m_auxColumns.add<float, float>("BchCorrCell", m_BchCorrCell, -999);
+    m_auxColumns.add<float, float>("N90Constituents", m_N90Constituents, -999);
+    m_auxColumns.add<float, float>("LArBadHVEnergyFrac", m_LArBadHVEnergyFrac, -999);
+    m_auxColumns.add<int, int>("LArBadHVNCell", m_LArBadHVNCell, -999);
+    m_auxColumns.add<float, float>("OotFracClusters5", m_OotFracClusters5, -999);
+    m_auxColumns.add<float, float>("OotFracClusters10", m_OotFracClusters10, -999);
+    m_auxColumns.add<float, float>("LeadingClusterPt", m_LeadingClusterPt, -999);
+    m_auxColumns.add<float, float>("LeadingClusterSecondLambda", m_LeadingClusterSecondLambda, -999);
+    m_auxColumns.add<float, float>("LeadingClusterCenterLambda", m_LeadingClusterCenterLambda, -999);
+    m_auxColumns.add<float, float>("LeadingClusterSecondR", m_LeadingClusterSecondR, -999);
+    m_auxColumns.add<char, int>("clean_passLooseBad", m_clean_passLooseBad, -999);
+    m_auxColumns.add<char, int>("clean_passLooseBadUgly", m_clean_passLooseBadUgly, -999);
+    m_auxColumns.add<char, int>("clean_passTightBad", m_clean_passTightBad, -999);
+    m_auxColumns.add<char, int>("clean_passTightBadUgly", m_clean_passTightBadUgly, -999);
+  }
+
+  if ( m_infoSwitch.m_energy ) {
+    m_auxColumns.add<float, float>("HECFrac", m_HECFrac, -999);
+    m_auxColumns.add<float, float>("EMFrac", m_EMFrac, -999);
+    m_auxColumns.add<float, float>("CentroidR", m_CentroidR, -999);
+    m_auxColumns.add<float, float>("FracSamplingMax", m_FracSamplingMax, -999);
+    m_auxColumns.add<int, float>("FracSamplingMaxIndex", m_FracSamplingMaxIndex, -999);
+    m_auxColumns.add<float, float>("LowEtConstituentsFrac", m_LowEtConstituentsFrac, -999);
+    m_auxColumns.add<int, float>("GhostMuonSegmentCount", m_GhostMuonSegmentCount, -999);
+    m_auxColumns.add<float, float>("Width", m_Width, -999);
+  }
+
+  if ( m_infoSwitch.m_area ) {
+    m_auxColumns.add<float, float>("JetGhostArea", m_GhostArea, -999);
+    m_auxColumns.add<float, float>("ActiveArea", m_ActiveArea, -999);
+    m_auxColumns.add<float, float>("VoronoiArea", m_VoronoiArea, -999);
+    m_auxColumns.add<float, float>("ActiveArea4vec_pt", m_ActiveArea4vec_pt, -999);
+    m_auxColumns.add<float, float>("ActiveArea4vec_eta", m_ActiveArea4vec_eta, -999);
+    m_auxColumns.add<float, float>("ActiveArea4vec_phi", m_ActiveArea4vec_phi, -999);
+    m_auxColumns.add<float, float>("ActiveArea4vec_m", m_ActiveArea4vec_m, -999);
+  }
+
+  if ( m_infoSwitch.m_truth && m_mc ) {
+    m_auxColumns.add<int, int>("ConeTruthLabelID", m_ConeTruthLabelID, -999);
+    m_auxColumns.add<int, int>("TruthCount", m_TruthCount, -999);
+    m_auxColumns.add<float, float>("TruthLabelDeltaR_B", m_TruthLabelDeltaR_B, -999);
+    m_auxColumns.add<float, float>("TruthLabelDeltaR_C", m_TruthLabelDeltaR_C, -999);
+    m_auxColumns.add<float, float>("TruthLabelDeltaR_T", m_TruthLabelDeltaR_T, -999);
+    m_auxColumns.add<int, int>("PartonTruthLabelID", m_PartonTruthLabelID, -999);
+    m_auxColumns.add<float, float>("GhostTruthAssociationFraction", m_GhostTruthAssociationFraction, -999);
+  }
+
+  if ( m_infoSwitch.m_truthDetails ) {
+    m_auxColumns.add<int, int>("GhostBHadronsFinalCount", m_GhostBHadronsFinalCount, -999);
+    m_auxColumns.add<int, int>("GhostBHadronsInitialCount", m_GhostBHadronsInitialCount, -999);
+    m_auxColumns.add<int, int>("GhostBQuarksFinalCount", m_GhostBQuarksFinalCount, -999);
+    m_auxColumns.add<float, float>("GhostBHadronsFinalPt", m_GhostBHadronsFinalPt, -999);
+    m_auxColumns.add<float, float>("GhostBHadronsInitialPt", m_GhostBHadronsInitialPt, -999);
+    m_auxColumns.add<float, float>("GhostBQuarksFinalPt", m_GhostBQuarksFinalPt, -999);
+    m_auxColumns.add<int, int>("GhostCHadronsFinalCount", m_GhostCHadronsFinalCount, -999);
+    m_auxColumns.add<int, int>("GhostCHadronsInitialCount", m_GhostCHadronsInitialCount, -999);
+    m_auxColumns.add<int, int>("GhostCQuarksFinalCount", m_GhostCQuarksFinalCount, -999);
+    m_auxColumns.add<float, float>("GhostCHadronsFinalPt", m_GhostCHadronsFinalPt, -999);
+    m_auxColumns.add<float, float>("GhostCHadronsInitialPt", m_GhostCHadronsInitialPt, -999);
+    m_auxColumns.add<float, float>("GhostCQuarksFinalPt", m_GhostCQuarksFinalPt, -999);
+    m_auxColumns.add<int, int>("GhostTausFinalCount", m_GhostTausFinalCount, -999);
+    m_auxColumns.add<float, float>("GhostTausFinalPt", m_GhostTausFinalPt, -999);
+  }
+
 }
 
 JetContainer::~JetContainer()
@@ -1896,13 +1969,13 @@ void JetContainer::clear()
       m_IP2D_cu        ->clear();
       m_nIP2DTracks    ->clear();
 
-      m_IP2D_gradeOfTracks              ->clear();
-      m_IP2D_flagFromV0ofTracks         ->clear();
-      m_IP2D_valD0wrtPVofTracks         ->clear();
-      m_IP2D_sigD0wrtPVofTracks         ->clear();
-      m_IP2D_weightBofTracks            ->clear();
-      m_IP2D_weightCofTracks            ->clear();
-      m_IP2D_weightUofTracks            ->clear();
+      clearColumn( m_IP2D_gradeOfTracks );
+      clearColumn( m_IP2D_flagFromV0ofTracks );
+      clearColumn( m_IP2D_valD0wrtPVofTracks );
+      clearColumn( m_IP2D_sigD0wrtPVofTracks );
+      clearColumn( m_IP2D_weightBofTracks );
+      clearColumn( m_IP2D_weightCofTracks );
+      clearColumn( m_IP2D_weightUofTracks );
 
       m_IP3D         ->clear();
       m_IP3D_pu      ->clear();
@@ -1912,15 +1985,15 @@ void JetContainer::clear()
       m_IP3D_c       ->clear();
       m_IP3D_cu      ->clear();
       m_nIP3DTracks  ->clear();
-      m_IP3D_gradeOfTracks        ->clear();
-      m_IP3D_flagFromV0ofTracks   ->clear();
-      m_IP3D_valD0wrtPVofTracks   ->clear();
-      m_IP3D_sigD0wrtPVofTracks   ->clear();
-      m_IP3D_valZ0wrtPVofTracks   ->clear();
-      m_IP3D_sigZ0wrtPVofTracks   ->clear();
-      m_IP3D_weightBofTracks      ->clear();
-      m_IP3D_weightCofTracks      ->clear();
-      m_IP3D_weightUofTracks      ->clear();
+      clearColumn( m_IP3D_gradeOfTracks );
+      clearColumn( m_IP3D_flagFromV0ofTracks );
+      clearColumn( m_IP3D_valD0wrtPVofTracks );
+      clearColumn( m_IP3D_sigD0wrtPVofTracks );
+      clearColumn( m_IP3D_valZ0wrtPVofTracks );
+      clearColumn( m_IP3D_sigZ0wrtPVofTracks );
+      clearColumn( m_IP3D_weightBofTracks );
+      clearColumn( m_IP3D_weightCofTracks );
+      clearColumn( m_IP3D_weightUofTracks );
     }
 
     if( m_infoSwitch.m_JVC ){
@@ -2055,95 +2128,6 @@ void JetContainer::FillJet( const xAOD::IParticle* particle, const xAOD::Vertex*
     m_rapidity->push_back( jet->rapidity() );
   }
 
-  if (m_infoSwitch.m_clean) {
-    static SG::AuxElement::ConstAccessor<float> jetTime ("Timing");
-    safeFill<float, float, xAOD::Jet>(jet, jetTime, m_Timing, -999);
-
-    static SG::AuxElement::ConstAccessor<float> LArQuality ("LArQuality");
-    safeFill<float, float, xAOD::Jet>(jet, LArQuality, m_LArQuality, -999);
-
-    static SG::AuxElement::ConstAccessor<float> hecq ("HECQuality");
-    safeFill<float, float, xAOD::Jet>(jet, hecq, m_HECQuality, -999);
-
-    static SG::AuxElement::ConstAccessor<float> negE ("NegativeE");
-    safeFill<float, float, xAOD::Jet>(jet, negE, m_NegativeE, -999, m_units);
-
-    static SG::AuxElement::ConstAccessor<float> avLArQF ("AverageLArQF");
-    safeFill<float, float, xAOD::Jet>(jet, avLArQF, m_AverageLArQF, -999);
-
-    static SG::AuxElement::ConstAccessor<float> bchCorrCell ("BchCorrCell");
-    safeFill<float, float, xAOD::Jet>(jet, bchCorrCell, m_BchCorrCell, -999);
-
-    static SG::AuxElement::ConstAccessor<float> N90Const ("N90Constituents");
-    safeFill<float, float, xAOD::Jet>(jet, N90Const, m_N90Constituents, -999);
-
-    static SG::AuxElement::ConstAccessor<float> LArBadHVEFrac ("LArBadHVEnergyFrac");
-    safeFill<float, float, xAOD::Jet>(jet, LArBadHVEFrac, m_LArBadHVEnergyFrac, -999);
-
-    static SG::AuxElement::ConstAccessor<int> LArBadHVNCell ("LArBadHVNCell");
-    safeFill<int, int, xAOD::Jet>(jet, LArBadHVNCell, m_LArBadHVNCell, -999);
-
-    static SG::AuxElement::ConstAccessor<float> OotFracClus5 ("OotFracClusters5");
-    safeFill<float, float, xAOD::Jet>(jet, OotFracClus5, m_OotFracClusters5, -999);
-
-    static SG::AuxElement::ConstAccessor<float> OotFracClus10 ("OotFracClusters10");
-    safeFill<float, float, xAOD::Jet>(jet, OotFracClus10, m_OotFracClusters10, -999);
-
-    static SG::AuxElement::ConstAccessor<float> leadClusPt ("LeadingClusterPt");
-    safeFill<float, float, xAOD::Jet>(jet, leadClusPt, m_LeadingClusterPt, -999);
-
-    static SG::AuxElement::ConstAccessor<float> leadClusSecondLambda ("LeadingClusterSecondLambda");
-    safeFill<float, float, xAOD::Jet>(jet, leadClusSecondLambda, m_LeadingClusterSecondLambda, -999);
-
-    static SG::AuxElement::ConstAccessor<float> leadClusCenterLambda ("LeadingClusterCenterLambda");
-    safeFill<float, float, xAOD::Jet>(jet, leadClusCenterLambda, m_LeadingClusterCenterLambda, -999);
-
-    static SG::AuxElement::ConstAccessor<float> leadClusSecondR ("LeadingClusterSecondR");
-    safeFill<float, float, xAOD::Jet>(jet, leadClusSecondR, m_LeadingClusterSecondR, -999);
-
-    static SG::AuxElement::ConstAccessor<char> clean_passLooseBad ("clean_passLooseBad");
-    safeFill<char, int, xAOD::Jet>(jet, clean_passLooseBad, m_clean_passLooseBad, -999);
-
-    static SG::AuxElement::ConstAccessor<char> clean_passLooseBadUgly ("clean_passLooseBadUgly");
-    safeFill<char, int, xAOD::Jet>(jet, clean_passLooseBadUgly, m_clean_passLooseBadUgly, -999);
-
-    static SG::AuxElement::ConstAccessor<char> clean_passTightBad ("clean_passTightBad");
-    safeFill<char, int, xAOD::Jet>(jet, clean_passTightBad, m_clean_passTightBad, -999);
-
-    static SG::AuxElement::ConstAccessor<char> clean_passTightBadUgly ("clean_passTightBadUgly");
-    safeFill<char, int, xAOD::Jet>(jet, clean_passTightBadUgly, m_clean_passTightBadUgly, -999);
-
-  } // clean
-
-
-  if ( m_infoSwitch.m_energy ) {
-    static SG::AuxElement::ConstAccessor<float> HECf ("HECFrac");
-    safeFill<float, float, xAOD::Jet>(jet, HECf, m_HECFrac, -999);
-
-    static SG::AuxElement::ConstAccessor<float> EMf ("EMFrac");
-    safeFill<float, float, xAOD::Jet>(jet, EMf, m_EMFrac, -999);
-
-    static SG::AuxElement::ConstAccessor<float> centroidR ("CentroidR");
-    safeFill<float, float, xAOD::Jet>(jet, centroidR, m_CentroidR, -999);
-
-    static SG::AuxElement::ConstAccessor<float> fracSampMax ("FracSamplingMax");
-    safeFill<float, float, xAOD::Jet>(jet, fracSampMax, m_FracSamplingMax, -999);
-
-    static SG::AuxElement::ConstAccessor<int> fracSampMaxIdx ("FracSamplingMaxIndex");
-    safeFill<int, float, xAOD::Jet>(jet, fracSampMaxIdx, m_FracSamplingMaxIndex, -999);
-
-    static SG::AuxElement::ConstAccessor<float> lowEtFrac ("LowEtConstituentsFrac");
-    safeFill<float, float, xAOD::Jet>(jet, lowEtFrac, m_LowEtConstituentsFrac, -999);
-
-    static SG::AuxElement::ConstAccessor<int> muonSegCount ("GhostMuonSegmentCount");
-    safeFill<int, float, xAOD::Jet>(jet, muonSegCount, m_GhostMuonSegmentCount, -999);
-
-    static SG::AuxElement::ConstAccessor<float> width ("Width");
-    safeFill<float, float, xAOD::Jet>(jet, width, m_Width, -999);
-
-  } // energy
-
-
   // each step of the calibration sequence
   if ( m_infoSwitch.m_scales ) {
     xAOD::JetFourMom_t fourVec;
@@ -2879,60 +2863,14 @@ void JetContainer::FillJet( const xAOD::IParticle* particle, const xAOD::Vertex*
   } // sfFTagHyb
 
 
-  if ( m_infoSwitch.m_area ) {
-
-    static SG::AuxElement::ConstAccessor<float> ghostArea("JetGhostArea");
-    safeFill<float, float, xAOD::Jet>(jet, ghostArea, m_GhostArea, -999);
-
-    static SG::AuxElement::ConstAccessor<float> activeArea("ActiveArea");
-    safeFill<float, float, xAOD::Jet>(jet, activeArea, m_ActiveArea, -999);
-
-    static SG::AuxElement::ConstAccessor<float> voronoiArea("VoronoiArea");
-    safeFill<float, float, xAOD::Jet>(jet, voronoiArea, m_VoronoiArea, -999);
-
-    static SG::AuxElement::ConstAccessor<float> activeArea_pt("ActiveArea4vec_pt");
-    safeFill<float, float, xAOD::Jet>(jet, activeArea_pt, m_ActiveArea4vec_pt, -999);
-
-    static SG::AuxElement::ConstAccessor<float> activeArea_eta("ActiveArea4vec_eta");
-    safeFill<float, float, xAOD::Jet>(jet, activeArea_eta, m_ActiveArea4vec_eta, -999);
-
-    static SG::AuxElement::ConstAccessor<float> activeArea_phi("ActiveArea4vec_phi");
-    safeFill<float, float, xAOD::Jet>(jet, activeArea_phi, m_ActiveArea4vec_phi, -999);
-
-    static SG::AuxElement::ConstAccessor<float> activeArea_m("ActiveArea4vec_m");
-    safeFill<float, float, xAOD::Jet>(jet, activeArea_m, m_ActiveArea4vec_m, -999);
-  }
-
-
   if ( m_infoSwitch.m_truth && m_mc ) {
 
-    static SG::AuxElement::ConstAccessor<int> ConeTruthLabelID ("ConeTruthLabelID");
-    safeFill<int, int, xAOD::Jet>(jet, ConeTruthLabelID, m_ConeTruthLabelID, -999);
-
-    static SG::AuxElement::ConstAccessor<int> TruthCount ("TruthCount");
-    safeFill<int, int, xAOD::Jet>(jet, TruthCount, m_TruthCount, -999);
-
     //    seems to be empty
     //      static SG::AuxElement::ConstAccessor<float> TruthPt ("TruthPt");
     //      if ( TruthPt.isAvailable( *jet) ) {
     //        m_truthPt->push_back( TruthPt( *jet)/1000 );
     //      } else { m_truthPt->push_back( -999 ); }
 
-    static SG::AuxElement::ConstAccessor<float> TruthLabelDeltaR_B ("TruthLabelDeltaR_B");
-    safeFill<float, float, xAOD::Jet>(jet, TruthLabelDeltaR_B, m_TruthLabelDeltaR_B, -999);
-
-    static SG::AuxElement::ConstAccessor<float> TruthLabelDeltaR_C ("TruthLabelDeltaR_C");
-    safeFill<float, float, xAOD::Jet>(jet, TruthLabelDeltaR_C, m_TruthLabelDeltaR_C, -999);
-
-    static SG::AuxElement::ConstAccessor<float> TruthLabelDeltaR_T ("TruthLabelDeltaR_T");
-    safeFill<float, float, xAOD::Jet>(jet, TruthLabelDeltaR_T, m_TruthLabelDeltaR_T, -999);
-
-    static SG::AuxElement::ConstAccessor<int> partonLabel("PartonTruthLabelID");
-    safeFill<int, int, xAOD::Jet>(jet, partonLabel, m_PartonTruthLabelID, -999);
-
-    static SG::AuxElement::ConstAccessor<float> ghostTruthAssFrac("GhostTruthAssociationFraction");
-    safeFill<float, float, xAOD::Jet>(jet, ghostTruthAssFrac, m_GhostTruthAssociationFraction, -999);
-
     const xAOD::Jet* truthJet = HelperFunctions::getLink<xAOD::Jet>( jet, "GhostTruthAssociationLink" );
     if(truthJet) {
       m_truth_pt->push_back ( truthJet->pt() / m_units );
@@ -2950,58 +2888,6 @@ void JetContainer::FillJet( const xAOD::IParticle* particle, const xAOD::Vertex*
 
   if ( m_infoSwitch.m_truthDetails ) {
 
-    //
-    // B-Hadron Details
-    //
-    static SG::AuxElement::ConstAccessor<int> GhostBHadronsFinalCount ("GhostBHadronsFinalCount");
-    safeFill<int, int, xAOD::Jet>(jet, GhostBHadronsFinalCount, m_GhostBHadronsFinalCount, -999);
-
-    static SG::AuxElement::ConstAccessor<int> GhostBHadronsInitialCount ("GhostBHadronsInitialCount");
-    safeFill<int, int, xAOD::Jet>(jet, GhostBHadronsInitialCount, m_GhostBHadronsInitialCount, -999);
-
-    static SG::AuxElement::ConstAccessor<int> GhostBQuarksFinalCount ("GhostBQuarksFinalCount");
-    safeFill<int, int, xAOD::Jet>(jet, GhostBQuarksFinalCount, m_GhostBQuarksFinalCount, -999);
-
-    static SG::AuxElement::ConstAccessor<float> GhostBHadronsFinalPt ("GhostBHadronsFinalPt");
-    safeFill<float, float, xAOD::Jet>(jet, GhostBHadronsFinalPt, m_GhostBHadronsFinalPt, -999);
-
-    static SG::AuxElement::ConstAccessor<float> GhostBHadronsInitialPt ("GhostBHadronsInitialPt");
-    safeFill<float, float, xAOD::Jet>(jet, GhostBHadronsInitialPt, m_GhostBHadronsInitialPt, -999);
-
-    static SG::AuxElement::ConstAccessor<float> GhostBQuarksFinalPt ("GhostBQuarksFinalPt");
-    safeFill<float, float, xAOD::Jet>(jet, GhostBQuarksFinalPt, m_GhostBQuarksFinalPt, -999);
-
-    //
-    // C-Hadron Details
-    //
-    static SG::AuxElement::ConstAccessor<int> GhostCHadronsFinalCount ("GhostCHadronsFinalCount");
-    safeFill<int, int, xAOD::Jet>(jet, GhostCHadronsFinalCount, m_GhostCHadronsFinalCount, -999);
-
-    static SG::AuxElement::ConstAccessor<int> GhostCHadronsInitialCount ("GhostCHadronsInitialCount");
-    safeFill<int, int, xAOD::Jet>(jet, GhostCHadronsInitialCount, m_GhostCHadronsInitialCount, -999);
-
-    static SG::AuxElement::ConstAccessor<int> GhostCQuarksFinalCount ("GhostCQuarksFinalCount");
-    safeFill<int, int, xAOD::Jet>(jet, GhostCQuarksFinalCount, m_GhostCQuarksFinalCount, -999);
-
-    static SG::AuxElement::ConstAccessor<float> GhostCHadronsFinalPt ("GhostCHadronsFinalPt");
-    safeFill<float, float, xAOD::Jet>(jet, GhostCHadronsFinalPt, m_GhostCHadronsFinalPt, -999);
-
-    static SG::AuxElement::ConstAccessor<float> GhostCHadronsInitialPt ("GhostCHadronsInitialPt");
-    safeFill<float, float, xAOD::Jet>(jet, GhostCHadronsInitialPt, m_GhostCHadronsInitialPt, -999);
-
-    static SG::AuxElement::ConstAccessor<float> GhostCQuarksFinalPt ("GhostCQuarksFinalPt");
-    safeFill<float, float, xAOD::Jet>(jet, GhostCQuarksFinalPt, m_GhostCQuarksFinalPt, -999);
-
-    //
-    // Tau Details
-    //
-    static SG::AuxElement::ConstAccessor<int> GhostTausFinalCount ("GhostTausFinalCount");
-    safeFill<int, int, xAOD::Jet>(jet, GhostTausFinalCount, m_GhostTausFinalCount, -999);
-
-    // THE ONLY UN-OFFICIAL PIECE OF CODE HERE USE WITH CAUTION
-    static SG::AuxElement::ConstAccessor<float> GhostTausFinalPt ("GhostTausFinalPt");
-    safeFill<float, float, xAOD::Jet>(jet, GhostTausFinalPt, m_GhostTausFinalPt, -999);
-
     // light quark(1,2,3) , gluon (21 or 9), charm(4) and b(5)
     // GhostPartons should select for these pdgIds only
     //    static SG::AuxElement::ConstAccessor< std::vector<const xAOD::TruthParticle*> > ghostPartons("GhostPartons");
@@ -6,6 +6,138 @@ ANA_MSG_SOURCE(msgJetHists, "JetHists")
 
 using std::vector;
 
+namespace {
+
+  /** @brief a histogram of one variable of the jet, filled as it is */
+  template< typename T >
+  struct VariableHistSpec {
+    const char* name;
+    const char* title;
+    /** @brief whether the title gets the title prefix of the set */
+    bool   prefixTitle;
+    int    nBins;
+    double low, high;
+    /** @brief detail that books the histogram */
+    bool HelperClasses::JetInfoSwitch::* detail;
+    /** @brief aux variable of the xAOD::Jet */
+    const char* auxName;
+    /** @brief the same variable of the xAH::Jet, nullptr if only the xAOD::Jet fills the histogram */
+    T xAH::Jet::* member;
+  };
+
+  // one line per variable
+  constexpr VariableHistSpec<float> s_variableHists[] = {
+    // clean
+    { "JetTimming",      "Jet Timming",          true,  120, -80,  80,   &HelperClasses::JetInfoSwitch::m_clean,  "Timing",          &xAH::Jet::Timing          },
+    { "LArQuality",      "LAr Quality",          true,  120, -600, 600,  &HelperClasses::JetInfoSwitch::m_clean,  "LArQuality",      &xAH::Jet::LArQuality      },
+    { "HECQuality",      "HEC Quality",          true,  120, -10,  10,   &HelperClasses::JetInfoSwitch::m_clean,  "HECQuality",      &xAH::Jet::HECQuality      },
+    { "NegativeE",       "Negative Energy",      true,  120, -10,  10,   &HelperClasses::JetInfoSwitch::m_clean,  "NegativeE",       &xAH::Jet::NegativeE       },
+    { "AverageLArQF",    "<LAr Quality Factor>", true,  120, 0,    1000, &HelperClasses::JetInfoSwitch::m_clean,  "AverageLArQF",    &xAH::Jet::AverageLArQF    },
+    { "BchCorrCell",     "BCH Corr Cell",        true,  120, 0,    600,  &HelperClasses::JetInfoSwitch::m_clean,  "BchCorrCell",     &xAH::Jet::BchCorrCell     },
+    { "N90Constituents", "N90 Constituents",     true,  120, 0,    40,   &HelperClasses::JetInfoSwitch::m_clean,  "N90Constituents", &xAH::Jet::N90Constituents },
+    // energy
+    { "HECFrac",         "HEC Fraction",         true,  120, 0,    5,    &HelperClasses::JetInfoSwitch::m_energy, "HECFrac",         &xAH::Jet::HECFrac         },
+    { "EMFrac",          "EM Fraction",          true,  120, 0,    2,    &HelperClasses::JetInfoSwitch::m_energy, "EMFrac",          &xAH::Jet::EMFrac          },
+    { "CentroidR",       "CentroidR",            true,  120, 0,    600,  &HelperClasses::JetInfoSwitch::m_energy, "CentroidR",       &xAH::Jet::CentroidR       },
+    // truth
+    { "TruthLabelDeltaR_B",     "Truth Label dR(b)",          true,  120, -0.1, 1.0,  &HelperClasses::JetInfoSwitch::m_truth,        "TruthLabelDeltaR_B",     &xAH::Jet::TruthLabelDeltaR_B },
+    { "TruthLabelDeltaR_C",     "Truth Label dR(c)",          true,  120, -0.1, 1.0,  &HelperClasses::JetInfoSwitch::m_truth,        "TruthLabelDeltaR_C",     &xAH::Jet::TruthLabelDeltaR_C },
+    { "TruthLabelDeltaR_T",     "Truth Label dR(tau)",        true,  120, -0.1, 1.0,  &HelperClasses::JetInfoSwitch::m_truth,        "TruthLabelDeltaR_T",     &xAH::Jet::TruthLabelDeltaR_T },
+    // truthDetails
+    { "GhostBHadronsFinalPt",   "Truth p_{T} BHad (final)",   false, 100, 0,    100,  &HelperClasses::JetInfoSwitch::m_truthDetails, "GhostBHadronsFinalPt",   nullptr },
+    { "GhostBHadronsInitialPt", "Truth p_{T} BHad (initial)", false, 100, 0,    100,  &HelperClasses::JetInfoSwitch::m_truthDetails, "GhostBHadronsInitialPt", nullptr },
+    { "GhostBQuarksFinalPt",    "Truth p_{T} BQuark (final)", false, 100, 0,    100,  &HelperClasses::JetInfoSwitch::m_truthDetails, "GhostBQuarksFinalPt",    nullptr },
+    { "GhostCHadronsFinalPt",   "Truth p_{T} CHad (final)",   false, 100, 0,    100,  &HelperClasses::JetInfoSwitch::m_truthDetails, "GhostCHadronsFinalPt",   nullptr },
+    { "GhostCHadronsInitialPt", "Truth p_{T} CHad (initial)", false, 100, 0,    100,  &HelperClasses::JetInfoSwitch::m_truthDetails, "GhostCHadronsInitialPt", nullptr },
+    { "GhostCQuarksFinalPt",    "Truth p_{T} CQuark (final)", false, 100, 0,    100,  &HelperClasses::JetInfoSwitch::m_truthDetails, "GhostCQuarksFinalPt",    nullptr },
+    { "GhostTausFinalPt",       "Truth p_{T} Taus (final)",   false, 100, 0,    100,  &HelperClasses::JetInfoSwitch::m_truthDetails, "GhostTausFinalPt",       nullptr },
+    // substructure
+    { "Tau1",                   "#Tau_{1}",                   false, 100, 0,    1.0,  &HelperClasses::JetInfoSwitch::m_substructure, "Tau1",                   nullptr },
+    { "Tau2",                   "#Tau_{2}",                   false, 100, 0,    1.0,  &HelperClasses::JetInfoSwitch::m_substructure, "Tau2",                   nullptr },
+    { "Tau3",                   "#Tau_{3}",                   false, 100, 0,    1.0,  &HelperClasses::JetInfoSwitch::m_substructure, "Tau3",                   nullptr },
+    { "Tau1_wta",               "#Tau_{1}^{wta}",             false, 100, 0,    1.0,  &HelperClasses::JetInfoSwitch::m_substructure, "Tau1_wta",               nullptr },
+    { "Tau2_wta",               "#Tau_{2}^{wta}",             false, 100, 0,    1.0,  &HelperClasses::JetInfoSwitch::m_substructure, "Tau2_wta",               nullptr },
+    { "Tau3_wta",               "#Tau_{3}^{wta}",             false, 100, 0,    1.0,  &HelperClasses::JetInfoSwitch::m_substructure, "Tau3_wta",               nullptr },
+  };
+
+  constexpr VariableHistSpec<int> s_intVariableHists[] = {
+    // truth
+    { "HadronConeExclTruthLabelID", "HadronConeExclTruthLabelID", true,  40, -10.5, 29.5, &HelperClasses::JetInfoSwitch::m_truth,        "HadronConeExclTruthLabelID", &xAH::Jet::HadronConeExclTruthLabelID },
+    { "TruthCount",                 "Truth Count",                true,  60, -10.5, 49.5, &HelperClasses::JetInfoSwitch::m_truth,        "TruthCount",                 &xAH::Jet::TruthCount                 },
+    // truthDetails
+    { "GhostBHadronsFinalCount",    "Truth Count BHad (final)",   false, 10, -0.5,  9.5,  &HelperClasses::JetInfoSwitch::m_truthDetails, "GhostBHadronsFinalCount",    nullptr },
+    { "GhostBHadronsInitialCount",  "Truth Count BHad (initial)", false, 10, -0.5,  9.5,  &HelperClasses::JetInfoSwitch::m_truthDetails, "GhostBHadronsInitialCount",  nullptr },
+    { "GhostBQuarksFinalCount",     "Truth Count BQuark (final)", false, 10, -0.5,  9.5,  &HelperClasses::JetInfoSwitch::m_truthDetails, "GhostBQuarksFinalCount",     nullptr },
+    { "GhostCHadronsFinalCount",    "Truth Count CHad (final)",   false, 10, -0.5,  9.5,  &HelperClasses::JetInfoSwitch::m_truthDetails, "GhostCHadronsFinalCount",    nullptr },
+    { "GhostCHadronsInitialCount",  "Truth Count CHad (initial)", false, 10, -0.5,  9.5,  &HelperClasses::JetInfoSwitch::m_truthDetails, "GhostCHadronsInitialCount",  nullptr },
+    { "GhostCQuarksFinalCount",     "Truth Count CQuark (final)", false, 10, -0.5,  9.5,  &HelperClasses::JetInfoSwitch::m_truthDetails, "GhostCQuarksFinalCount",     nullptr },
+    { "GhostTausFinalCount",        "Truth Count Taus (final)",   false, 10, -0.5,  9.5,  &HelperClasses::JetInfoSwitch::m_truthDetails, "GhostTausFinalCount",        nullptr },
+  };
+
+  /** @brief fraction of the jet energy in one calorimeter sampling, the index in the table is the sampling */
+  struct LayerHistSpec {
+    const char* name;
+    const char* title;
+  };
+
+  constexpr LayerHistSpec s_layerHists[] = {
+    // LAr calo barrel
+    { "PreSamplerB", "Pre sample barrel"        },
+    { "EMB1",        "EM Barrel  1"             },
+    { "EMB2",        "EM Barrel  2"             },
+    { "EMB3",        "EM Barrel  3"             },
+    // LAr calo endcap
+    { "PreSamplerE", "Pre sample end cap"       },
+    { "EME1",        "EM Endcap  1"             },
+    { "EME2",        "EM Endcap  2"             },
+    { "EME3",        "EM Endcap  3"             },
+    // Hadronic endcap
+    { "HEC0",        "Hadronic Endcap  0"       },
+    { "HEC1",        "Hadronic Endcap  1"       },
+    { "HEC2",        "Hadronic Endcap  2"       },
+    { "HEC3",        "Hadronic Endcap  3"       },
+    // Tile barrel
+    { "TileBar0",    "Tile Barrel  0"           },
+    { "TileBar1",    "Tile Barrel  1"           },
+    { "TileBar2",    "Tile Barrel  2"           },
+    // Tile gap (ITC & scint)
+    { "TileGap1",    "Tile Gap  1"              },
+    { "TileGap2",    "Tile Gap  2"              },
+    { "TileGap3",    "Tile Gap  3"              },
+    // Tile extended barrel
+    { "TileExt0",    "Tile extended barrel  0"  },
+    { "TileExt1",    "Tile extended barrel  1"  },
+    { "TileExt2",    "Tile extended barrel  2"  },
+    // Forward EM endcap
+    { "FCAL0",       "Foward EM endcap  0"      },
+    { "FCAL1",       "Foward EM endcap  1"      },
+    { "FCAL2",       "Foward EM endcap  2"      },
+    // Mini FCAL, samplings 24 to 27, not plotted
+  };
+
+  // the accessors of the details that can be filled on threads, shared by execute and auxIDs
+
+  // layer
+  const SG::AuxElement::ConstAccessor< vector<float> > ePerSamp ("EnergyPerSampling");
+
+  // truth
+  const SG::AuxElement::ConstAccessor<int> TruthLabelID ("TruthLabelID");
+  const SG::AuxElement::ConstAccessor<int> PartonTruthLabelID ("PartonTruthLabelID");
+  const SG::AuxElement::ConstAccessor<float> TruthPt ("TruthPt");
+
+  // resolution
+  const SG::AuxElement::ConstAccessor<float> GhostTruthPt ("GhostTruthPt");
+
+  // substructure
+  const SG::AuxElement::ConstAccessor<float> Tau1 ("Tau1");
+  const SG::AuxElement::ConstAccessor<float> Tau2 ("Tau2");
+  const SG::AuxElement::ConstAccessor<float> Tau3 ("Tau3");
+  const SG::AuxElement::ConstAccessor<float> Tau1_wta ("Tau1_wta");
+  const SG::AuxElement::ConstAccessor<float> Tau2_wta ("Tau2_wta");
+  const SG::AuxElement::ConstAccessor<float> Tau3_wta ("Tau3_wta");
+
+}
+
 JetHists :: JetHists (std::string name, std::string detailStr, const std::string& prefix, const std::string& titlePrefix) :
   IParticleHists(name, detailStr, prefix, titlePrefix),
   m_infoSwitch(new HelperClasses::JetInfoSwitch(m_detailStr)),
@@ -25,18 +157,22 @@ StatusCode JetHists::initialize() {
 
   if(m_debug) Info("JetHists::initialize()", m_name.c_str());
 
+  // variables of the jet plotted as they are
+  for( const auto& spec : s_variableHists ) {
+    if( !(m_infoSwitch->*spec.detail) ) continue;
+    m_variableHists.push_back( book(m_name, spec.name, (spec.prefixTitle ? m_titlePrefix : "")+spec.title, spec.nBins, spec.low, spec.high) );
+    m_variableAccessors.emplace_back( spec.auxName );
+    m_variableMembers.push_back( spec.member );
+  }
+  for( const auto& spec : s_intVariableHists ) {
+    if( !(m_infoSwitch->*spec.detail) ) continue;
+    m_intVariableHists.push_back( book(m_name, spec.name, (spec.prefixTitle ? m_titlePrefix : "")+spec.title, spec.nBins, spec.low, spec.high) );
+    m_intVariableAccessors.emplace_back( spec.auxName );
+    m_intVariableMembers.push_back( spec.member );
+  }
+
   // details for jet cleaning
   if( m_infoSwitch->m_clean ) {
-    if(m_debug) Info("JetHists::initialize()", "adding clean plots");
-    // units?
-    m_jetTime     = book(m_name, "JetTimming" ,     m_titlePrefix+"Jet Timming",      120, -80, 80);
-    m_LArQuality  = book(m_name, "LArQuality" ,     m_titlePrefix+"LAr Quality",      120, -600, 600);
-    m_hecq        = book(m_name, "HECQuality" ,     m_titlePrefix+"HEC Quality",      120, -10, 10);
-    m_negE        = book(m_name, "NegativeE" ,      m_titlePrefix+"Negative Energy",  120, -10, 10);
-    m_avLArQF     = book(m_name, "AverageLArQF" ,   m_titlePrefix+"<LAr Quality Factor>" , 120, 0, 1000);
-    m_bchCorrCell = book(m_name, "BchCorrCell" ,    m_titlePrefix+"BCH Corr Cell" ,   120, 0, 600);
-    m_N90Const    = book(m_name, "N90Constituents", m_titlePrefix+"N90 Constituents" ,  120, 0, 40);
-
     //m_LArBadHVEFrac              =book(m_name, "LArBadHVEFrac",              m_titlePrefix+" jet LAr Bad HV Energy Fraction", 120,   0,    1);
     //m_LArBadHVNCell              =book(m_name, "LArBadHVNCell",              m_titlePrefix+" jet LAr Bad HV N_{cells}",       120,  -0.5,499.5);
     //m_OotFracClusters5           =book(m_name, "OotFracClusters5",           m_titlePrefix+" jet OotFracClusters5" ,          120,   0,    1);
@@ -49,89 +185,24 @@ StatusCode JetHists::initialize() {
     //m_clean_passLooseBadUgly     =book(m_name, "clean_passLooseBadUgly",     m_titlePrefix+" jet LooseBadUgly Cleaning Flag",   2,  -0.5,  1.5);
     //m_clean_passTightBad         =book(m_name, "clean_passTightBad",         m_titlePrefix+" jet TightBad Cleaning Flag" ,      2,  -0.5,  1.5);
     //m_clean_passTightBadUgly     =book(m_name, "clean_passTightBadUgly",     m_titlePrefix+" jet TightBadUgly Cleaning Flag",   2,  -0.5,  1.5);
-
   }
 
   // details for jet energy information
   if( m_infoSwitch->m_energy ) {
-    if(m_debug) Info("JetHists::initialize()", "adding energy plots");
-    m_HECf      = book(m_name, "HECFrac",         m_titlePrefix+"HEC Fraction" ,    120, 0, 5);
-    m_EMf       = book(m_name, "EMFrac",          m_titlePrefix+"EM Fraction" ,     120, 0, 2);
     m_actArea   = book(m_name, "ActiveArea",      m_titlePrefix+"Jet Active Area" , 120, 0, 1);
-    m_centroidR = book(m_name, "CentroidR",       m_titlePrefix+"CentroidR" ,       120, 0, 600);
     //m_FracSamplingMax       = book(m_name, "FracSamplingMax",       m_titlePrefix+" jet FracSamplingMax" ,       120,  0,      1);
     //m_FracSamplingMaxIndex  = book(m_name, "FracSamplingMaxIndex",  m_titlePrefix+" jet FracSamplingMaxIndex" ,   22, -0.5,   21.5);
     //m_LowEtConstituentsFrac = book(m_name, "LowEtConstituentsFrac", m_titlePrefix+" jet LowEtConstituentsFrac" , 120,  0,      1);
     //m_GhostMuonSegmentCount = book(m_name, "GhostMuonSegmentCount", m_titlePrefix+" jet GhostMuonSegmentCount" ,  10, -0.5,    9.5);
     //m_Width                 = book(m_name, "Width",                 m_titlePrefix+" jet Width",                  100, 0, 0.5);
-
   }
 
   // details for jet energy in each layer
   // plotted as fraction instead of absolute to make the plotting easier
   if( m_infoSwitch->m_layer ) {
-    m_PreSamplerB  = book(m_name, "PreSamplerB",   "Pre sample barrel", 120, -0.1, 1.1);
-    m_EMB1         = book(m_name, "EMB1", "EM Barrel  1", 120, -0.1, 1.1);
-    m_EMB2         = book(m_name, "EMB2", "EM Barrel  2", 120, -0.1, 1.1);
-    m_EMB3         = book(m_name, "EMB3", "EM Barrel  3", 120, -0.1, 1.1);
-    m_PreSamplerE  = book(m_name, "PreSamplerE",   "Pre sample end cap", 120, -0.1, 1.1);
-    m_EME1         = book(m_name, "EME1", "EM Endcap  1", 120, -0.1, 1.1);
-    m_EME2         = book(m_name, "EME2", "EM Endcap  2", 120, -0.1, 1.1);
-    m_EME3         = book(m_name, "EME3", "EM Endcap  3", 120, -0.1, 1.1);
-    m_HEC0         = book(m_name, "HEC0", "Hadronic Endcap  0", 120, -0.1, 1.1);
-    m_HEC1         = book(m_name, "HEC1", "Hadronic Endcap  1", 120, -0.1, 1.1);
-    m_HEC2         = book(m_name, "HEC2", "Hadronic Endcap  2", 120, -0.1, 1.1);
-    m_HEC3         = book(m_name, "HEC3", "Hadronic Endcap  3", 120, -0.1, 1.1);
-    m_TileBar0     = book(m_name, "TileBar0", "Tile Barrel  0", 120, -0.1, 1.1);
-    m_TileBar1     = book(m_name, "TileBar1", "Tile Barrel  1", 120, -0.1, 1.1);
-    m_TileBar2     = book(m_name, "TileBar2", "Tile Barrel  2", 120, -0.1, 1.1);
-    m_TileGap1     = book(m_name, "TileGap1", "Tile Gap  1", 120, -0.1, 1.1);
-    m_TileGap2     = book(m_name, "TileGap2", "Tile Gap  2", 120, -0.1, 1.1);
-    m_TileGap3     = book(m_name, "TileGap3", "Tile Gap  3", 120, -0.1, 1.1);
-    m_TileExt0     = book(m_name, "TileExt0", "Tile extended barrel  0", 120, -0.1, 1.1);
-    m_TileExt1     = book(m_name, "TileExt1", "Tile extended barrel  1", 120, -0.1, 1.1);
-    m_TileExt2     = book(m_name, "TileExt2", "Tile extended barrel  2", 120, -0.1, 1.1);
-    m_FCAL0        = book(m_name, "FCAL0", "Foward EM endcap  0", 120, -0.1, 1.1);
-    m_FCAL1        = book(m_name, "FCAL1", "Foward EM endcap  1", 120, -0.1, 1.1);
-    m_FCAL2        = book(m_name, "FCAL2", "Foward EM endcap  2", 120, -0.1, 1.1);
-
-//      LAr calo barrel
-//      PreSamplerB 0
-//      EMB1 1
-//      EMB2 2
-//      EMB3 3
-//      LAr calo endcap
-//      PreSamplerE 4
-//      EME1  5
-//      EME2  6
-//      EME3  7
-//      Hadronic endcap
-//      HEC0  8
-//      HEC1  9
-//      HEC2  10
-//      HEC3  11
-//      Tile barrel
-//      TileBar0  12
-//      TileBar1  13
-//      TileBar2  14
-//      Tile gap (ITC & scint)
-//      TileGap1  15
-//      TileGap2  16
-//      TileGap3  17
-//      Tile extended barrel
-//      TileExt0  18
-//      TileExt1  19
-//      TileExt2  20
-//      Forward EM endcap
-//      FCAL0 21
-//      FCAL1 22
-//      FCAL2 23
-//      Mini FCAL
-//      MINIFCAL0 24
-//      MINIFCAL1 25
-//      MINIFCAL2 26
-//      MINIFCAL3 27
-
+    for( const auto& spec : s_layerHists ) {
+      m_layerHists.push_back( book(m_name, spec.name, spec.title, 120, -0.1, 1.1) );
+    }
   }
 
   //m_chf         = book(m_name, "chfPV" ,    "PV(chf)" ,     120, 0, 600);
@@ -157,14 +228,8 @@ StatusCode JetHists::initialize() {
     if(m_debug) Info("JetHists::initialize()", "adding truth plots");
 
     m_truthLabelID   = book(m_name, "TruthLabelID",        m_titlePrefix+"Truth Label" ,          40,  -10.5,  29.5);
-    m_hadronConeExclTruthLabelID   = book(m_name, "HadronConeExclTruthLabelID",        m_titlePrefix+"HadronConeExclTruthLabelID" ,          40,  -10.5,  29.5);
-    m_truthCount     = book(m_name, "TruthCount",          m_titlePrefix+"Truth Count" ,          60,  -10.5,  49.5);
     m_truthPt        = book(m_name, "TruthPt",             m_titlePrefix+"Truth Pt",              100,   0,   100.0);
 
-    m_truthDr_B      = book(m_name, "TruthLabelDeltaR_B",  m_titlePrefix+"Truth Label dR(b)" ,          120, -0.1,   1.0);
-    m_truthDr_C      = book(m_name, "TruthLabelDeltaR_C",  m_titlePrefix+"Truth Label dR(c)" ,    120, -0.1, 1.0);
-    m_truthDr_T      = book(m_name, "TruthLabelDeltaR_T",  m_titlePrefix+"Truth Label dR(tau)" ,  120, -0.1, 1.0);
-
     //m_PartonTruthLabelID= book(m_name, "PartonTruthLabelID", m_titlePrefix+"jet PartonTruthLabelID",  22, -0.5, 21.5);
     //m_GhostTruthAssociationFraction= book(m_name, "GhostTruthAssociationFraction", m_titlePrefix+" jet GhostTruthAssociationFraction", 100, 0, 1);
     //m
@@ -177,28 +242,6 @@ StatusCode JetHists::initialize() {
 
   }
 
-  if( m_infoSwitch->m_truthDetails ) {
-    if(m_debug) Info("JetHists::initialize()", "adding detailed truth plots");
-
-    m_truthCount_BhadFinal = book(m_name, "GhostBHadronsFinalCount",    "Truth Count BHad (final)" ,    10, -0.5,   9.5);
-    m_truthCount_BhadInit  = book(m_name, "GhostBHadronsInitialCount",  "Truth Count BHad (initial)" ,  10, -0.5,   9.5);
-    m_truthCount_BQFinal   = book(m_name, "GhostBQuarksFinalCount",     "Truth Count BQuark (final)" ,  10, -0.5,   9.5);
-    m_truthPt_BhadFinal    = book(m_name, "GhostBHadronsFinalPt",       "Truth p_{T} BHad (final)" ,      100,    0,   100);
-    m_truthPt_BhadInit     = book(m_name, "GhostBHadronsInitialPt",     "Truth p_{T} BHad (initial)" ,    100,    0,   100);
-    m_truthPt_BQFinal      = book(m_name, "GhostBQuarksFinalPt",        "Truth p_{T} BQuark (final)" ,    100,    0,   100);
-
-    m_truthCount_ChadFinal = book(m_name, "GhostCHadronsFinalCount",   "Truth Count CHad (final)" ,    10, -0.5,   9.5);
-    m_truthCount_ChadInit  = book(m_name, "GhostCHadronsInitialCount", "Truth Count CHad (initial)" ,  10, -0.5,   9.5);
-    m_truthCount_CQFinal   = book(m_name, "GhostCQuarksFinalCount",    "Truth Count CQuark (final)" ,  10, -0.5,   9.5);
-    m_truthPt_ChadFinal    = book(m_name, "GhostCHadronsFinalPt",      "Truth p_{T} CHad (final)" ,      100,    0,   100);
-    m_truthPt_ChadInit     = book(m_name, "GhostCHadronsInitialPt",    "Truth p_{T} CHad (initial)" ,    100,    0,   100);
-    m_truthPt_CQFinal      = book(m_name, "GhostCQuarksFinalPt",       "Truth p_{T} CQuark (final)" ,    100,    0,   100);
-
-    m_truthCount_TausFinal = book(m_name, "GhostTausFinalCount", "Truth Count Taus (final)" ,    10, -0.5,   9.5);
-    m_truthPt_TausFinal    = book(m_name, "GhostTausFinalPt",    "Truth p_{T} Taus (final)" ,      100,    0,   100);
-
-  }
-
   if(m_infoSwitch->m_JVC){
     if(m_debug) Info("JetHists::initialize()", "adding JVC plots");
     m_JVC = book(m_name, "JVC", m_titlePrefix+"JVC", 100, -5, 5);
@@ -339,14 +382,8 @@ StatusCode JetHists::initialize() {
   }
 
   if( m_infoSwitch->m_substructure ){
-    m_tau1                      = book(m_name, "Tau1", "#Tau_{1}", 100, 0, 1.0);
-    m_tau2                      = book(m_name, "Tau2", "#Tau_{2}", 100, 0, 1.0);
-    m_tau3                      = book(m_name, "Tau3", "#Tau_{3}", 100, 0, 1.0);
     m_tau21                     = book(m_name, "Tau21", "#Tau_{21}", 100, 0, 1.0);
     m_tau32                     = book(m_name, "Tau32", "#Tau_{32}", 100, 0, 1.0);
-    m_tau1_wta                  = book(m_name, "Tau1_wta", "#Tau_{1}^{wta}", 100, 0, 1.0);
-    m_tau2_wta                  = book(m_name, "Tau2_wta", "#Tau_{2}^{wta}", 100, 0, 1.0);
-    m_tau3_wta                  = book(m_name, "Tau3_wta", "#Tau_{3}^{wta}", 100, 0, 1.0);
     m_tau21_wta                 = book(m_name, "Tau21_wta", "#Tau_{21}^{wta}", 100, 0, 1.0);
     m_tau32_wta                 = book(m_name, "Tau32_wta", "#Tau_{32}^{wta}", 100, 0, 1.0);
     m_numConstituents           = book(m_name, "numConstituents", "num. constituents", 501, -0.5, 500.5);
@@ -360,6 +397,7 @@ StatusCode JetHists::initialize() {
 
     m_tracksInJet = new TracksInJetHists(m_name+"trk_", "");
     m_tracksInJet -> initialize( );
+    addNested( m_tracksInJet );
   }
 
   if( m_infoSwitch->m_byEta){
@@ -556,139 +594,28 @@ StatusCode JetHists::execute( const xAOD::IParticle* particle, float eventWeight
       return StatusCode::FAILURE;
     }
 
-  // clean
-  if( m_infoSwitch->m_clean ) {
-    if(m_debug) std::cout << "JetHists: m_clean " <<std::endl;
-
-    static SG::AuxElement::ConstAccessor<float> jetTime ("Timing");
-    if( jetTime.isAvailable( *jet ) ) {
-      m_jetTime ->  Fill( jetTime( *jet ), eventWeight );
-    }
-
-    static SG::AuxElement::ConstAccessor<float> LArQuality ("LArQuality");
-    if( LArQuality.isAvailable( *jet ) ) {
-      m_LArQuality ->  Fill( LArQuality( *jet ), eventWeight );
-    }
-
-    static SG::AuxElement::ConstAccessor<float> hecq ("HECQuality");
-    if( hecq.isAvailable( *jet ) ) {
-      m_hecq ->  Fill( hecq( *jet ), eventWeight );
-    }
-
-    static SG::AuxElement::ConstAccessor<float> negE ("NegativeE");
-    if( negE.isAvailable( *jet ) ) {
-      m_negE ->  Fill( negE( *jet ), eventWeight );
-    }
-
-    static SG::AuxElement::ConstAccessor<float> avLArQF ("AverageLArQF");
-    if( avLArQF.isAvailable( *jet ) ) {
-      m_avLArQF ->  Fill( avLArQF( *jet ), eventWeight );
-    }
-
-    static SG::AuxElement::ConstAccessor<float> bchCorrCell ("BchCorrCell");
-    if( bchCorrCell.isAvailable( *jet ) ) {
-      m_bchCorrCell ->  Fill( bchCorrCell( *jet ), eventWeight );
-    }
-
-    // 0062       N90Cells?
-    static SG::AuxElement::ConstAccessor<float> N90Const ("N90Constituents");
-    if( N90Const.isAvailable( *jet ) ) {
-      m_N90Const ->  Fill( N90Const( *jet ), eventWeight );
-    }
-
-
- // 0030       LArBadHVEnergy,
- // 0031       LArBadHVRatio,
- // 0035       NumTowers,
- // 0057       isBadLoose,
- // 0058       isBadMedium,
- // 0059       isBadTight,
- // 0060       isUgly,
- // 0063       OotFracClusters10,
- // 0064       OotFracClusters5,
- // 0065       OotFracCells5,
- // 0066       OotFracCells10,
-
-  } // fillClean
-
-  // energy
-  if( m_infoSwitch->m_energy ) {
-    if(m_debug) std::cout << "JetHists: m_energy " <<std::endl;
-
-    static SG::AuxElement::ConstAccessor<float> HECf ("HECFrac");
-    if( HECf.isAvailable( *jet ) ) {
-      m_HECf ->  Fill( HECf( *jet ), eventWeight );
-    }
-
-    static SG::AuxElement::ConstAccessor<float> EMf ("EMFrac");
-    if( EMf.isAvailable( *jet ) ) {
-      m_EMf ->  Fill( EMf( *jet ), eventWeight );
-    }
-
-    static SG::AuxElement::ConstAccessor<float> centroidR ("CentroidR");
-    if( centroidR.isAvailable( *jet ) ) {
-      m_centroidR ->  Fill( centroidR( *jet ), eventWeight );
+  for( size_t i = 0; i < m_variableHists.size(); ++i ) {
+    const SG::AuxElement::ConstAccessor<float>& acc = m_variableAccessors[i];
+    if( acc.isAvailable( *jet ) ) {
+      fill( m_variableHists[i], acc( *jet ), eventWeight );
     }
-
-    /*
-
-    static SG::AuxElement::ConstAccessor<float> samplingMax ("SamplingMax");
-    if( samplingMax.isAvailable( *jet ) ) {
-      m_samplingMax ->  Fill( samplingMax( *jet ), eventWeight );
-    }
-
-    static SG::AuxElement::ConstAccessor<float> ePerSamp ("EnergyPerSampling");
-    if( ePerSamp.isAvailable( *jet ) ) {
-      m_ePerSamp ->  Fill( ePerSamp( *jet ), eventWeight );
-    }
-
-    static SG::AuxElement::ConstAccessor<float> fracSampMax ("FracSamplingMax");
-    if( fracSampMax.isAvailable( *jet ) ) {
-      m_fracSampMax ->  Fill( fracSampMax( *jet ), eventWeight );
-    }
-
-    static SG::AuxElement::ConstAccessor<float> lowEtFrac ("LowEtConstituentsFrac");
-    if( lowEtFrac.isAvailable( *jet ) ) {
-      m_lowEtFrac ->  Fill( lowEtFrac( *jet ), eventWeight );
+  }
+  for( size_t i = 0; i < m_intVariableHists.size(); ++i ) {
+    const SG::AuxElement::ConstAccessor<int>& acc = m_intVariableAccessors[i];
+    if( acc.isAvailable( *jet ) ) {
+      fill( m_intVariableHists[i], acc( *jet ), eventWeight );
     }
-
- // 0036       Offset,
- // 0037       OriginIndex    ,
-    */
-
   }
 
-  if( m_infoSwitch->m_layer ){
+  if( !m_layerHists.empty() ){
     if(m_debug) std::cout << "JetHists: m_layer " <<std::endl;
 
-    static SG::AuxElement::ConstAccessor< vector<float> > ePerSamp ("EnergyPerSampling");
     if( ePerSamp.isAvailable( *jet ) ) {
-      vector<float> ePerSampVals = ePerSamp( *jet );
+      const vector<float>& ePerSampVals = ePerSamp( *jet );
       float jetE = jet->e();
-      m_PreSamplerB -> Fill( ePerSampVals.at(0) / jetE );
-      m_EMB1        -> Fill( ePerSampVals.at(1) / jetE );
-      m_EMB2        -> Fill( ePerSampVals.at(2) / jetE );
-      m_EMB3        -> Fill( ePerSampVals.at(3) / jetE );
-      m_PreSamplerE -> Fill( ePerSampVals.at(4) / jetE );
-      m_EME1        -> Fill( ePerSampVals.at(5) / jetE );
-      m_EME2        -> Fill( ePerSampVals.at(6) / jetE );
-      m_EME3        -> Fill( ePerSampVals.at(7) / jetE );
-      m_HEC0        -> Fill( ePerSampVals.at(8) / jetE );
-      m_HEC1        -> Fill( ePerSampVals.at(9) / jetE );
-      m_HEC2        -> Fill( ePerSampVals.at(10) / jetE );
-      m_HEC3        -> Fill( ePerSampVals.at(11) / jetE );
-      m_TileBar0    -> Fill( ePerSampVals.at(12) / jetE );
-      m_TileBar1    -> Fill( ePerSampVals.at(13) / jetE );
-      m_TileBar2    -> Fill( ePerSampVals.at(14) / jetE );
-      m_TileGap1    -> Fill( ePerSampVals.at(15) / jetE );
-      m_TileGap2    -> Fill( ePerSampVals.at(16) / jetE );
-      m_TileGap3    -> Fill( ePerSampVals.at(17) / jetE );
-      m_TileExt0    -> Fill( ePerSampVals.at(18) / jetE );
-      m_TileExt1    -> Fill( ePerSampVals.at(19) / jetE );
-      m_TileExt2    -> Fill( ePerSampVals.at(20) / jetE );
-      m_FCAL0       -> Fill( ePerSampVals.at(21) / jetE );
-      m_FCAL1       -> Fill( ePerSampVals.at(22) / jetE );
-      m_FCAL2       -> Fill( ePerSampVals.at(23) / jetE );
+      for( size_t sampling = 0; sampling < m_layerHists.size(); ++sampling ) {
+        fill( m_layerHists[sampling], ePerSampVals.at(sampling) / jetE );
+      }
     }
   }
 
@@ -700,7 +627,7 @@ StatusCode JetHists::execute( const xAOD::IParticle* particle, float eventWeight
 
     static SG::AuxElement::ConstAccessor<int> actArea ("ActiveArea");
     if( actArea.isAvailable( *jet ) ) {
-      m_actArea ->  Fill( actArea( *jet ), eventWeight );
+      fill( m_actArea,  actArea( *jet ), eventWeight );
     }
 
     static SG::AuxElement::ConstAccessor<int> voroniA ("VoronoiArea");
@@ -802,137 +729,20 @@ StatusCode JetHists::execute( const xAOD::IParticle* particle, float eventWeight
   if( m_infoSwitch->m_truth ) {
     if(m_debug) std::cout << "JetHists: m_truth " <<std::endl;
 
-    static SG::AuxElement::ConstAccessor<int> TruthLabelID ("TruthLabelID");
     if( TruthLabelID.isAvailable( *jet ) ) {
-      m_truthLabelID ->  Fill( TruthLabelID( *jet ), eventWeight );
+      fill( m_truthLabelID,  TruthLabelID( *jet ), eventWeight );
     }else{
-      static SG::AuxElement::ConstAccessor<int> PartonTruthLabelID ("PartonTruthLabelID");
       if( PartonTruthLabelID.isAvailable( *jet ) ) {
-	m_truthLabelID ->  Fill( PartonTruthLabelID( *jet ), eventWeight );
+	fill( m_truthLabelID,  PartonTruthLabelID( *jet ), eventWeight );
       }
     }
 
-    static SG::AuxElement::ConstAccessor<int> HadronConeExclTruthLabelID ("HadronConeExclTruthLabelID");
-    if( HadronConeExclTruthLabelID.isAvailable( *jet ) ) {
-      m_hadronConeExclTruthLabelID ->  Fill( HadronConeExclTruthLabelID( *jet ), eventWeight );
-    }
-
-    static SG::AuxElement::ConstAccessor<int> TruthCount ("TruthCount");
-    if( TruthCount.isAvailable( *jet ) ) {
-      m_truthCount ->  Fill( TruthCount( *jet ), eventWeight );
-    }
-
-    static SG::AuxElement::ConstAccessor<float> TruthPt ("TruthPt");
     if( TruthPt.isAvailable( *jet ) ) {
-      m_truthPt ->  Fill( TruthPt( *jet )/1000, eventWeight );
-    }
-
-    static SG::AuxElement::ConstAccessor<float> TruthLabelDeltaR_B ("TruthLabelDeltaR_B");
-    if( TruthLabelDeltaR_B.isAvailable( *jet ) ) {
-      m_truthDr_B ->  Fill( TruthLabelDeltaR_B( *jet ), eventWeight );
-    }
-
-    static SG::AuxElement::ConstAccessor<float> TruthLabelDeltaR_C ("TruthLabelDeltaR_C");
-    if( TruthLabelDeltaR_C.isAvailable( *jet ) ) {
-      m_truthDr_C ->  Fill( TruthLabelDeltaR_C( *jet ), eventWeight );
-    }
-
-    static SG::AuxElement::ConstAccessor<float> TruthLabelDeltaR_T ("TruthLabelDeltaR_T");
-    if( TruthLabelDeltaR_T.isAvailable( *jet ) ) {
-      m_truthDr_T ->  Fill( TruthLabelDeltaR_T( *jet ), eventWeight );
+      fill( m_truthPt,  TruthPt( *jet )/1000, eventWeight );
     }
 
   }
 
-
-  if( m_infoSwitch->m_truthDetails ) {
-    if(m_debug) std::cout << "JetHists: m_truthDetails " <<std::endl;
-
-    //
-    // B-Hadron Details
-    //
-    static SG::AuxElement::ConstAccessor<int> GhostBHadronsFinalCount ("GhostBHadronsFinalCount");
-    if( GhostBHadronsFinalCount.isAvailable( *jet ) ) {
-      m_truthCount_BhadFinal ->  Fill( GhostBHadronsFinalCount( *jet ), eventWeight );
-    }
-
-    static SG::AuxElement::ConstAccessor<int> GhostBHadronsInitialCount ("GhostBHadronsInitialCount");
-    if( GhostBHadronsInitialCount.isAvailable( *jet ) ) {
-      m_truthCount_BhadInit ->  Fill( GhostBHadronsInitialCount( *jet ), eventWeight );
-    }
-
-    static SG::AuxElement::ConstAccessor<int> GhostBQuarksFinalCount ("GhostBQuarksFinalCount");
-    if( GhostBQuarksFinalCount.isAvailable( *jet ) ) {
-      m_truthCount_BQFinal ->  Fill( GhostBQuarksFinalCount( *jet ), eventWeight );
-    }
-
-    static SG::AuxElement::ConstAccessor<float> GhostBHadronsFinalPt ("GhostBHadronsFinalPt");
-    if( GhostBHadronsFinalPt.isAvailable( *jet ) ) {
-      m_truthPt_BhadFinal ->  Fill( GhostBHadronsFinalPt( *jet ), eventWeight );
-    }
-
-    static SG::AuxElement::ConstAccessor<float> GhostBHadronsInitialPt ("GhostBHadronsInitialPt");
-    if( GhostBHadronsInitialPt.isAvailable( *jet ) ) {
-      m_truthPt_BhadInit ->  Fill( GhostBHadronsInitialPt( *jet ), eventWeight );
-    }
-
-    static SG::AuxElement::ConstAccessor<float> GhostBQuarksFinalPt ("GhostBQuarksFinalPt");
-    if( GhostBQuarksFinalPt.isAvailable( *jet ) ) {
-      m_truthPt_BQFinal ->  Fill( GhostBQuarksFinalPt( *jet ), eventWeight );
-    }
-
-
-    //
-    // C-Hadron Details
-    //
-    static SG::AuxElement::ConstAccessor<int> GhostCHadronsFinalCount ("GhostCHadronsFinalCount");
-    if( GhostCHadronsFinalCount.isAvailable( *jet ) ) {
-      m_truthCount_ChadFinal ->  Fill( GhostCHadronsFinalCount( *jet ), eventWeight );
-    }
-
-    static SG::AuxElement::ConstAccessor<int> GhostCHadronsInitialCount ("GhostCHadronsInitialCount");
-    if( GhostCHadronsInitialCount.isAvailable( *jet ) ) {
-      m_truthCount_ChadInit ->  Fill( GhostCHadronsInitialCount( *jet ), eventWeight );
-    }
-
-    static SG::AuxElement::ConstAccessor<int> GhostCQuarksFinalCount ("GhostCQuarksFinalCount");
-    if( GhostCQuarksFinalCount.isAvailable( *jet ) ) {
-      m_truthCount_CQFinal ->  Fill( GhostCQuarksFinalCount( *jet ), eventWeight );
-    }
-
-    static SG::AuxElement::ConstAccessor<float> GhostCHadronsFinalPt ("GhostCHadronsFinalPt");
-    if( GhostCHadronsFinalPt.isAvailable( *jet ) ) {
-      m_truthPt_ChadFinal ->  Fill( GhostCHadronsFinalPt( *jet ), eventWeight );
-    }
-
-    static SG::AuxElement::ConstAccessor<float> GhostCHadronsInitialPt ("GhostCHadronsInitialPt");
-    if( GhostCHadronsInitialPt.isAvailable( *jet ) ) {
-      m_truthPt_ChadInit ->  Fill( GhostCHadronsInitialPt( *jet ), eventWeight );
-    }
-
-    static SG::AuxElement::ConstAccessor<float> GhostCQuarksFinalPt ("GhostCQuarksFinalPt");
-    if( GhostCQuarksFinalPt.isAvailable( *jet ) ) {
-      m_truthPt_CQFinal ->  Fill( GhostCQuarksFinalPt( *jet ), eventWeight );
-    }
-
-
-    //
-    // Tau Details
-    //
-    static SG::AuxElement::ConstAccessor<int> GhostTausFinalCount ("GhostTausFinalCount");
-    if( GhostTausFinalCount.isAvailable( *jet ) ) {
-      m_truthCount_TausFinal ->  Fill( GhostTausFinalCount( *jet ), eventWeight );
-    }
-
-
-    static SG::AuxElement::ConstAccessor<float> GhostTausFinalPt ("GhostTausFinalPt");
-    if( GhostTausFinalPt.isAvailable( *jet ) ) {
-      m_truthPt_TausFinal ->  Fill( GhostTausFinalPt( *jet ), eventWeight );
-    }
-
-
-  }
-
   //
   // JVC
   //
@@ -959,10 +769,10 @@ StatusCode JetHists::execute( const xAOD::IParticle* particle, float eventWeight
     btag_info->MVx_discriminant("MV2c00", MV2c00);
     btag_info->MVx_discriminant("MV2c10", MV2c10);
     btag_info->MVx_discriminant("MV2c20", MV2c20);
-    m_MV2c00   ->  Fill( MV2c00, eventWeight );
-    m_MV2c10   ->  Fill( MV2c10, eventWeight );
-    m_MV2c20   ->  Fill( MV2c20, eventWeight );
-    m_MV2c20_l ->  Fill( MV2c20, eventWeight );
+    fill( m_MV2c00,    MV2c00, eventWeight );
+    fill( m_MV2c10,    MV2c10, eventWeight );
+    fill( m_MV2c20,    MV2c20, eventWeight );
+    fill( m_MV2c20_l,  MV2c20, eventWeight );
 
     if(m_infoSwitch->m_vsLumiBlock){
 
@@ -998,8 +808,8 @@ StatusCode JetHists::execute( const xAOD::IParticle* particle, float eventWeight
 
     static SG::AuxElement::ConstAccessor<double> SV0_significance3DAcc ("SV0_significance3D");
     if ( SV0_significance3DAcc.isAvailable(*btag_info) ) {
-      m_COMB            ->  Fill( btag_info->SV1_loglikelihoodratio() + btag_info->IP3D_loglikelihoodratio() , eventWeight );
-      m_JetFitter       ->  Fill( btag_info->JetFitter_loglikelihoodratio() , eventWeight );
+      fill( m_COMB,             btag_info->SV1_loglikelihoodratio() + btag_info->IP3D_loglikelihoodratio() , eventWeight );
+      fill( m_JetFitter,        btag_info->JetFitter_loglikelihoodratio() , eventWeight );
     }
 
     if(m_infoSwitch->m_btag_jettrk){
@@ -1013,10 +823,10 @@ StatusCode JetHists::execute( const xAOD::IParticle* particle, float eventWeight
 	trkSum_vAbsEta= btag_info->isAvailable<float>("trkSum_VEta") ? fabs(btag_info->auxdata<float>("trkSum_VEta")) : -10  ;
       }
 
-      m_trkSum_ntrk     ->  Fill( trkSum_ntrk     , eventWeight );
-      m_trkSum_sPt      ->  Fill( trkSum_sPt/1000 , eventWeight );
-      m_trkSum_vPt      ->  Fill( trkSum_vPt/1000 , eventWeight );
-      m_trkSum_vAbsEta  ->  Fill( trkSum_vAbsEta  , eventWeight );
+      fill( m_trkSum_ntrk,      trkSum_ntrk     , eventWeight );
+      fill( m_trkSum_sPt,       trkSum_sPt/1000 , eventWeight );
+      fill( m_trkSum_vPt,       trkSum_vPt/1000 , eventWeight );
+      fill( m_trkSum_vAbsEta,   trkSum_vAbsEta  , eventWeight );
 
       /*** Generating MVb variables ***/
       std::vector< ElementLink< xAOD::TrackParticleContainer > > associationLinks;
@@ -1076,10 +886,10 @@ StatusCode JetHists::execute( const xAOD::IParticle* particle, float eventWeight
 	float trk3_d0sig     = trk_d0_z0.size() > 2 ? trk_d0_z0[2].first : -100;
 	float trk3_z0sig     = trk_d0_z0.size() > 2 ? trk_d0_z0[2].second : -100;
 
-	m_width          -> Fill(width,          eventWeight);
-	m_n_trk_sigd0cut -> Fill(n_trk_sigd0cut, eventWeight);
-	m_trk3_d0sig     -> Fill(trk3_d0sig,     eventWeight);
-	m_trk3_z0sig     -> Fill(trk3_z0sig,     eventWeight);
+	fill( m_width,           width,          eventWeight );
+	fill( m_n_trk_sigd0cut,  n_trk_sigd0cut, eventWeight );
+	fill( m_trk3_d0sig,      trk3_d0sig,     eventWeight );
+	fill( m_trk3_z0sig,      trk3_z0sig,     eventWeight );
 
 	int sv1_ntkv;   btag_info->variable<int>  ("SV1", "NGTinSvx", sv1_ntkv);
         float sv1_efrc; btag_info->variable<float>("SV1", "efracsvx", sv1_efrc);
@@ -1090,8 +900,8 @@ StatusCode JetHists::execute( const xAOD::IParticle* particle, float eventWeight
 	float jf_efrc; btag_info->variable<float>("JetFitter", "energyFraction", jf_efrc);
 	float jf_scaled_efc  = (jf_ntrkv + jf_nvtx1t)>0 ? jf_efrc * (static_cast<float>(ntrks) / (jf_ntrkv + jf_nvtx1t)) : -1;
 
-	m_sv_scaled_efc->Fill(sv_scaled_efc, eventWeight);
-	m_jf_scaled_efc->Fill(jf_scaled_efc, eventWeight);
+	fill( m_sv_scaled_efc, sv_scaled_efc, eventWeight );
+	fill( m_jf_scaled_efc, jf_scaled_efc, eventWeight );
       }//trkOK
 
     }
@@ -1112,32 +922,32 @@ StatusCode JetHists::execute( const xAOD::IParticle* particle, float eventWeight
       static SG::AuxElement::ConstAccessor< double > jf_pc           ("JetFitterCombNN_pc");
       static SG::AuxElement::ConstAccessor< double > jf_pu           ("JetFitterCombNN_pu");
 
-      if(jf_nVTXAcc.isAvailable       (*btag_info)) m_jf_nVTX           ->Fill(jf_nVTXAcc       (*btag_info), eventWeight);
-      if(jf_nSingleTracks.isAvailable (*btag_info)) m_jf_nSingleTracks  ->Fill(jf_nSingleTracks (*btag_info), eventWeight);
-      if(jf_nTracksAtVtx.isAvailable  (*btag_info)) m_jf_nTracksAtVtx   ->Fill(jf_nTracksAtVtx  (*btag_info), eventWeight);
-      if(jf_mass.isAvailable          (*btag_info)) m_jf_mass           ->Fill(jf_mass          (*btag_info)/1000, eventWeight);
-      if(jf_energyFraction.isAvailable(*btag_info)) m_jf_energyFraction ->Fill(jf_energyFraction(*btag_info), eventWeight);
-      if(jf_significance3d.isAvailable(*btag_info)) m_jf_significance3d ->Fill(jf_significance3d(*btag_info), eventWeight);
+      if(jf_nVTXAcc.isAvailable       (*btag_info)) fill( m_jf_nVTX,           jf_nVTXAcc       (*btag_info), eventWeight );
+      if(jf_nSingleTracks.isAvailable (*btag_info)) fill( m_jf_nSingleTracks,  jf_nSingleTracks (*btag_info), eventWeight );
+      if(jf_nTracksAtVtx.isAvailable  (*btag_info)) fill( m_jf_nTracksAtVtx,   jf_nTracksAtVtx  (*btag_info), eventWeight );
+      if(jf_mass.isAvailable          (*btag_info)) fill( m_jf_mass,           jf_mass          (*btag_info)/1000, eventWeight );
+      if(jf_energyFraction.isAvailable(*btag_info)) fill( m_jf_energyFraction, jf_energyFraction(*btag_info), eventWeight );
+      if(jf_significance3d.isAvailable(*btag_info)) fill( m_jf_significance3d, jf_significance3d(*btag_info), eventWeight );
       if(jf_deltaeta.isAvailable      (*btag_info)){
-	m_jf_deltaeta       ->Fill(jf_deltaeta      (*btag_info), eventWeight);
-	m_jf_deltaeta_l     ->Fill(jf_deltaeta      (*btag_info), eventWeight);
+	fill( m_jf_deltaeta,        jf_deltaeta      (*btag_info), eventWeight );
+	fill( m_jf_deltaeta_l,      jf_deltaeta      (*btag_info), eventWeight );
       }
       if(jf_deltaphi.isAvailable      (*btag_info)){
-	m_jf_deltaR         ->Fill(hypot(jf_deltaphi(*btag_info),jf_deltaeta(*btag_info)), eventWeight);
-	m_jf_deltaphi       ->Fill(jf_deltaphi      (*btag_info), eventWeight);
-	m_jf_deltaphi_l     ->Fill(jf_deltaphi      (*btag_info), eventWeight);
+	fill( m_jf_deltaR,          hypot(jf_deltaphi(*btag_info),jf_deltaeta(*btag_info)), eventWeight );
+	fill( m_jf_deltaphi,        jf_deltaphi      (*btag_info), eventWeight );
+	fill( m_jf_deltaphi_l,      jf_deltaphi      (*btag_info), eventWeight );
       }
-      if(jf_N2Tpar.isAvailable        (*btag_info)) m_jf_N2Tpar         ->Fill(jf_N2Tpar        (*btag_info), eventWeight);
-      if(jf_pb.isAvailable            (*btag_info)) m_jf_pb             ->Fill(jf_pb            (*btag_info), eventWeight);
-      if(jf_pc.isAvailable            (*btag_info)) m_jf_pc             ->Fill(jf_pc            (*btag_info), eventWeight);
-      if(jf_pu.isAvailable            (*btag_info)) m_jf_pu             ->Fill(jf_pu            (*btag_info), eventWeight);
+      if(jf_N2Tpar.isAvailable        (*btag_info)) fill( m_jf_N2Tpar,         jf_N2Tpar        (*btag_info), eventWeight );
+      if(jf_pb.isAvailable            (*btag_info)) fill( m_jf_pb,             jf_pb            (*btag_info), eventWeight );
+      if(jf_pc.isAvailable            (*btag_info)) fill( m_jf_pc,             jf_pc            (*btag_info), eventWeight );
+      if(jf_pu.isAvailable            (*btag_info)) fill( m_jf_pu,             jf_pu            (*btag_info), eventWeight );
 
 
       float jf_mass_unco; btag_info->variable<float>("JetFitter", "massUncorr" , jf_mass_unco);
       float jf_dR_flight; btag_info->variable<float>("JetFitter", "dRFlightDir", jf_dR_flight);
 
-      m_jf_mass_unco->Fill(jf_mass_unco/1000, eventWeight);
-      m_jf_dR_flight->Fill(jf_dR_flight, eventWeight);
+      fill( m_jf_mass_unco, jf_mass_unco/1000, eventWeight );
+      fill( m_jf_dR_flight, jf_dR_flight, eventWeight );
 
 
     }
@@ -1159,15 +969,15 @@ StatusCode JetHists::execute( const xAOD::IParticle* particle, float eventWeight
       static SG::AuxElement::ConstAccessor< float   > sv0_normdistAcc     ("SV0_normdist");
 
 
-      if(sv0_NGTinSvxAcc .isAvailable(*btag_info)) m_sv0_NGTinSvx -> Fill( sv0_NGTinSvxAcc (*btag_info), eventWeight);
-      if(sv0_N2TpairAcc  .isAvailable(*btag_info)) m_sv0_N2Tpair  -> Fill( sv0_N2TpairAcc  (*btag_info), eventWeight);
-      if(sv0_masssvxAcc  .isAvailable(*btag_info)) m_sv0_massvx   -> Fill( sv0_masssvxAcc  (*btag_info)/1000, eventWeight);
-      if(sv0_efracsvxAcc .isAvailable(*btag_info)) m_sv0_efracsvx -> Fill( sv0_efracsvxAcc (*btag_info), eventWeight);
-      if(sv0_normdistAcc .isAvailable(*btag_info)) m_sv0_normdist -> Fill( sv0_normdistAcc (*btag_info), eventWeight);
+      if(sv0_NGTinSvxAcc .isAvailable(*btag_info)) fill( m_sv0_NGTinSvx,  sv0_NGTinSvxAcc (*btag_info), eventWeight );
+      if(sv0_N2TpairAcc  .isAvailable(*btag_info)) fill( m_sv0_N2Tpair,   sv0_N2TpairAcc  (*btag_info), eventWeight );
+      if(sv0_masssvxAcc  .isAvailable(*btag_info)) fill( m_sv0_massvx,    sv0_masssvxAcc  (*btag_info)/1000, eventWeight );
+      if(sv0_efracsvxAcc .isAvailable(*btag_info)) fill( m_sv0_efracsvx,  sv0_efracsvxAcc (*btag_info), eventWeight );
+      if(sv0_normdistAcc .isAvailable(*btag_info)) fill( m_sv0_normdist,  sv0_normdistAcc (*btag_info), eventWeight );
 
       double sv0;
       btag_info->variable<double>("SV0", "significance3D", sv0);
-      m_SV0             ->  Fill( sv0 , eventWeight );
+      fill( m_SV0,              sv0 , eventWeight );
 
 
       //
@@ -1184,23 +994,23 @@ StatusCode JetHists::execute( const xAOD::IParticle* particle, float eventWeight
       static SG::AuxElement::ConstAccessor< float   > sv1_efracsvxAcc     ("SV1_efracsvx");                                                                 /// @brief SV1 : 3D vertex significance
       static SG::AuxElement::ConstAccessor< float   > sv1_normdistAcc     ("SV1_normdist");
 
-      if(sv1_NGTinSvxAcc .isAvailable(*btag_info)) m_sv1_NGTinSvx -> Fill( sv1_NGTinSvxAcc (*btag_info), eventWeight);
-      if(sv1_N2TpairAcc  .isAvailable(*btag_info)) m_sv1_N2Tpair  -> Fill( sv1_N2TpairAcc  (*btag_info), eventWeight);
-      if(sv1_masssvxAcc  .isAvailable(*btag_info)) m_sv1_massvx   -> Fill( sv1_masssvxAcc  (*btag_info)/1000, eventWeight);
-      if(sv1_efracsvxAcc .isAvailable(*btag_info)) m_sv1_efracsvx -> Fill( sv1_efracsvxAcc (*btag_info), eventWeight);
-      if(sv1_normdistAcc .isAvailable(*btag_info)) m_sv1_normdist -> Fill( sv1_normdistAcc (*btag_info), eventWeight);
+      if(sv1_NGTinSvxAcc .isAvailable(*btag_info)) fill( m_sv1_NGTinSvx,  sv1_NGTinSvxAcc (*btag_info), eventWeight );
+      if(sv1_N2TpairAcc  .isAvailable(*btag_info)) fill( m_sv1_N2Tpair,   sv1_N2TpairAcc  (*btag_info), eventWeight );
+      if(sv1_masssvxAcc  .isAvailable(*btag_info)) fill( m_sv1_massvx,    sv1_masssvxAcc  (*btag_info)/1000, eventWeight );
+      if(sv1_efracsvxAcc .isAvailable(*btag_info)) fill( m_sv1_efracsvx,  sv1_efracsvxAcc (*btag_info), eventWeight );
+      if(sv1_normdistAcc .isAvailable(*btag_info)) fill( m_sv1_normdist,  sv1_normdistAcc (*btag_info), eventWeight );
 
       double sv1_pu = -30;  btag_info->variable<double>("SV1", "pu", sv1_pu);
       double sv1_pb = -30;  btag_info->variable<double>("SV1", "pb", sv1_pb);
       double sv1_pc = -30;  btag_info->variable<double>("SV1", "pc", sv1_pc);
 
-      m_SV1_pu         ->  Fill(sv1_pu  , eventWeight );
-      m_SV1_pb         ->  Fill(sv1_pb  , eventWeight );
-      m_SV1_pc         ->  Fill(sv1_pc  , eventWeight );
+      fill( m_SV1_pu,          sv1_pu  , eventWeight );
+      fill( m_SV1_pb,          sv1_pb  , eventWeight );
+      fill( m_SV1_pc,          sv1_pc  , eventWeight );
 
-      m_SV1            ->  Fill( btag_info->calcLLR(sv1_pb,sv1_pu) , eventWeight );
-      m_SV1_c          ->  Fill( btag_info->calcLLR(sv1_pb,sv1_pc) , eventWeight );
-      m_SV1_cu         ->  Fill( btag_info->calcLLR(sv1_pc,sv1_pu) , eventWeight );
+      fill( m_SV1,             btag_info->calcLLR(sv1_pb,sv1_pu) , eventWeight );
+      fill( m_SV1_c,           btag_info->calcLLR(sv1_pb,sv1_pc) , eventWeight );
+      fill( m_SV1_cu,          btag_info->calcLLR(sv1_pc,sv1_pu) , eventWeight );
 
       float sv1_Lxy;        btag_info->variable<float>("SV1", "Lxy"             , sv1_Lxy);
       float sv1_sig3d;      btag_info->variable<float>("SV1", "significance3d"  , sv1_sig3d);
@@ -1208,11 +1018,11 @@ StatusCode JetHists::execute( const xAOD::IParticle* particle, float eventWeight
       float sv1_distmatlay; btag_info->variable<float>("SV1", "dstToMatLay"     , sv1_distmatlay);
       float sv1_dR;         btag_info->variable<float>("SV1", "deltaR"          , sv1_dR );
 
-      m_SV1_Lxy        -> Fill(sv1_Lxy,         eventWeight);
-      m_SV1_sig3d      -> Fill(sv1_sig3d,       eventWeight);
-      m_SV1_L3d        -> Fill(sv1_L3d,         eventWeight);
-      m_SV1_distmatlay -> Fill(sv1_distmatlay,  eventWeight);
-      m_SV1_dR         -> Fill(sv1_dR,          eventWeight);
+      fill( m_SV1_Lxy,         sv1_Lxy,         eventWeight );
+      fill( m_SV1_sig3d,       sv1_sig3d,       eventWeight );
+      fill( m_SV1_L3d,         sv1_L3d,         eventWeight );
+      fill( m_SV1_distmatlay,  sv1_distmatlay,  eventWeight );
+      fill( m_SV1_dR,          sv1_dR,          eventWeight );
 
     }
 
@@ -1240,50 +1050,50 @@ StatusCode JetHists::execute( const xAOD::IParticle* particle, float eventWeight
 
       if(IP2D_gradeOfTracksAcc .isAvailable(*btag_info)){
 	unsigned int nIP2DTracks = IP2D_gradeOfTracksAcc(*btag_info).size();
-	m_nIP2DTracks -> Fill( nIP2DTracks, eventWeight);
-	for(int grade : IP2D_gradeOfTracksAcc(*btag_info))        m_IP2D_gradeOfTracks->Fill(grade, eventWeight);
+	fill( m_nIP2DTracks,  nIP2DTracks, eventWeight );
+	for(int grade : IP2D_gradeOfTracksAcc(*btag_info))        fill( m_IP2D_gradeOfTracks, grade, eventWeight );
       }
 
       if(IP2D_flagFromV0ofTracksAcc .isAvailable(*btag_info)){
-	for(bool flag : IP2D_flagFromV0ofTracksAcc(*btag_info))   m_IP2D_flagFromV0ofTracks->Fill(flag, eventWeight);
+	for(bool flag : IP2D_flagFromV0ofTracksAcc(*btag_info))   fill( m_IP2D_flagFromV0ofTracks, flag, eventWeight );
       }
 
       if(IP2D_valD0wrtPVofTracksAcc .isAvailable(*btag_info)){
-	for(float d0 : IP2D_valD0wrtPVofTracksAcc(*btag_info))    m_IP2D_valD0wrtPVofTracks->Fill(d0, eventWeight);
+	for(float d0 : IP2D_valD0wrtPVofTracksAcc(*btag_info))    fill( m_IP2D_valD0wrtPVofTracks, d0, eventWeight );
       }
 
       if(IP2D_sigD0wrtPVofTracksAcc .isAvailable(*btag_info)){
 	for(float d0Sig : IP2D_sigD0wrtPVofTracksAcc(*btag_info)) {
-	  m_IP2D_sigD0wrtPVofTracks  ->Fill(d0Sig, eventWeight);
-	  m_IP2D_sigD0wrtPVofTracks_l->Fill(d0Sig, eventWeight);
+	  fill( m_IP2D_sigD0wrtPVofTracks,   d0Sig, eventWeight );
+	  fill( m_IP2D_sigD0wrtPVofTracks_l, d0Sig, eventWeight );
 
 
 	}
       }
 
       if(IP2D_weightBofTracksAcc .isAvailable(*btag_info)){
-	for(float weightB : IP2D_weightBofTracksAcc(*btag_info))  m_IP2D_weightBofTracks->Fill(weightB, eventWeight);
+	for(float weightB : IP2D_weightBofTracksAcc(*btag_info))  fill( m_IP2D_weightBofTracks, weightB, eventWeight );
       }
 
       if(IP2D_weightCofTracksAcc .isAvailable(*btag_info)){
-	for(float weightC : IP2D_weightCofTracksAcc(*btag_info))  m_IP2D_weightCofTracks->Fill(weightC, eventWeight);
+	for(float weightC : IP2D_weightCofTracksAcc(*btag_info))  fill( m_IP2D_weightCofTracks, weightC, eventWeight );
       }
 
       if(IP2D_weightUofTracksAcc .isAvailable(*btag_info)){
-	for(float weightU : IP2D_weightUofTracksAcc(*btag_info))  m_IP2D_weightUofTracks->Fill(weightU, eventWeight);
+	for(float weightU : IP2D_weightUofTracksAcc(*btag_info))  fill( m_IP2D_weightUofTracks, weightU, eventWeight );
       }
 
       double ip2_pu = -30;  btag_info->variable<double>("IP2D", "pu", ip2_pu);
       double ip2_pb = -30;  btag_info->variable<double>("IP2D", "pb", ip2_pb);
       double ip2_pc = -30;  btag_info->variable<double>("IP2D", "pc", ip2_pc);
 
-      m_IP2D_pu         ->  Fill(ip2_pu  , eventWeight );
-      m_IP2D_pb         ->  Fill(ip2_pb  , eventWeight );
-      m_IP2D_pc         ->  Fill(ip2_pc  , eventWeight );
+      fill( m_IP2D_pu,          ip2_pu  , eventWeight );
+      fill( m_IP2D_pb,          ip2_pb  , eventWeight );
+      fill( m_IP2D_pc,          ip2_pc  , eventWeight );
 
-      m_IP2D            ->  Fill( btag_info->calcLLR(ip2_pb,ip2_pu) , eventWeight );
-      m_IP2D_c          ->  Fill( btag_info->calcLLR(ip2_pb,ip2_pc) , eventWeight );
-      m_IP2D_cu         ->  Fill( btag_info->calcLLR(ip2_pc,ip2_pu) , eventWeight );
+      fill( m_IP2D,             btag_info->calcLLR(ip2_pb,ip2_pu) , eventWeight );
+      fill( m_IP2D_c,           btag_info->calcLLR(ip2_pb,ip2_pc) , eventWeight );
+      fill( m_IP2D_cu,          btag_info->calcLLR(ip2_pc,ip2_pu) , eventWeight );
 
 
       //
@@ -1311,59 +1121,59 @@ StatusCode JetHists::execute( const xAOD::IParticle* particle, float eventWeight
 
       if(IP3D_gradeOfTracksAcc .isAvailable(*btag_info)){
 	unsigned int nIP3DTracks = IP3D_gradeOfTracksAcc(*btag_info).size();
-	m_nIP3DTracks -> Fill( nIP3DTracks, eventWeight);
-	for(int grade : IP3D_gradeOfTracksAcc(*btag_info))        m_IP3D_gradeOfTracks->Fill(grade, eventWeight);
+	fill( m_nIP3DTracks,  nIP3DTracks, eventWeight );
+	for(int grade : IP3D_gradeOfTracksAcc(*btag_info))        fill( m_IP3D_gradeOfTracks, grade, eventWeight );
       }
 
       if(IP3D_flagFromV0ofTracksAcc .isAvailable(*btag_info)){
-	for(bool flag : IP3D_flagFromV0ofTracksAcc(*btag_info))   m_IP3D_flagFromV0ofTracks->Fill(flag, eventWeight);
+	for(bool flag : IP3D_flagFromV0ofTracksAcc(*btag_info))   fill( m_IP3D_flagFromV0ofTracks, flag, eventWeight );
       }
 
       if(IP3D_valD0wrtPVofTracksAcc .isAvailable(*btag_info)){
-	for(float d0 : IP3D_valD0wrtPVofTracksAcc(*btag_info))    m_IP3D_valD0wrtPVofTracks->Fill(d0, eventWeight);
+	for(float d0 : IP3D_valD0wrtPVofTracksAcc(*btag_info))    fill( m_IP3D_valD0wrtPVofTracks, d0, eventWeight );
       }
 
       if(IP3D_sigD0wrtPVofTracksAcc .isAvailable(*btag_info)){
 	for(float d0Sig : IP3D_sigD0wrtPVofTracksAcc(*btag_info)){
-	  m_IP3D_sigD0wrtPVofTracks  ->Fill(d0Sig, eventWeight);
-	  m_IP3D_sigD0wrtPVofTracks_l->Fill(d0Sig, eventWeight);
+	  fill( m_IP3D_sigD0wrtPVofTracks,   d0Sig, eventWeight );
+	  fill( m_IP3D_sigD0wrtPVofTracks_l, d0Sig, eventWeight );
 	}
       }
 
       if(IP3D_valZ0wrtPVofTracksAcc .isAvailable(*btag_info)){
-	for(float z0 : IP3D_valZ0wrtPVofTracksAcc(*btag_info))    m_IP3D_valZ0wrtPVofTracks->Fill(z0, eventWeight);
+	for(float z0 : IP3D_valZ0wrtPVofTracksAcc(*btag_info))    fill( m_IP3D_valZ0wrtPVofTracks, z0, eventWeight );
       }
 
       if(IP3D_sigZ0wrtPVofTracksAcc .isAvailable(*btag_info)){
 	for(float z0Sig : IP3D_sigZ0wrtPVofTracksAcc(*btag_info)){
-	  m_IP3D_sigZ0wrtPVofTracks  ->Fill(z0Sig, eventWeight);
-	  m_IP3D_sigZ0wrtPVofTracks_l->Fill(z0Sig, eventWeight);
+	  fill( m_IP3D_sigZ0wrtPVofTracks,   z0Sig, eventWeight );
+	  fill( m_IP3D_sigZ0wrtPVofTracks_l, z0Sig, eventWeight );
 	}
       }
 
       if(IP3D_weightBofTracksAcc .isAvailable(*btag_info)){
-	for(float weightB : IP3D_weightBofTracksAcc(*btag_info))  m_IP3D_weightBofTracks->Fill(weightB, eventWeight);
+	for(float weightB : IP3D_weightBofTracksAcc(*btag_info))  fill( m_IP3D_weightBofTracks, weightB, eventWeight );
       }
 
       if(IP3D_weightCofTracksAcc .isAvailable(*btag_info)){
-	for(float weightC : IP3D_weightCofTracksAcc(*btag_info))  m_IP3D_weightCofTracks->Fill(weightC, eventWeight);
+	for(float weightC : IP3D_weightCofTracksAcc(*btag_info))  fill( m_IP3D_weightCofTracks, weightC, eventWeight );
       }
 
       if(IP3D_weightUofTracksAcc .isAvailable(*btag_info)){
-	for(float weightU : IP3D_weightUofTracksAcc(*btag_info))  m_IP3D_weightUofTracks->Fill(weightU, eventWeight);
+	for(float weightU : IP3D_weightUofTracksAcc(*btag_info))  fill( m_IP3D_weightUofTracks, weightU, eventWeight );
       }
 
       double ip3_pu = -30;  btag_info->variable<double>("IP3D", "pu", ip3_pu);
       double ip3_pb = -30;  btag_info->variable<double>("IP3D", "pb", ip3_pb);
       double ip3_pc = -30;  btag_info->variable<double>("IP3D", "pc", ip3_pc);
 
-      m_IP3D_pu         ->  Fill(ip3_pu  , eventWeight );
-      m_IP3D_pb         ->  Fill(ip3_pb  , eventWeight );
-      m_IP3D_pc         ->  Fill(ip3_pc  , eventWeight );
+      fill( m_IP3D_pu,          ip3_pu  , eventWeight );
+      fill( m_IP3D_pb,          ip3_pb  , eventWeight );
+      fill( m_IP3D_pc,          ip3_pc  , eventWeight );
 
-      m_IP3D            ->  Fill( btag_info->calcLLR(ip3_pb,ip3_pu) , eventWeight );
-      m_IP3D_c          ->  Fill( btag_info->calcLLR(ip3_pb,ip3_pc) , eventWeight );
-      m_IP3D_cu         ->  Fill( btag_info->calcLLR(ip3_pc,ip3_pu) , eventWeight );
+      fill( m_IP3D,             btag_info->calcLLR(ip3_pb,ip3_pu) , eventWeight );
+      fill( m_IP3D_c,           btag_info->calcLLR(ip3_pb,ip3_pc) , eventWeight );
+      fill( m_IP3D_cu,          btag_info->calcLLR(ip3_pc,ip3_pu) , eventWeight );
 
 
     }
@@ -1376,7 +1186,7 @@ StatusCode JetHists::execute( const xAOD::IParticle* particle, float eventWeight
   vector<float> chfs = jet->getAttribute< vector<float> >(xAOD::JetAttribute::SumPtTrkPt1000);
   float chf(-1);
   if( pvLoc >= 0 && pvLoc < (int)chfs.size() ) {
-    m_chf ->  Fill( chfs.at( pvLoc ) , eventWeight );
+    fill( m_chf,  chfs.at( pvLoc ) , eventWeight );
   }
   */
 
@@ -1385,34 +1195,22 @@ StatusCode JetHists::execute( const xAOD::IParticle* particle, float eventWeight
   if( m_infoSwitch->m_resolution ) {
     if(m_debug) std::cout << "JetHists: m_resolution " <<std::endl;
     //float ghostTruthPt = jet->getAttribute( xAOD::JetAttribute::GhostTruthPt );
-    float ghostTruthPt = jet->auxdata< float >( "GhostTruthPt" );
-    m_jetGhostTruthPt -> Fill( ghostTruthPt/1e3, eventWeight );
+    float ghostTruthPt = GhostTruthPt( *jet );
+    fill( m_jetGhostTruthPt,  ghostTruthPt/1e3, eventWeight );
     float resolution = jet->pt()/ghostTruthPt - 1;
-    m_jetPt_vs_resolution -> Fill( jet->pt()/1e3, resolution, eventWeight );
-    m_jetGhostTruthPt_vs_resolution -> Fill( ghostTruthPt/1e3, resolution, eventWeight );
+    fill( m_jetPt_vs_resolution,  jet->pt()/1e3, resolution, eventWeight );
+    fill( m_jetGhostTruthPt_vs_resolution,  ghostTruthPt/1e3, resolution, eventWeight );
   }
 
   if( m_infoSwitch->m_substructure ){
     if(m_debug) std::cout << "JetHists: m_substructure " <<std::endl;
-    static SG::AuxElement::ConstAccessor<float> Tau1("Tau1");
-    static SG::AuxElement::ConstAccessor<float> Tau2("Tau2");
-    static SG::AuxElement::ConstAccessor<float> Tau3("Tau3");
-    static SG::AuxElement::ConstAccessor<float> Tau1_wta("Tau1_wta");
-    static SG::AuxElement::ConstAccessor<float> Tau2_wta("Tau2_wta");
-    static SG::AuxElement::ConstAccessor<float> Tau3_wta("Tau3_wta");
-
-    if(Tau1.isAvailable(*jet)) m_tau1->Fill( Tau1(*jet), eventWeight );
-    if(Tau2.isAvailable(*jet)) m_tau2->Fill( Tau2(*jet), eventWeight );
-    if(Tau3.isAvailable(*jet)) m_tau3->Fill( Tau3(*jet), eventWeight );
-    if(Tau1.isAvailable(*jet) && Tau2.isAvailable(*jet)) m_tau21->Fill( Tau2(*jet)/Tau1(*jet), eventWeight );
-    if(Tau2.isAvailable(*jet) && Tau3.isAvailable(*jet)) m_tau32->Fill( Tau3(*jet)/Tau2(*jet), eventWeight );
-    if(Tau1_wta.isAvailable(*jet)) m_tau1_wta->Fill( Tau1_wta(*jet), eventWeight );
-    if(Tau2_wta.isAvailable(*jet)) m_tau2_wta->Fill( Tau2_wta(*jet), eventWeight );
-    if(Tau3_wta.isAvailable(*jet)) m_tau3_wta->Fill( Tau3_wta(*jet), eventWeight );
-    if(Tau1_wta.isAvailable(*jet) && Tau2_wta.isAvailable(*jet)) m_tau21_wta->Fill( Tau2_wta(*jet)/Tau1_wta(*jet), eventWeight );
-    if(Tau2_wta.isAvailable(*jet) && Tau3_wta.isAvailable(*jet)) m_tau32_wta->Fill( Tau3_wta(*jet)/Tau2_wta(*jet), eventWeight );
-
-    m_numConstituents->Fill( jet->numConstituents(), eventWeight );
+
+    if(Tau1.isAvailable(*jet) && Tau2.isAvailable(*jet)) fill( m_tau21, Tau2(*jet)/Tau1(*jet), eventWeight );
+    if(Tau2.isAvailable(*jet) && Tau3.isAvailable(*jet)) fill( m_tau32, Tau3(*jet)/Tau2(*jet), eventWeight );
+    if(Tau1_wta.isAvailable(*jet) && Tau2_wta.isAvailable(*jet)) fill( m_tau21_wta, Tau2_wta(*jet)/Tau1_wta(*jet), eventWeight );
+    if(Tau2_wta.isAvailable(*jet) && Tau3_wta.isAvailable(*jet)) fill( m_tau32_wta, Tau3_wta(*jet)/Tau2_wta(*jet), eventWeight );
+
+    fill( m_numConstituents, jet->numConstituents(), eventWeight );
 
   }
 
@@ -1423,7 +1221,7 @@ StatusCode JetHists::execute( const xAOD::IParticle* particle, float eventWeight
     const vector<const xAOD::TrackParticle*> matchedTracks = jet->auxdata< vector<const xAOD::TrackParticle*>  >(m_infoSwitch->m_trackName);
     const xAOD::Vertex *pvx  = jet->auxdata<const xAOD::Vertex*>(m_infoSwitch->m_trackName+"_vtx");
 
-    m_nTrk->Fill(matchedTracks.size(), eventWeight);
+    fill( m_nTrk, matchedTracks.size(), eventWeight );
 
     if(m_debug) std::cout << "Track Size " << matchedTracks.size() << std::endl;
     for(auto& trkPtr: matchedTracks){
@@ -1432,9 +1230,9 @@ StatusCode JetHists::execute( const xAOD::IParticle* particle, float eventWeight
   }
 
   if(  m_infoSwitch->m_byEta ){
-    if (fabs(jet->eta()) < 1)           m_jetPt_eta_0_1   -> Fill(jet->pt()/1e3, eventWeight);
-    else if ( fabs(jet->eta()) < 2 ){   m_jetPt_eta_1_2   -> Fill(jet->pt()/1e3, eventWeight); m_jetPt_eta_1_2p5 -> Fill(jet->pt()/1e3, eventWeight);}
-    else if ( fabs(jet->eta()) < 2.5 ){ m_jetPt_eta_2_2p5 -> Fill(jet->pt()/1e3, eventWeight); m_jetPt_eta_1_2p5 -> Fill(jet->pt()/1e3, eventWeight);}
+    if (fabs(jet->eta()) < 1)           fill( m_jetPt_eta_0_1,    jet->pt()/1e3, eventWeight );
+    else if ( fabs(jet->eta()) < 2 ){   fill( m_jetPt_eta_1_2,    jet->pt()/1e3, eventWeight ); fill( m_jetPt_eta_1_2p5,  jet->pt()/1e3, eventWeight );}
+    else if ( fabs(jet->eta()) < 2.5 ){ fill( m_jetPt_eta_2_2p5,  jet->pt()/1e3, eventWeight ); fill( m_jetPt_eta_1_2p5,  jet->pt()/1e3, eventWeight );}
   }
 
   if(  m_infoSwitch->m_onlineBS ){
@@ -1450,14 +1248,14 @@ StatusCode JetHists::execute( const xAOD::IParticle* particle, float eventWeight
       bs_online_vz = m_onlineBSTool.getOnlineBSInfo(eventInfo, xAH::OnlineBeamSpotTool::BSData::BSz);
     }
 
-    m_bs_online_vy -> Fill( bs_online_vy , eventWeight);
-    m_bs_online_vx -> Fill( bs_online_vx , eventWeight);
-    m_bs_online_vz   -> Fill( bs_online_vz , eventWeight);
-    m_bs_online_vz_l -> Fill( bs_online_vz , eventWeight);
+    fill( m_bs_online_vy,  bs_online_vy , eventWeight );
+    fill( m_bs_online_vx,  bs_online_vx , eventWeight );
+    fill( m_bs_online_vz,    bs_online_vz , eventWeight );
+    fill( m_bs_online_vz_l,  bs_online_vz , eventWeight );
 
-    if (fabs(bs_online_vz) < 1)          { m_eta_bs_online_vz_0_1   -> Fill( jet->eta(), eventWeight); }
-    else if ( fabs(bs_online_vz) < 1.5 ) { m_eta_bs_online_vz_1_1p5 -> Fill( jet->eta(), eventWeight); }
-    else if ( fabs(bs_online_vz) < 2   ) { m_eta_bs_online_vz_1p5_2 -> Fill( jet->eta(), eventWeight); }
+    if (fabs(bs_online_vz) < 1)          { fill( m_eta_bs_online_vz_0_1,    jet->eta(), eventWeight ); }
+    else if ( fabs(bs_online_vz) < 1.5 ) { fill( m_eta_bs_online_vz_1_1p5,  jet->eta(), eventWeight ); }
+    else if ( fabs(bs_online_vz) < 2   ) { fill( m_eta_bs_online_vz_1p5_2,  jet->eta(), eventWeight ); }
 
 
 
@@ -1466,8 +1264,8 @@ StatusCode JetHists::execute( const xAOD::IParticle* particle, float eventWeight
       uint32_t runNumber = eventInfo->runNumber();
 
       if( fabs(bs_online_vz) < 900){
-	m_lumiB_runN_bs_online_vz -> Fill(lumiBlock, runNumber, eventWeight * bs_online_vz);
-	m_lumiB_runN_bs_den       -> Fill(lumiBlock, runNumber, eventWeight );
+	fill( m_lumiB_runN_bs_online_vz,  lumiBlock, runNumber, eventWeight * bs_online_vz );
+	fill( m_lumiB_runN_bs_den,        lumiBlock, runNumber, eventWeight );
       }
 
     }
@@ -1479,17 +1277,17 @@ StatusCode JetHists::execute( const xAOD::IParticle* particle, float eventWeight
 
     // Use of vtxClass is new, hadDummyPV is old but need backward compatibility.
     char vtxClass = jet->auxdata< char >("hadDummyPV");
-    if( vtxClass == '0')  m_vtxClass -> Fill(0.0, eventWeight);
-    if( vtxClass == '1')  m_vtxClass -> Fill(1.0, eventWeight);
-    if( vtxClass == '2')  m_vtxClass -> Fill(2.0, eventWeight);
+    if( vtxClass == '0')  fill( m_vtxClass,  0.0, eventWeight );
+    if( vtxClass == '1')  fill( m_vtxClass,  1.0, eventWeight );
+    if( vtxClass == '2')  fill( m_vtxClass,  2.0, eventWeight );
 
     if(m_infoSwitch->m_hltVtxComp){
 
-      if(online_pvx)  m_vtxOnlineValid ->Fill(1.0, eventWeight);
-      else            m_vtxOnlineValid ->Fill(0.0, eventWeight);
+      if(online_pvx)  fill( m_vtxOnlineValid, 1.0, eventWeight );
+      else            fill( m_vtxOnlineValid, 0.0, eventWeight );
 
-      if(offline_pvx) m_vtxOfflineValid->Fill(1.0, eventWeight);
-      else            m_vtxOfflineValid->Fill(0.0, eventWeight);
+      if(offline_pvx) fill( m_vtxOfflineValid, 1.0, eventWeight );
+      else            fill( m_vtxOfflineValid, 0.0, eventWeight );
 
 
       //if(hadDummyPV)  m_vtxClass ->Fill(1.0, eventWeight);
@@ -1505,35 +1303,35 @@ StatusCode JetHists::execute( const xAOD::IParticle* particle, float eventWeight
 	  online_z0_raw = 0;
 	}
 
-	m_vtx_offline_x0    -> Fill(offline_pvx->x(), eventWeight);
-	m_vtx_online_x0     -> Fill(online_pvx->x(), eventWeight);
-	m_vtx_online_x0_raw -> Fill(online_x0_raw, eventWeight);
+	fill( m_vtx_offline_x0,     offline_pvx->x(), eventWeight );
+	fill( m_vtx_online_x0,      online_pvx->x(), eventWeight );
+	fill( m_vtx_online_x0_raw,  online_x0_raw, eventWeight );
 	float vtxDiffx0 = online_pvx->x() - offline_pvx->x();
-	m_vtxDiffx0  ->Fill(vtxDiffx0, eventWeight);
-	m_vtxDiffx0_l->Fill(vtxDiffx0, eventWeight);
+	fill( m_vtxDiffx0,   vtxDiffx0, eventWeight );
+	fill( m_vtxDiffx0_l, vtxDiffx0, eventWeight );
 
-	m_vtx_offline_y0    -> Fill(offline_pvx->y(), eventWeight);
-	m_vtx_online_y0     -> Fill(online_pvx->y(), eventWeight);
-	m_vtx_online_y0_raw -> Fill(online_y0_raw, eventWeight);
+	fill( m_vtx_offline_y0,     offline_pvx->y(), eventWeight );
+	fill( m_vtx_online_y0,      online_pvx->y(), eventWeight );
+	fill( m_vtx_online_y0_raw,  online_y0_raw, eventWeight );
 	float vtxDiffy0 = online_pvx->y() - offline_pvx->y();
-	m_vtxDiffy0  ->Fill(vtxDiffy0, eventWeight);
-	m_vtxDiffy0_l->Fill(vtxDiffy0, eventWeight);
+	fill( m_vtxDiffy0,   vtxDiffy0, eventWeight );
+	fill( m_vtxDiffy0_l, vtxDiffy0, eventWeight );
 
-	m_vtx_offline_z0    -> Fill(offline_pvx->z(), eventWeight);
-	m_vtx_online_z0     -> Fill(online_pvx->z(), eventWeight);
-	m_vtx_online_z0_raw -> Fill(online_z0_raw, eventWeight);
+	fill( m_vtx_offline_z0,     offline_pvx->z(), eventWeight );
+	fill( m_vtx_online_z0,      online_pvx->z(), eventWeight );
+	fill( m_vtx_online_z0_raw,  online_z0_raw, eventWeight );
 	float vtxDiffz0     = online_pvx->z() - offline_pvx->z();
 	float vtxDiffz0_raw = online_z0_raw - offline_pvx->z();
-	m_vtxDiffz0  ->Fill(vtxDiffz0, eventWeight);
-	m_vtxDiffz0_m->Fill(vtxDiffz0, eventWeight);
-	m_vtxDiffz0_s->Fill(vtxDiffz0, eventWeight);
+	fill( m_vtxDiffz0,   vtxDiffz0, eventWeight );
+	fill( m_vtxDiffz0_m, vtxDiffz0, eventWeight );
+	fill( m_vtxDiffz0_s, vtxDiffz0, eventWeight );
 
-	m_vtxDiffz0_s_vs_vtx_offline_z0->Fill(offline_pvx->z(), vtxDiffz0, eventWeight);
-	m_vtxDiffz0_vs_vtx_offline_z0  ->Fill(offline_pvx->z(), vtxDiffz0, eventWeight);
-	m_vtxDiffz0_s_vs_vtxDiffx0      ->Fill(vtxDiffx0, vtxDiffz0, eventWeight);
-	m_vtxDiffz0_s_vs_vtxDiffy0      ->Fill(vtxDiffy0, vtxDiffz0, eventWeight);
+	fill( m_vtxDiffz0_s_vs_vtx_offline_z0, offline_pvx->z(), vtxDiffz0, eventWeight );
+	fill( m_vtxDiffz0_vs_vtx_offline_z0,   offline_pvx->z(), vtxDiffz0, eventWeight );
+	fill( m_vtxDiffz0_s_vs_vtxDiffx0,       vtxDiffx0, vtxDiffz0, eventWeight );
+	fill( m_vtxDiffz0_s_vs_vtxDiffy0,       vtxDiffy0, vtxDiffz0, eventWeight );
 
-	m_vtxClass_vs_jetPt        ->Fill(jet->pt()/1e3, bool(vtxClass), eventWeight);
+	fill( m_vtxClass_vs_jetPt,         jet->pt()/1e3, bool(vtxClass), eventWeight );
 
 	m_vtx_online_y0_vs_vtx_online_z0 -> Fill(online_pvx->z(), online_pvx->y(), eventWeight);
 	m_vtx_online_x0_vs_vtx_online_z0 -> Fill(online_pvx->z(), online_pvx->x(), eventWeight);
@@ -1568,9 +1366,9 @@ StatusCode JetHists::execute( const xAOD::IParticle* particle, float eventWeight
 	if(m_infoSwitch->m_lumiB_runN){
 	  uint32_t lumiBlock = eventInfo->lumiBlock();
 	  uint32_t runNumber = eventInfo->runNumber();
-	  m_lumiB_runN              -> Fill(lumiBlock, runNumber, eventWeight);
-	  m_lumiB_runN_vtxClass     -> Fill(lumiBlock, runNumber, eventWeight * vtxClass);
-	  m_lumiB_runN_lumiB        -> Fill(lumiBlock, runNumber, eventWeight * lumiBlock);
+	  fill( m_lumiB_runN,               lumiBlock, runNumber, eventWeight );
+	  fill( m_lumiB_runN_vtxClass,      lumiBlock, runNumber, eventWeight * vtxClass );
+	  fill( m_lumiB_runN_lumiB,         lumiBlock, runNumber, eventWeight * lumiBlock );
 
 
 	//if(offline_pvx && online_pvx){
@@ -1605,15 +1403,15 @@ StatusCode JetHists::execute( const xAH::Particle* particle, float eventWeight,
       return StatusCode::FAILURE;
     }
 
+  for( size_t i = 0; i < m_variableHists.size(); ++i ) {
+    if( m_variableMembers[i] ) fill( m_variableHists[i], jet->*m_variableMembers[i], eventWeight );
+  }
+  for( size_t i = 0; i < m_intVariableHists.size(); ++i ) {
+    if( m_intVariableMembers[i] ) fill( m_intVariableHists[i], jet->*m_intVariableMembers[i], eventWeight );
+  }
+
   if(m_infoSwitch->m_clean)
     {
-      m_jetTime                   ->Fill(jet->Timing                    ,eventWeight);
-      m_LArQuality                ->Fill(jet->LArQuality                ,eventWeight);
-      m_hecq                      ->Fill(jet->HECQuality                ,eventWeight);
-      m_negE                      ->Fill(jet->NegativeE                 ,eventWeight);
-      m_avLArQF                   ->Fill(jet->AverageLArQF              ,eventWeight);
-      m_bchCorrCell               ->Fill(jet->BchCorrCell               ,eventWeight);
-      m_N90Const                  ->Fill(jet->N90Constituents           ,eventWeight);
       //m_LArQmean                  ->Fill(jet->AverageLArQF/65535        ,eventWeight);
       //m_LArBadHVEFrac             ->Fill(jet->LArBadHVEFrac             ,eventWeight);
       //m_LArBadHVNCell             ->Fill(jet->LArBadHVNCell             ,eventWeight);
@@ -1632,9 +1430,6 @@ StatusCode JetHists::execute( const xAH::Particle* particle, float eventWeight,
 
   if(m_infoSwitch->m_energy)
     {
-      m_HECf              ->Fill(jet->HECFrac,              eventWeight);
-      m_EMf               ->Fill(jet->EMFrac,               eventWeight);
-      m_centroidR         ->Fill(jet->CentroidR,            eventWeight);
       //m_FracSamplingMax      ->Fill(jet->FracSamplingMax,      eventWeight);
       //m_FracSamplingMaxIndex ->Fill(jet->FracSamplingMaxIndex, eventWeight);
       //m_LowEtConstituentsFrac->Fill(jet->LowEtConstituentsFrac,eventWeight);
@@ -1664,7 +1459,7 @@ StatusCode JetHists::execute( const xAH::Particle* particle, float eventWeight,
 
   if(m_infoSwitch->m_JVC)
     {
-      m_JVC->Fill(jet->JVC, eventWeight);
+      fill( m_JVC, jet->JVC, eventWeight );
     }
 
   if(m_infoSwitch->m_flavTag || m_infoSwitch->m_flavTagHLT)
@@ -1675,10 +1470,10 @@ StatusCode JetHists::execute( const xAH::Particle* particle, float eventWeight,
 
       float MV2c20 = jet->MV2c20;
 
-      m_MV2c00                    ->Fill(jet->MV2c00               , eventWeight);
-      m_MV2c10                    ->Fill(jet->MV2c10               , eventWeight);
-      m_MV2c20                    ->Fill(jet->MV2c20               , eventWeight);
-      m_MV2c20_l                  ->Fill(MV2c20                    , eventWeight);
+      fill( m_MV2c00,                     jet->MV2c00               , eventWeight );
+      fill( m_MV2c10,                     jet->MV2c10               , eventWeight );
+      fill( m_MV2c20,                     jet->MV2c20               , eventWeight );
+      fill( m_MV2c20_l,                   MV2c20                    , eventWeight );
       //      h_MV2                       ->Fill(jet->MV2                  , eventWeight);
 
       if(m_infoSwitch->m_vsLumiBlock && eventInfo){
@@ -1712,7 +1507,7 @@ StatusCode JetHists::execute( const xAH::Particle* particle, float eventWeight,
 
       }
 
-      m_COMB                      ->Fill(jet->SV1IP3D              , eventWeight);
+      fill( m_COMB,                       jet->SV1IP3D              , eventWeight );
       //m_JetFitter               ->Fill(jet->JetFitter            , eventWeight);
 
 //
@@ -1721,9 +1516,9 @@ StatusCode JetHists::execute( const xAH::Particle* particle, float eventWeight,
     }
 
   if(  m_infoSwitch->m_byEta ){
-    if (fabs(jet->p4.Eta()) < 1)           m_jetPt_eta_0_1   -> Fill(jet->p4.Pt(), eventWeight);
-    else if ( fabs(jet->p4.Eta()) < 2 )   {m_jetPt_eta_1_2   -> Fill(jet->p4.Pt(), eventWeight); m_jetPt_eta_1_2p5 -> Fill(jet->p4.Pt(), eventWeight);}
-    else if ( fabs(jet->p4.Eta()) < 2.5 ) {m_jetPt_eta_2_2p5 -> Fill(jet->p4.Pt(), eventWeight); m_jetPt_eta_1_2p5 -> Fill(jet->p4.Pt(), eventWeight);}
+    if (fabs(jet->p4.Eta()) < 1)           fill( m_jetPt_eta_0_1,    jet->p4.Pt(), eventWeight );
+    else if ( fabs(jet->p4.Eta()) < 2 )   {fill( m_jetPt_eta_1_2,    jet->p4.Pt(), eventWeight ); fill( m_jetPt_eta_1_2p5,  jet->p4.Pt(), eventWeight );}
+    else if ( fabs(jet->p4.Eta()) < 2.5 ) {fill( m_jetPt_eta_2_2p5,  jet->p4.Pt(), eventWeight ); fill( m_jetPt_eta_1_2p5,  jet->p4.Pt(), eventWeight );}
   }
 
   if(  m_infoSwitch->m_onlineBS ){
@@ -1741,21 +1536,21 @@ StatusCode JetHists::execute( const xAH::Particle* particle, float eventWeight,
 
       }
 
-      m_bs_online_vx -> Fill( bs_online_vx , eventWeight);
-      m_bs_online_vy -> Fill( bs_online_vy , eventWeight);
-      m_bs_online_vz   -> Fill( bs_online_vz , eventWeight);
-      m_bs_online_vz_l -> Fill( bs_online_vz , eventWeight);
+      fill( m_bs_online_vx,  bs_online_vx , eventWeight );
+      fill( m_bs_online_vy,  bs_online_vy , eventWeight );
+      fill( m_bs_online_vz,    bs_online_vz , eventWeight );
+      fill( m_bs_online_vz_l,  bs_online_vz , eventWeight );
 
-      if (fabs(bs_online_vz) < 1)          { m_eta_bs_online_vz_0_1   -> Fill( jet->p4.Eta(), eventWeight); }
-      else if ( fabs(bs_online_vz) < 1.5 ) { m_eta_bs_online_vz_1_1p5 -> Fill( jet->p4.Eta(), eventWeight); }
-      else if ( fabs(bs_online_vz) < 2   ) { m_eta_bs_online_vz_1p5_2 -> Fill( jet->p4.Eta(), eventWeight); }
+      if (fabs(bs_online_vz) < 1)          { fill( m_eta_bs_online_vz_0_1,    jet->p4.Eta(), eventWeight ); }
+      else if ( fabs(bs_online_vz) < 1.5 ) { fill( m_eta_bs_online_vz_1_1p5,  jet->p4.Eta(), eventWeight ); }
+      else if ( fabs(bs_online_vz) < 2   ) { fill( m_eta_bs_online_vz_1p5_2,  jet->p4.Eta(), eventWeight ); }
 
       if(m_infoSwitch->m_lumiB_runN){
 	uint32_t lumiBlock = eventInfo->m_lumiBlock;
 	uint32_t runNumber = eventInfo->m_runNumber;
 	if( fabs(bs_online_vz) < 900 ){
-	    m_lumiB_runN_bs_online_vz  -> Fill(lumiBlock, runNumber, eventWeight * bs_online_vz);
-	    m_lumiB_runN_bs_den        -> Fill(lumiBlock, runNumber, eventWeight );
+	    fill( m_lumiB_runN_bs_online_vz,   lumiBlock, runNumber, eventWeight * bs_online_vz );
+	    fill( m_lumiB_runN_bs_den,         lumiBlock, runNumber, eventWeight );
 	}
 
 
@@ -1767,7 +1562,7 @@ StatusCode JetHists::execute( const xAH::Particle* particle, float eventWeight,
 
       // vtxHadDummy is an old var. I am moving to a new variable name here.
       float vtxClass=jet->vtxHadDummy;
-      m_vtxClass               ->Fill(vtxClass          , eventWeight);
+      fill( m_vtxClass,                vtxClass          , eventWeight );
 
       if(m_infoSwitch->m_hltVtxComp){
 
@@ -1787,38 +1582,38 @@ StatusCode JetHists::execute( const xAH::Particle* particle, float eventWeight,
 
 	float vtxDiffx0      = jet->vtx_online_x0 - jet->vtx_offline_x0;
 
-	m_vtx_offline_x0             ->Fill(jet->vtx_offline_x0 , eventWeight);
-	m_vtx_online_x0             ->Fill(jet->vtx_online_x0 , eventWeight);
-	m_vtx_online_x0_raw         ->Fill(online_x0_raw      , eventWeight);
-	m_vtxDiffx0                 ->Fill(vtxDiffx0          , eventWeight);
-	m_vtxDiffx0_l               ->Fill(vtxDiffx0          , eventWeight);
+	fill( m_vtx_offline_x0,              jet->vtx_offline_x0 , eventWeight );
+	fill( m_vtx_online_x0,              jet->vtx_online_x0 , eventWeight );
+	fill( m_vtx_online_x0_raw,          online_x0_raw      , eventWeight );
+	fill( m_vtxDiffx0,                  vtxDiffx0          , eventWeight );
+	fill( m_vtxDiffx0_l,                vtxDiffx0          , eventWeight );
 
-	m_vtx_offline_y0             ->Fill(jet->vtx_offline_y0 , eventWeight);
-	m_vtx_online_y0             ->Fill(jet->vtx_online_y0 , eventWeight);
-	m_vtx_online_y0_raw         ->Fill(online_y0_raw      , eventWeight);
+	fill( m_vtx_offline_y0,              jet->vtx_offline_y0 , eventWeight );
+	fill( m_vtx_online_y0,              jet->vtx_online_y0 , eventWeight );
+	fill( m_vtx_online_y0_raw,          online_y0_raw      , eventWeight );
 	float vtxDiffy0 = jet->vtx_online_y0 - jet->vtx_offline_y0;
-	m_vtxDiffy0                 ->Fill(vtxDiffy0          , eventWeight);
-	m_vtxDiffy0_l               ->Fill(vtxDiffy0          , eventWeight);
-
-	m_vtx_offline_z0             ->Fill(jet->vtx_offline_z0 , eventWeight);
-	m_vtx_online_z0              ->Fill(jet->vtx_online_z0 , eventWeight);
-	m_vtx_offline_z0_s           ->Fill(jet->vtx_offline_z0 , eventWeight);
-	m_vtx_online_z0_s            ->Fill(jet->vtx_online_z0 , eventWeight);
-	m_vtx_online_z0_raw          ->Fill(online_z0_raw      , eventWeight);
+	fill( m_vtxDiffy0,                  vtxDiffy0          , eventWeight );
+	fill( m_vtxDiffy0_l,                vtxDiffy0          , eventWeight );
+
+	fill( m_vtx_offline_z0,              jet->vtx_offline_z0 , eventWeight );
+	fill( m_vtx_online_z0,               jet->vtx_online_z0 , eventWeight );
+	fill( m_vtx_offline_z0_s,            jet->vtx_offline_z0 , eventWeight );
+	fill( m_vtx_online_z0_s,             jet->vtx_online_z0 , eventWeight );
+	fill( m_vtx_online_z0_raw,           online_z0_raw      , eventWeight );
 	float vtxDiffz0     = jet->vtx_online_z0  - jet->vtx_offline_z0;
 	float vtxDiffz0_raw = online_z0_raw       - jet->vtx_offline_z0;
-	m_vtxDiffz0                 ->Fill(vtxDiffz0          , eventWeight);
-	m_vtxDiffz0_m               ->Fill(vtxDiffz0          , eventWeight);
-	m_vtxDiffz0_s               ->Fill(vtxDiffz0          , eventWeight);
+	fill( m_vtxDiffz0,                  vtxDiffz0          , eventWeight );
+	fill( m_vtxDiffz0_m,                vtxDiffz0          , eventWeight );
+	fill( m_vtxDiffz0_s,                vtxDiffz0          , eventWeight );
 	//m_vtx_offline_z                 ->Fill(jet->vtx_offline_z0          , eventWeight);
 	//m_vtx_online_z                 ->Fill(jet->vtx_online_z0          , eventWeight);
 
-	m_vtxDiffz0_s_vs_vtx_offline_z0->Fill(jet->vtx_offline_z0, vtxDiffz0, eventWeight);
-	m_vtxDiffz0_vs_vtx_offline_z0  ->Fill(jet->vtx_offline_z0, vtxDiffz0, eventWeight);
-	m_vtxDiffz0_s_vs_vtxDiffx0      ->Fill(vtxDiffx0, vtxDiffz0, eventWeight);
-	m_vtxDiffz0_s_vs_vtxDiffy0      ->Fill(vtxDiffy0, vtxDiffz0, eventWeight);
+	fill( m_vtxDiffz0_s_vs_vtx_offline_z0, jet->vtx_offline_z0, vtxDiffz0, eventWeight );
+	fill( m_vtxDiffz0_vs_vtx_offline_z0,   jet->vtx_offline_z0, vtxDiffz0, eventWeight );
+	fill( m_vtxDiffz0_s_vs_vtxDiffx0,       vtxDiffx0, vtxDiffz0, eventWeight );
+	fill( m_vtxDiffz0_s_vs_vtxDiffy0,       vtxDiffy0, vtxDiffz0, eventWeight );
 
-	m_vtxClass_vs_jetPt   ->Fill(jet->p4.Pt(), bool(vtxClass),    eventWeight);
+	fill( m_vtxClass_vs_jetPt,    jet->p4.Pt(), bool(vtxClass),    eventWeight );
 
 	m_vtx_online_y0_vs_vtx_online_z0 ->Fill(jet->vtx_online_z0, jet->vtx_online_y0, eventWeight);
 	m_vtx_online_x0_vs_vtx_online_z0 ->Fill(jet->vtx_online_z0, jet->vtx_online_x0, eventWeight);
@@ -1851,9 +1646,9 @@ StatusCode JetHists::execute( const xAH::Particle* particle, float eventWeight,
 	if(m_infoSwitch->m_lumiB_runN){
 	  uint32_t lumiBlock = eventInfo->m_lumiBlock;
 	  uint32_t runNumber = eventInfo->m_runNumber;
-	  m_lumiB_runN               -> Fill(lumiBlock, runNumber, eventWeight);
-	  m_lumiB_runN_vtxClass      -> Fill(lumiBlock, runNumber, eventWeight * vtxClass);
-	  m_lumiB_runN_lumiB      -> Fill(lumiBlock, runNumber, eventWeight*lumiBlock);
+	  fill( m_lumiB_runN,                lumiBlock, runNumber, eventWeight );
+	  fill( m_lumiB_runN_vtxClass,       lumiBlock, runNumber, eventWeight * vtxClass );
+	  fill( m_lumiB_runN_lumiB,       lumiBlock, runNumber, eventWeight*lumiBlock );
 
 	}
 
@@ -1863,52 +1658,52 @@ StatusCode JetHists::execute( const xAH::Particle* particle, float eventWeight,
 
   if(m_infoSwitch->m_jetFitterDetails){
 
-    m_jf_nVTX           ->Fill(jet->JetFitter_nVTX           ,      eventWeight);
-    m_jf_nSingleTracks  ->Fill(jet->JetFitter_nSingleTracks  ,      eventWeight);
-    m_jf_nTracksAtVtx   ->Fill(jet->JetFitter_nTracksAtVtx   ,      eventWeight);
-    m_jf_mass           ->Fill(jet->JetFitter_mass           /1000, eventWeight);
-    m_jf_energyFraction ->Fill(jet->JetFitter_energyFraction ,      eventWeight);
-    m_jf_significance3d ->Fill(jet->JetFitter_significance3d ,      eventWeight);
-    m_jf_deltaeta       ->Fill(jet->JetFitter_deltaeta       ,      eventWeight);
-    m_jf_deltaeta_l     ->Fill(jet->JetFitter_deltaeta       ,      eventWeight);
-    m_jf_deltaR         ->Fill(hypot(jet->JetFitter_deltaphi         ,jet->JetFitter_deltaeta), eventWeight);
-    m_jf_deltaphi       ->Fill(jet->JetFitter_deltaphi       ,      eventWeight);
-    m_jf_deltaphi_l     ->Fill(jet->JetFitter_deltaphi       ,      eventWeight);
-    m_jf_N2Tpar         ->Fill(jet->JetFitter_N2Tpar         ,      eventWeight);
+    fill( m_jf_nVTX,            jet->JetFitter_nVTX           ,      eventWeight );
+    fill( m_jf_nSingleTracks,   jet->JetFitter_nSingleTracks  ,      eventWeight );
+    fill( m_jf_nTracksAtVtx,    jet->JetFitter_nTracksAtVtx   ,      eventWeight );
+    fill( m_jf_mass,            jet->JetFitter_mass           /1000, eventWeight );
+    fill( m_jf_energyFraction,  jet->JetFitter_energyFraction ,      eventWeight );
+    fill( m_jf_significance3d,  jet->JetFitter_significance3d ,      eventWeight );
+    fill( m_jf_deltaeta,        jet->JetFitter_deltaeta       ,      eventWeight );
+    fill( m_jf_deltaeta_l,      jet->JetFitter_deltaeta       ,      eventWeight );
+    fill( m_jf_deltaR,          hypot(jet->JetFitter_deltaphi         ,jet->JetFitter_deltaeta), eventWeight );
+    fill( m_jf_deltaphi,        jet->JetFitter_deltaphi       ,      eventWeight );
+    fill( m_jf_deltaphi_l,      jet->JetFitter_deltaphi       ,      eventWeight );
+    fill( m_jf_N2Tpar,          jet->JetFitter_N2Tpar         ,      eventWeight );
   }
 
   if(m_infoSwitch->m_svDetails){
     //
     // SV0
     //
-    m_sv0_NGTinSvx -> Fill( jet->sv0_NGTinSvx, eventWeight);
-    m_sv0_N2Tpair  -> Fill( jet->sv0_N2Tpair , eventWeight);
-    m_sv0_massvx   -> Fill( jet->sv0_massvx  /1000, eventWeight);
-    m_sv0_efracsvx -> Fill( jet->sv0_efracsvx, eventWeight);
-    m_sv0_normdist -> Fill( jet->sv0_normdist, eventWeight);
+    fill( m_sv0_NGTinSvx,  jet->sv0_NGTinSvx, eventWeight );
+    fill( m_sv0_N2Tpair,   jet->sv0_N2Tpair , eventWeight );
+    fill( m_sv0_massvx,    jet->sv0_massvx  /1000, eventWeight );
+    fill( m_sv0_efracsvx,  jet->sv0_efracsvx, eventWeight );
+    fill( m_sv0_normdist,  jet->sv0_normdist, eventWeight );
 
     //
     // SV1
     //
-    m_sv1_NGTinSvx -> Fill( jet->sv1_NGTinSvx, eventWeight);
-    m_sv1_N2Tpair  -> Fill( jet->sv1_N2Tpair , eventWeight);
-    m_sv1_massvx   -> Fill( jet->sv1_massvx  /1000, eventWeight);
-    m_sv1_efracsvx -> Fill( jet->sv1_efracsvx, eventWeight);
-    m_sv1_normdist -> Fill( jet->sv1_normdist, eventWeight);
+    fill( m_sv1_NGTinSvx,  jet->sv1_NGTinSvx, eventWeight );
+    fill( m_sv1_N2Tpair,   jet->sv1_N2Tpair , eventWeight );
+    fill( m_sv1_massvx,    jet->sv1_massvx  /1000, eventWeight );
+    fill( m_sv1_efracsvx,  jet->sv1_efracsvx, eventWeight );
+    fill( m_sv1_normdist,  jet->sv1_normdist, eventWeight );
 
 
-    m_SV1_pu         ->  Fill(jet->sv1_pu  , eventWeight );
-    m_SV1_pb         ->  Fill(jet->sv1_pb  , eventWeight );
-    m_SV1_pc         ->  Fill(jet->sv1_pc  , eventWeight );
+    fill( m_SV1_pu,          jet->sv1_pu  , eventWeight );
+    fill( m_SV1_pb,          jet->sv1_pb  , eventWeight );
+    fill( m_SV1_pc,          jet->sv1_pc  , eventWeight );
 
-    m_SV1_c          ->  Fill(jet->sv1_c  , eventWeight );
-    m_SV1_cu         ->  Fill(jet->sv1_cu , eventWeight );
+    fill( m_SV1_c,           jet->sv1_c  , eventWeight );
+    fill( m_SV1_cu,          jet->sv1_cu , eventWeight );
 
-    m_SV1_Lxy        -> Fill(jet->sv1_Lxy,         eventWeight);
-    m_SV1_sig3d      -> Fill(jet->sv1_sig3d,       eventWeight);
-    m_SV1_L3d        -> Fill(jet->sv1_L3d,         eventWeight);
-    m_SV1_distmatlay -> Fill(jet->sv1_distmatlay,  eventWeight);
-    m_SV1_dR         -> Fill(jet->sv1_dR,          eventWeight);
+    fill( m_SV1_Lxy,         jet->sv1_Lxy,         eventWeight );
+    fill( m_SV1_sig3d,       jet->sv1_sig3d,       eventWeight );
+    fill( m_SV1_L3d,         jet->sv1_L3d,         eventWeight );
+    fill( m_SV1_distmatlay,  jet->sv1_distmatlay,  eventWeight );
+    fill( m_SV1_dR,          jet->sv1_dR,          eventWeight );
 
   }
 
@@ -1917,74 +1712,74 @@ StatusCode JetHists::execute( const xAH::Particle* particle, float eventWeight,
     //
     // IP2D
     //
-    m_nIP2DTracks -> Fill( jet->nIP2DTracks, eventWeight);
-    for(float grade : jet->IP2D_gradeOfTracks)        m_IP2D_gradeOfTracks->Fill(grade, eventWeight);
-    for(float flag  : jet->IP2D_flagFromV0ofTracks)   m_IP2D_flagFromV0ofTracks->Fill(flag, eventWeight);
+    fill( m_nIP2DTracks,  jet->nIP2DTracks, eventWeight );
+    for(float grade : jet->IP2D_gradeOfTracks)        fill( m_IP2D_gradeOfTracks, grade, eventWeight );
+    for(float flag  : jet->IP2D_flagFromV0ofTracks)   fill( m_IP2D_flagFromV0ofTracks, flag, eventWeight );
 
     if(jet->IP2D_sigD0wrtPVofTracks.size()  == jet->IP2D_valD0wrtPVofTracks.size()){
       for(unsigned int i=0; i<jet->IP2D_sigD0wrtPVofTracks.size(); i++){
 	float d0Sig=jet->IP2D_sigD0wrtPVofTracks[i];
 	float d0Val=jet->IP2D_valD0wrtPVofTracks[i];
 	float d0Err=d0Val/d0Sig;
-	m_IP2D_errD0wrtPVofTracks->Fill  (d0Err, eventWeight);
-	m_IP2D_sigD0wrtPVofTracks->Fill  (d0Sig, eventWeight);
-	m_IP2D_sigD0wrtPVofTracks_l->Fill(d0Sig, eventWeight);
-	m_IP2D_valD0wrtPVofTracks->Fill  (d0Val, eventWeight);
+	fill( m_IP2D_errD0wrtPVofTracks, d0Err, eventWeight );
+	fill( m_IP2D_sigD0wrtPVofTracks, d0Sig, eventWeight );
+	fill( m_IP2D_sigD0wrtPVofTracks_l, d0Sig, eventWeight );
+	fill( m_IP2D_valD0wrtPVofTracks, d0Val, eventWeight );
       }
     }
 
-    for(float weightB : jet->IP2D_weightBofTracks)  m_IP2D_weightBofTracks->Fill(weightB, eventWeight);
-    for(float weightC : jet->IP2D_weightCofTracks)  m_IP2D_weightCofTracks->Fill(weightC, eventWeight);
-    for(float weightU : jet->IP2D_weightUofTracks)  m_IP2D_weightUofTracks->Fill(weightU, eventWeight);
+    for(float weightB : jet->IP2D_weightBofTracks)  fill( m_IP2D_weightBofTracks, weightB, eventWeight );
+    for(float weightC : jet->IP2D_weightCofTracks)  fill( m_IP2D_weightCofTracks, weightC, eventWeight );
+    for(float weightU : jet->IP2D_weightUofTracks)  fill( m_IP2D_weightUofTracks, weightU, eventWeight );
 
 
-    m_IP2D_pu         ->  Fill(jet->IP2D_pu  , eventWeight );
-    m_IP2D_pb         ->  Fill(jet->IP2D_pb  , eventWeight );
-    m_IP2D_pc         ->  Fill(jet->IP2D_pc  , eventWeight );
+    fill( m_IP2D_pu,          jet->IP2D_pu  , eventWeight );
+    fill( m_IP2D_pb,          jet->IP2D_pb  , eventWeight );
+    fill( m_IP2D_pc,          jet->IP2D_pc  , eventWeight );
 
-    m_IP2D            ->  Fill( jet->IP2D    , eventWeight );
-    m_IP2D_c          ->  Fill( jet->IP2D_c  , eventWeight );
-    m_IP2D_cu         ->  Fill( jet->IP2D_cu , eventWeight );
+    fill( m_IP2D,             jet->IP2D    , eventWeight );
+    fill( m_IP2D_c,           jet->IP2D_c  , eventWeight );
+    fill( m_IP2D_cu,          jet->IP2D_cu , eventWeight );
 
 
     //
     // IP3D
     //
-    m_nIP3DTracks -> Fill( jet->nIP3DTracks, eventWeight);
-    for(float grade : jet->IP3D_gradeOfTracks     )   m_IP3D_gradeOfTracks->Fill(grade, eventWeight);
-    for(float flag  : jet->IP3D_flagFromV0ofTracks)   m_IP3D_flagFromV0ofTracks->Fill(flag, eventWeight);
+    fill( m_nIP3DTracks,  jet->nIP3DTracks, eventWeight );
+    for(float grade : jet->IP3D_gradeOfTracks     )   fill( m_IP3D_gradeOfTracks, grade, eventWeight );
+    for(float flag  : jet->IP3D_flagFromV0ofTracks)   fill( m_IP3D_flagFromV0ofTracks, flag, eventWeight );
 
     for(unsigned int i=0; i<jet->IP3D_sigD0wrtPVofTracks.size(); i++){
       float d0Sig=jet->IP3D_sigD0wrtPVofTracks[i];
       float d0Val=jet->IP3D_valD0wrtPVofTracks[i];
       float d0Err=d0Val/d0Sig;
-      m_IP3D_errD0wrtPVofTracks->Fill  (d0Err, eventWeight);
-      m_IP3D_sigD0wrtPVofTracks->Fill  (d0Sig, eventWeight);
-      m_IP3D_sigD0wrtPVofTracks_l->Fill(d0Sig, eventWeight);
-      m_IP3D_valD0wrtPVofTracks->Fill  (d0Val, eventWeight);
+      fill( m_IP3D_errD0wrtPVofTracks, d0Err, eventWeight );
+      fill( m_IP3D_sigD0wrtPVofTracks, d0Sig, eventWeight );
+      fill( m_IP3D_sigD0wrtPVofTracks_l, d0Sig, eventWeight );
+      fill( m_IP3D_valD0wrtPVofTracks, d0Val, eventWeight );
     }
 
     for(unsigned int i=0; i<jet->IP3D_sigZ0wrtPVofTracks.size(); i++){
       float z0Sig=jet->IP3D_sigZ0wrtPVofTracks[i];
       float z0Val=jet->IP3D_valZ0wrtPVofTracks[i];
       float z0Err=z0Val/z0Sig;
-      m_IP3D_errZ0wrtPVofTracks->Fill  (z0Err, eventWeight);
-      m_IP3D_sigZ0wrtPVofTracks->Fill  (z0Sig, eventWeight);
-      m_IP3D_sigZ0wrtPVofTracks_l->Fill(z0Sig, eventWeight);
-      m_IP3D_valZ0wrtPVofTracks->Fill  (z0Val, eventWeight);
+      fill( m_IP3D_errZ0wrtPVofTracks, z0Err, eventWeight );
+      fill( m_IP3D_sigZ0wrtPVofTracks, z0Sig, eventWeight );
+      fill( m_IP3D_sigZ0wrtPVofTracks_l, z0Sig, eventWeight );
+      fill( m_IP3D_valZ0wrtPVofTracks, z0Val, eventWeight );
     }
 
-    for(float weightB : jet->IP3D_weightBofTracks)  m_IP3D_weightBofTracks->Fill(weightB, eventWeight);
-    for(float weightC : jet->IP3D_weightCofTracks)  m_IP3D_weightCofTracks->Fill(weightC, eventWeight);
-    for(float weightU : jet->IP3D_weightUofTracks)  m_IP3D_weightUofTracks->Fill(weightU, eventWeight);
+    for(float weightB : jet->IP3D_weightBofTracks)  fill( m_IP3D_weightBofTracks, weightB, eventWeight );
+    for(float weightC : jet->IP3D_weightCofTracks)  fill( m_IP3D_weightCofTracks, weightC, eventWeight );
+    for(float weightU : jet->IP3D_weightUofTracks)  fill( m_IP3D_weightUofTracks, weightU, eventWeight );
 
-    m_IP3D_pu         ->  Fill(jet->IP3D_pu  , eventWeight );
-    m_IP3D_pb         ->  Fill(jet->IP3D_pb  , eventWeight );
-    m_IP3D_pc         ->  Fill(jet->IP3D_pc  , eventWeight );
+    fill( m_IP3D_pu,          jet->IP3D_pu  , eventWeight );
+    fill( m_IP3D_pb,          jet->IP3D_pb  , eventWeight );
+    fill( m_IP3D_pc,          jet->IP3D_pc  , eventWeight );
 
-    m_IP3D            ->  Fill( jet->IP3D   , eventWeight );
-    m_IP3D_c          ->  Fill( jet->IP3D_c , eventWeight );
-    m_IP3D_cu         ->  Fill( jet->IP3D_cu, eventWeight );
+    fill( m_IP3D,             jet->IP3D   , eventWeight );
+    fill( m_IP3D_c,           jet->IP3D_c , eventWeight );
+    fill( m_IP3D_cu,          jet->IP3D_cu, eventWeight );
 
   }
 
@@ -1994,16 +1789,11 @@ StatusCode JetHists::execute( const xAH::Particle* particle, float eventWeight,
   // truth
   if(m_infoSwitch->m_truth)
     {
-      m_truthLabelID  ->Fill(jet->ConeTruthLabelID  , eventWeight);
-      m_truthCount        ->Fill(jet->TruthCount        , eventWeight);
-      m_truthDr_B->Fill(jet->TruthLabelDeltaR_B, eventWeight);
-      m_truthDr_C->Fill(jet->TruthLabelDeltaR_C, eventWeight);
-      m_truthDr_T->Fill(jet->TruthLabelDeltaR_T, eventWeight);
+      fill( m_truthLabelID,   jet->ConeTruthLabelID  , eventWeight );
       //m_PartonTruthLabelID->Fill(jet->PartonTruthLabelID, eventWeight);
       //m_GhostTruthAssociationFraction->Fill(jet->GhostTruthAssociationFraction, eventWeight);
-      m_hadronConeExclTruthLabelID->Fill(jet->HadronConeExclTruthLabelID, eventWeight);
 
-      m_truthPt   ->Fill(jet->truth_p4.Pt(),  eventWeight);
+      fill( m_truthPt,    jet->truth_p4.Pt(),  eventWeight );
       //m_truth_pt_m ->Fill(jet->truth_p4.Pt(),  eventWeight);
       //m_truth_pt_l ->Fill(jet->truth_p4.Pt(),  eventWeight);
       //
@@ -2025,17 +1815,17 @@ StatusCode JetHists::execute( const xAH::Particle* particle, float eventWeight,
 
       float avg_mu=-99;
       avg_mu = eventInfo->m_averageMu;
-      m_avgMu->Fill(avg_mu, eventWeight);
-      if(avg_mu <  15.0)                  m_jetPt_avgMu_00_15 -> Fill(jet->p4.Pt(), eventWeight);
-      if(avg_mu >= 15.0 && avg_mu < 25.0) m_jetPt_avgMu_15_25 -> Fill(jet->p4.Pt(), eventWeight);
-      if(avg_mu >= 25.0)                  m_jetPt_avgMu_25    -> Fill(jet->p4.Pt(), eventWeight);
-      m_avgMu_vs_jetPt->Fill(jet->p4.Pt(), avg_mu, eventWeight);
+      fill( m_avgMu, avg_mu, eventWeight );
+      if(avg_mu <  15.0)                  fill( m_jetPt_avgMu_00_15,  jet->p4.Pt(), eventWeight );
+      if(avg_mu >= 15.0 && avg_mu < 25.0) fill( m_jetPt_avgMu_15_25,  jet->p4.Pt(), eventWeight );
+      if(avg_mu >= 25.0)                  fill( m_jetPt_avgMu_25,     jet->p4.Pt(), eventWeight );
+      fill( m_avgMu_vs_jetPt, jet->p4.Pt(), avg_mu, eventWeight );
 
     }
 
   if(m_infoSwitch->m_etaPhiMap)
     {
-      m_etaPhi->Fill(jet->p4.Eta(), jet->p4.Phi(), eventWeight);
+      fill( m_etaPhi, jet->p4.Eta(), jet->p4.Phi(), eventWeight );
 
     }
 
@@ -2045,6 +1835,28 @@ StatusCode JetHists::execute( const xAH::Particle* particle, float eventWeight,
 
 }
 
+void JetHists::auxIDs( std::set< SG::auxid_t >& auxids ) const {
+  IParticleHists::auxIDs( auxids );
+
+  for( const auto& acc : m_variableAccessors ) { auxids.insert( acc.auxid() ); }
+  for( const auto& acc : m_intVariableAccessors ) { auxids.insert( acc.auxid() ); }
+  if( !m_layerHists.empty() ) { auxids.insert( ePerSamp.auxid() ); }
+
+  if( m_infoSwitch->m_truth ) {
+    for( const auto* acc : { &TruthLabelID, &PartonTruthLabelID } ) { auxids.insert( acc->auxid() ); }
+    auxids.insert( TruthPt.auxid() );
+  }
+
+  if( m_infoSwitch->m_resolution ) { auxids.insert( GhostTruthPt.auxid() ); }
+
+  if( m_infoSwitch->m_substructure ) {
+    // the ratios
+    for( const auto* acc : { &Tau1, &Tau2, &Tau3, &Tau1_wta, &Tau2_wta, &Tau3_wta } ) { auxids.insert( acc->auxid() ); }
+    // numConstituents
+    auxids.insert( SG::AuxTypeRegistry::instance().getAuxID< std::vector< ElementLink< xAOD::IParticleContainer > > >( "constituentLinks" ) );
+  }
+}
+
 
 StatusCode JetHists::finalize() {
     if(m_tracksInJet){
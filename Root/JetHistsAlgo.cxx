@@ -7,6 +7,7 @@
 #include <xAODAnaHelpers/JetHistsAlgo.h>
 #include <xAODAnaHelpers/JetHists.h>
 #include <xAODAnaHelpers/HelperFunctions.h>
+#include <xAODAnaHelpers/HelperClasses.h>
 
 // this is needed to distribute the algorithm to the workers
 ClassImp(JetHistsAlgo)
@@ -27,6 +28,13 @@ EL::StatusCode JetHistsAlgo::AddHists( std::string name ) {
   return IParticleHistsAlgo::AddHists<JetHists>(name);
 }
 
+bool JetHistsAlgo::concurrentFillSafe() const {
+  // these live in other containers and are loaded, or have their links cached, on first use
+  HelperClasses::JetInfoSwitch infoSwitch( m_detailStr );
+  return !( infoSwitch.m_flavTag || infoSwitch.m_flavTagHLT || infoSwitch.m_btag_jettrk || infoSwitch.m_jetFitterDetails ||
+            infoSwitch.m_svDetails || infoSwitch.m_ipDetails || infoSwitch.m_tracksInJet || infoSwitch.m_hltVtxComp || infoSwitch.m_onlineBS );
+}
+
 EL::StatusCode JetHistsAlgo :: execute ()
 {
   return IParticleHistsAlgo::execute<JetHists, xAOD::JetContainer>();
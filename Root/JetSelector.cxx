@@ -148,6 +148,8 @@ EL::StatusCode JetSelector :: initialize ()
     m_jet_cutflow_btag_cut        = m_jet_cutflowHist_1->GetXaxis()->FindBin("BTag_cut");
     m_jet_cutflow_cleaning_cut    = m_jet_cutflowHist_1->GetXaxis()->FindBin("cleaning_cut");
 
+    m_jet_cutflowCounter_1.setHistogram( m_jet_cutflowHist_1 );
+
   }
 
   //If not set, find default from input container name
@@ -187,6 +189,11 @@ EL::StatusCode JetSelector :: initialize ()
     return EL::StatusCode::FAILURE;
   }
 
+  m_kinematicPreFilter.setCuts( m_pT_min, m_pT_max, m_eta_max, m_eta_min );
+
+  m_inContainerKeys.setPrefix( m_inContainerName );
+  m_outContainerKeys.setPrefix( m_outContainerName );
+
   bool allOK(true);
   if (!m_operatingPt.empty() || m_doBTagCut ) { allOK = false; }
   if (m_operatingPt == "FixedCutBEff_30") { allOK = true; }
@@ -327,6 +334,7 @@ EL::StatusCode JetSelector :: initialize ()
 
 EL::StatusCode JetSelector :: execute ()
 {
+  xAH::ExecuteProfiler profiler(this);
   // Here you do everything that needs to be done on every single
   // events, e.g. read input variables, apply cuts, and fill
   // histograms and trees.  This is where most of your actual analysis
@@ -394,9 +402,11 @@ EL::StatusCode JetSelector :: execute ()
     // loop over systematics
     std::vector< std::string >* vecOutContainerNames = new std::vector< std::string >;
     bool passOne(false);
-    for ( auto systName : *systNames ) {
+    xAH::SystematicRegistry& systRegistry = xAH::SystematicRegistry::instance();
+    for ( const auto& systName : *systNames ) {
 
-      ANA_CHECK( HelperFunctions::retrieve(inJets, m_inContainerName+systName, m_event, m_store, msg()) );
+      unsigned int systID = systRegistry.id( systName );
+      ANA_CHECK( HelperFunctions::retrieve(inJets, m_inContainerKeys.key(systID), m_event, m_store, msg()) );
 
       // decorate inJets with truth info
       if ( m_isMC && m_doJVT ) {
@@ -414,7 +424,7 @@ EL::StatusCode JetSelector :: execute ()
         }
       }
 
-      passOne = executeSelection( inJets, mcEvtWeight, count, m_outContainerName+systName, systName.empty() );
+      passOne = executeSelection( inJets, mcEvtWeight, count, m_outContainerKeys.key(systID), systName.empty() );
       if ( count ) { count = false; } // only count for 1 collection
       // save the string if passing the selection
       if ( passOne ) {
@@ -462,7 +472,9 @@ bool JetSelector :: executeSelection ( const xAOD::JetContainer* inJets,
   if ( m_doJVF ) {
     const xAOD::VertexContainer* vertices(nullptr);
     ANA_CHECK( HelperFunctions::retrieve(vertices, "PrimaryVertices", m_event, m_store, msg()) );
-    m_pvLocation = HelperFunctions::getPrimaryVertexLocation( vertices, msg() );
+    const xAOD::EventInfo* eventInfo(nullptr);
+    ANA_CHECK( HelperFunctions::retrieve(eventInfo, m_eventInfoContainerName, m_event, m_store, msg()) );
+    m_pvLocation = HelperFunctions::getPrimaryVertexLocation( vertices, eventInfo, msg() );
   }
 
   int nPass(0); int nObj(0);
@@ -476,6 +488,12 @@ bool JetSelector :: executeSelection ( const xAOD::JetContainer* inJets,
   //
   SG::AuxElement::Decorator< char > passSelDecor( m_decor );
 
+  // cheap kinematic cuts for all jets at once, PassCuts only has to look at the survivors
+  const bool usePreFilter = m_doKinematicPreFilter && m_kinematicPreFilter.active();
+  if ( usePreFilter ) {
+    m_kinematicPreFilter.apply( *inJets, [](const xAOD::Jet* jet) { return jet->eta(); } );
+  }
+
   for ( auto jet_itr : *inJets ) { // duplicated of basic loop
 
     // if only looking at a subset of jets make sure all are decorated
@@ -490,7 +508,18 @@ bool JetSelector :: executeSelection ( const xAOD::JetContainer* inJets,
 
     nObj++;
     // All selections but Cleaning
-    int passSel = this->PassCuts( jet_itr );
+    int passSel(0);
+    if ( usePreFilter && !m_kinematicPreFilter.passed( nObj-1 ) ) {
+      // PassCuts starts with the same cuts, fill the cutflow bins it would have filled before rejecting the jet
+      if ( m_useCutFlow ) {
+        const unsigned int stage = m_kinematicPreFilter.stage( nObj-1 );
+        m_jet_cutflowCounter_1.fill( m_jet_cutflow_all );
+        if ( stage > 0 ) m_jet_cutflowCounter_1.fill( m_jet_cutflow_ptmax_cut );
+        if ( stage > 1 ) m_jet_cutflowCounter_1.fill( m_jet_cutflow_ptmin_cut );
+      }
+    } else {
+      passSel = this->PassCuts( jet_itr );
+    }
     if ( m_decorateSelectedObjects ) {
       passSelDecor( *jet_itr ) = passSel;
     }
@@ -512,7 +541,7 @@ bool JetSelector :: executeSelection ( const xAOD::JetContainer* inJets,
       }// if jet is not clean
     }// if jet clean aux missing
     if( m_useCutFlow && passSel )
-      m_jet_cutflowHist_1->Fill( m_jet_cutflow_cleaning_cut, 1 );
+      m_jet_cutflowCounter_1.fill( m_jet_cutflow_cleaning_cut );
 
 
 
@@ -826,6 +855,7 @@ EL::StatusCode JetSelector :: finalize ()
     ANA_MSG_DEBUG( "Filling cutflow");
     m_cutflowHist ->SetBinContent( m_cutflow_bin, m_numEventPass        );
     m_cutflowHistW->SetBinContent( m_cutflow_bin, m_weightNumEventPass  );
+    m_jet_cutflowCounter_1.flush();
   }
 
   return EL::StatusCode::SUCCESS;
@@ -855,18 +885,18 @@ int JetSelector :: PassCuts( const xAOD::Jet* jet ) {
   ANA_MSG_DEBUG("In pass cuts");
 
   // fill cutflow bin 'all' before any cut
-  if(m_useCutFlow) m_jet_cutflowHist_1->Fill( m_jet_cutflow_all, 1 );
+  if(m_useCutFlow) m_jet_cutflowCounter_1.fill( m_jet_cutflow_all );
 
   // pT
   if ( m_pT_max != 1e8 ) {
     if ( jet->pt() > m_pT_max ) { return 0; }
   }
-  if(m_useCutFlow) m_jet_cutflowHist_1->Fill( m_jet_cutflow_ptmax_cut, 1 );
+  if(m_useCutFlow) m_jet_cutflowCounter_1.fill( m_jet_cutflow_ptmax_cut );
 
   if ( m_pT_min != 1e8 ) {
     if ( jet->pt() < m_pT_min ) { return 0; }
   }
-  if(m_useCutFlow) m_jet_cutflowHist_1->Fill( m_jet_cutflow_ptmin_cut, 1 );
+  if(m_useCutFlow) m_jet_cutflowCounter_1.fill( m_jet_cutflow_ptmin_cut );
 
   // eta
   if ( m_eta_max != 1e8 ) {
@@ -875,7 +905,7 @@ int JetSelector :: PassCuts( const xAOD::Jet* jet ) {
   if ( m_eta_min != 1e8 ) {
     if ( fabs(jet->eta()) < m_eta_min ) { return 0; }
   }
-  if(m_useCutFlow) m_jet_cutflowHist_1->Fill( m_jet_cutflow_eta_cut, 1 );
+  if(m_useCutFlow) m_jet_cutflowCounter_1.fill( m_jet_cutflow_eta_cut );
 
   // detEta
   if ( m_detEta_max != 1e8 ) {
@@ -955,7 +985,7 @@ int JetSelector :: PassCuts( const xAOD::Jet* jet ) {
       if ( !m_noJVTVeto && !m_JVT_tool_handle->passesJvtCut(*jet) ) { return 0; }
     }
   } // m_doJVT
-  if ( m_useCutFlow ) m_jet_cutflowHist_1->Fill( m_jet_cutflow_jvt_cut, 1 );
+  if ( m_useCutFlow ) m_jet_cutflowCounter_1.fill( m_jet_cutflow_jvt_cut );
 
   //
   //  BTagging
@@ -963,7 +993,7 @@ int JetSelector :: PassCuts( const xAOD::Jet* jet ) {
   if ( m_doBTagCut ) {
     ANA_MSG_DEBUG("Doing BTagging");
     if ( m_BJetSelectTool_handle->accept( jet ) ) {
-      if(m_useCutFlow) m_jet_cutflowHist_1->Fill( m_jet_cutflow_btag_cut, 1 );
+      if(m_useCutFlow) m_jet_cutflowCounter_1.fill( m_jet_cutflow_btag_cut );
     } else {
       return 0;
     }
@@ -0,0 +1,32 @@
+#include <xAODAnaHelpers/KinematicPreFilter.h>
+
+#include <limits>
+
+using namespace xAH;
+
+void KinematicPreFilter::setCuts(float pT_min, float pT_max, float eta_max, float eta_min)
+{
+  // switched off cuts become open-ended ranges, so the loop in evaluate() needs no special cases
+  const float inf = std::numeric_limits<float>::infinity();
+  m_pT_min  = ( pT_min  != 1e8 ) ? pT_min  : -inf;
+  m_pT_max  = ( pT_max  != 1e8 ) ? pT_max  :  inf;
+  m_eta_min = ( eta_min != 1e8 ) ? eta_min : -inf;
+  m_eta_max = ( eta_max != 1e8 ) ? eta_max :  inf;
+  m_active  = ( pT_min != 1e8 || pT_max != 1e8 || eta_min != 1e8 || eta_max != 1e8 );
+}
+
+void KinematicPreFilter::evaluate()
+{
+  const std::size_t n = m_stage.size();
+  const float* pt     = m_pt.data();
+  const float* absEta = m_absEta.data();
+  unsigned char* stage = m_stage.data();
+
+  // written as negated comparisons to reject exactly what the selectors reject, NaN included
+  for(std::size_t i = 0; i < n; ++i){
+    const unsigned char passPtMax = !( pt[i] > m_pT_max );
+    const unsigned char passPtMin = passPtMax & !( pt[i] < m_pT_min );
+    const unsigned char passEta   = passPtMin & !( absEta[i] > m_eta_max ) & !( absEta[i] < m_eta_min );
+    stage[i] = passPtMax + passPtMin + passEta;
+  }
+}
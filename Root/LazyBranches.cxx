@@ -0,0 +1,53 @@
+#include <xAODAnaHelpers/LazyBranches.h>
+
+using namespace xAH;
+
+void LazyBranches::connect(TTree* tree, const std::string& branch, const std::string& varName, void* variable, const std::type_info& type)
+{
+  m_tree = tree;
+
+  // the same variable may be connected twice, the last branch wins
+  auto found = m_byVariable.find(variable);
+  const std::size_t index = (found != m_byVariable.end()) ? found->second : m_columns.size();
+  if(index == m_columns.size()) m_columns.emplace_back();
+
+  Column& column    = m_columns[index];
+  column.branchName = branch;
+  column.variable   = variable;
+  column.type       = &type;
+  column.branch     = nullptr;
+  column.treeNumber = -1;
+  column.loadedEntry = -1;
+
+  m_byName[varName]      = index;
+  m_byVariable[variable] = index;
+
+  // read on demand from now on
+  if(m_lazy) tree->SetBranchStatus(branch.c_str(), 0);
+}
+
+void LazyBranches::loadAll()
+{
+  if(!m_lazy) return;
+  for(auto& column : m_columns) load(column);
+}
+
+void LazyBranches::load(Column& column)
+{
+  // for a chain, the branches belong to the tree it is currently in
+  TTree* current = m_tree->GetTree();
+  if(!current) return;
+  const Long64_t entry = current->GetReadEntry();
+  const int treeNumber = m_tree->GetTreeNumber();
+
+  if(column.treeNumber != treeNumber || !column.branch){
+    column.branch      = current->GetBranch(column.branchName.c_str());
+    column.treeNumber  = treeNumber;
+    column.loadedEntry = -1;
+  }
+  if(!column.branch || column.loadedEntry == entry) return;
+
+  // getall, since the branch is switched off for TTree::GetEntry
+  column.branch->GetEntry(entry, 1);
+  column.loadedEntry = entry;
+}
@@ -218,6 +218,7 @@ EL::StatusCode METConstructor :: initialize ()
 
 EL::StatusCode METConstructor :: execute ()
 {
+  xAH::ExecuteProfiler profiler(this);
    // Here you do everything that needs to be done on every single
    // events, e.g. read input variables, apply cuts, and fill
    // histograms and trees.  This is where most of your actual analysis
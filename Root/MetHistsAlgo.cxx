@@ -56,6 +56,7 @@ EL::StatusCode MetHistsAlgo :: initialize ()
 
 EL::StatusCode MetHistsAlgo :: execute ()
 {
+  xAH::ExecuteProfiler profiler(this);
   const xAOD::EventInfo* eventInfo(nullptr);
   ANA_CHECK( HelperFunctions::retrieve(eventInfo, m_eventInfoContainerName, m_event, m_store, msg()) );
 
@@ -182,6 +182,7 @@ EL::StatusCode MinixAOD :: initialize ()
 
 EL::StatusCode MinixAOD :: execute ()
 {
+  xAH::ExecuteProfiler profiler(this);
   ANA_MSG_VERBOSE( "Dumping objects...");
 
   const xAOD::EventInfo* eventInfo(nullptr);
@@ -237,6 +237,7 @@ EL::StatusCode MuonCalibrator :: initialize ()
 
 EL::StatusCode MuonCalibrator :: execute ()
 {
+  xAH::ExecuteProfiler profiler(this);
   // Here you do everything that needs to be done on every single
   // events, e.g. read input variables, apply cuts, and fill
   // histograms and trees.  This is where most of your actual analysis
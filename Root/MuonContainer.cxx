@@ -111,6 +111,38 @@ MuonContainer::MuonContainer(const std::string& name, const std::string& detailS
     m_PromptLepton_TagWeight              = new std::vector<float> ();
   }
 
+  //
+  // aux variables copied as they are, for every muon in FillParticle
+  //
+  if ( m_infoSwitch.m_isolation ) {
+    m_auxColumns.add<char, int>("isIsolated_LooseTrackOnly", m_isIsolated_LooseTrackOnly, -1);
+    m_auxColumns.add<char, int>("isIsolated_Loose", m_isIsolated_Loose, -1);
+    m_auxColumns.add<char, int>("isIsolated_Tight", m_isIsolated_Tight, -1);
+    m_auxColumns.add<char, int>("isIsolated_Gradient", m_isIsolated_Gradient, -1);
+    m_auxColumns.add<char, int>("isIsolated_GradientLoose", m_isIsolated_GradientLoose, -1);
+    m_auxColumns.add<char, int>("isIsolated_FixedCutLoose", m_isIsolated_FixedCutLoose, -1);
+    m_auxColumns.add<char, int>("isIsolated_FixedCutTightTrackOnly", m_isIsolated_FixedCutTightTrackOnly, -1);
+    m_auxColumns.add<char, int>("isIsolated_UserDefinedFixEfficiency", m_isIsolated_UserDefinedFixEfficiency, -1);
+    m_auxColumns.add<char, int>("isIsolated_UserDefinedCut", m_isIsolated_UserDefinedCut, -1);
+  }
+
+  if ( m_infoSwitch.m_quality ) {
+    m_auxColumns.add<char, int>("isVeryLooseQ", m_isVeryLoose, -1);
+    m_auxColumns.add<char, int>("isLooseQ", m_isLoose, -1);
+    m_auxColumns.add<char, int>("isMediumQ", m_isMedium, -1);
+    m_auxColumns.add<char, int>("isTightQ", m_isTight, -1);
+  }
+
+  if ( m_infoSwitch.m_energyLoss ) {
+    m_auxColumns.add<float, float>("EnergyLoss", m_EnergyLoss, -1);
+    m_auxColumns.add<float, float>("EnergyLossSigma", m_EnergyLossSigma, -1);
+    m_auxColumns.add<unsigned char, unsigned char>("energyLossType", m_energyLossType, -1);
+    m_auxColumns.add<float, float>("MeasEnergyLoss", m_MeasEnergyLoss, -1);
+    m_auxColumns.add<float, float>("MeasEnergyLossSigma", m_MeasEnergyLossSigma, -1);
+    m_auxColumns.add<float, float>("ParamEnergyLoss", m_ParamEnergyLoss, -1);
+    m_auxColumns.add<float, float>("ParamEnergyLossSigmaMinus", m_ParamEnergyLossSigmaMinus, -1);
+    m_auxColumns.add<float, float>("ParamEnergyLossSigmaPlus", m_ParamEnergyLossSigmaPlus, -1);
+  }
 }
 
 MuonContainer::~MuonContainer()
@@ -578,7 +610,7 @@ void MuonContainer::clear()
 
   if ( m_infoSwitch.m_trigger ) {
     m_isTrigMatched->clear();
-    m_isTrigMatchedToChain->clear();
+    clearColumn( m_isTrigMatchedToChain );
     m_listTrigChains->clear();
   }
 
@@ -652,19 +684,19 @@ void MuonContainer::clear()
   if ( m_infoSwitch.m_effSF && m_mc ) {
     
     for (auto& reco : m_infoSwitch.m_recoWPs) {
-      (*m_RecoEff_SF)[ reco ].clear();
+      clearColumn( (*m_RecoEff_SF)[ reco ] );
     }
     
     for (auto& isol : m_infoSwitch.m_isolWPs) {
-      (*m_IsoEff_SF)[ isol ].clear();
+      clearColumn( (*m_IsoEff_SF)[ isol ] );
     }
     
     for (auto& trig : m_infoSwitch.m_trigWPs) {
-      (*m_TrigEff_SF)[ trig ].clear();
-      (*m_TrigMCEff)[ trig ].clear();
+      clearColumn( (*m_TrigEff_SF)[ trig ] );
+      clearColumn( (*m_TrigMCEff)[ trig ] );
     }
     
-    m_TTVAEff_SF->clear();
+    clearColumn( m_TTVAEff_SF );
   }
 
   if ( m_infoSwitch.m_energyLoss ) {
@@ -699,7 +731,7 @@ void MuonContainer::FillMuon( const xAOD::IParticle* particle, const xAOD::Verte
     //
     static SG::AuxElement::Accessor< std::map<std::string,char> > isTrigMatchedMapMuAcc("isTrigMatchedMapMu");
 
-    std::vector<int> matches;
+    std::vector<int>& matches = newRow( m_isTrigMatchedToChain );
 
     if ( isTrigMatchedMapMuAcc.isAvailable( *muon ) ) {
       // loop over map and fill branches
@@ -713,8 +745,6 @@ void MuonContainer::FillMuon( const xAOD::IParticle* particle, const xAOD::Verte
       m_listTrigChains->push_back("NONE");
     }
 
-    m_isTrigMatchedToChain->push_back(matches);
-    
     // if at least one match among the chains is found, say this muon is trigger matched
     if ( std::find(matches.begin(), matches.end(), 1) != matches.end() ) { m_isTrigMatched->push_back(1); }
     else { m_isTrigMatched->push_back(0); }
@@ -722,37 +752,6 @@ void MuonContainer::FillMuon( const xAOD::IParticle* particle, const xAOD::Verte
   }
   
   
-  if ( m_infoSwitch.m_isolation ) {
-    
-
-    static SG::AuxElement::Accessor<char> isIsoLooseTrackOnlyAcc ("isIsolated_LooseTrackOnly");
-    safeFill<char, int, xAOD::Muon>(muon, isIsoLooseTrackOnlyAcc, m_isIsolated_LooseTrackOnly, -1);
-
-    static SG::AuxElement::Accessor<char> isIsoLooseAcc ("isIsolated_Loose");
-    safeFill<char, int, xAOD::Muon>(muon, isIsoLooseAcc, m_isIsolated_Loose, -1);
-
-    static SG::AuxElement::Accessor<char> isIsoTightAcc ("isIsolated_Tight");
-    safeFill<char, int, xAOD::Muon>(muon, isIsoTightAcc, m_isIsolated_Tight, -1);
-
-    static SG::AuxElement::Accessor<char> isIsoGradientAcc ("isIsolated_Gradient");
-    safeFill<char, int, xAOD::Muon>(muon, isIsoGradientAcc, m_isIsolated_Gradient, -1);
-
-    static SG::AuxElement::Accessor<char> isIsoGradientLooseAcc ("isIsolated_GradientLoose");
-    safeFill<char, int, xAOD::Muon>(muon, isIsoGradientLooseAcc, m_isIsolated_GradientLoose, -1);
-
-    static SG::AuxElement::Accessor<char> isIsoFixedCutLooseAcc ("isIsolated_FixedCutLoose");
-    safeFill<char, int, xAOD::Muon>(muon, isIsoFixedCutLooseAcc, m_isIsolated_FixedCutLoose, -1);
-
-    static SG::AuxElement::Accessor<char> isIsoFixedCutTightTrackOnlyAcc ("isIsolated_FixedCutTightTrackOnly");
-    safeFill<char, int, xAOD::Muon>(muon, isIsoFixedCutTightTrackOnlyAcc, m_isIsolated_FixedCutTightTrackOnly, -1);
-
-    static SG::AuxElement::Accessor<char> isIsoUserDefinedFixEfficiencyAcc ("isIsolated_UserDefinedFixEfficiency");
-    safeFill<char, int, xAOD::Muon>(muon, isIsoUserDefinedFixEfficiencyAcc, m_isIsolated_UserDefinedFixEfficiency, -1);
-
-    static SG::AuxElement::Accessor<char> isIsoUserDefinedCutAcc ("isIsolated_UserDefinedCut");
-    safeFill<char, int, xAOD::Muon>(muon, isIsoUserDefinedCutAcc, m_isIsolated_UserDefinedCut, -1);
-  }
-
   if ( m_infoSwitch.m_isolationKinematics ) {
     m_ptcone20    ->push_back( muon->isolation( xAOD::Iso::ptcone20 )    /m_units );
     m_ptcone30    ->push_back( muon->isolation( xAOD::Iso::ptcone30 )    /m_units );
@@ -766,20 +765,6 @@ void MuonContainer::FillMuon( const xAOD::IParticle* particle, const xAOD::Verte
     
   }
 
-  if ( m_infoSwitch.m_quality ) {
-    static SG::AuxElement::Accessor<char> isVeryLooseQAcc ("isVeryLooseQ");
-    safeFill<char, int, xAOD::Muon>(muon, isVeryLooseQAcc, m_isVeryLoose, -1);
-
-    static SG::AuxElement::Accessor<char> isLooseQAcc ("isLooseQ");
-    safeFill<char, int, xAOD::Muon>(muon, isLooseQAcc, m_isLoose, -1);
-
-    static SG::AuxElement::Accessor<char> isMediumQAcc ("isMediumQ");
-    safeFill<char, int, xAOD::Muon>(muon, isMediumQAcc, m_isMedium, -1);
-
-    static SG::AuxElement::Accessor<char> isTightQAcc ("isTightQ");
-    safeFill<char, int, xAOD::Muon>(muon, isTightQAcc, m_isTight, -1);    
-  }
-  
   const xAOD::TrackParticle* trk = muon->primaryTrackParticle();
 
   if ( m_infoSwitch.m_trackparams ) {
@@ -906,32 +891,5 @@ void MuonContainer::FillMuon( const xAOD::IParticle* particle, const xAOD::Verte
 
   }
 
-  if(m_infoSwitch.m_energyLoss ) {
-    static SG::AuxElement::Accessor< float >         accMuon_EnergyLoss                ("EnergyLoss");
-    safeFill<float, float, xAOD::Muon>(muon, accMuon_EnergyLoss, m_EnergyLoss, -1);
-
-    static SG::AuxElement::Accessor< float >         accMuon_EnergyLossSigma           ("EnergyLossSigma");
-    safeFill<float, float, xAOD::Muon>(muon, accMuon_EnergyLossSigma, m_EnergyLossSigma, -1);
-
-    static SG::AuxElement::Accessor< unsigned char > accMuon_energyLossType            ("energyLossType");
-    safeFill<unsigned char, unsigned char, xAOD::Muon>(muon, accMuon_energyLossType, m_energyLossType, -1);
-
-    static SG::AuxElement::Accessor< float >         accMuon_MeasEnergyLoss            ("MeasEnergyLoss");
-    safeFill<float, float, xAOD::Muon>(muon, accMuon_MeasEnergyLoss, m_MeasEnergyLoss, -1);
-
-    static SG::AuxElement::Accessor< float >         accMuon_MeasEnergyLossSigma       ("MeasEnergyLossSigma");
-    safeFill<float, float, xAOD::Muon>(muon, accMuon_MeasEnergyLossSigma, m_MeasEnergyLossSigma, -1);
-
-    static SG::AuxElement::Accessor< float >         accMuon_ParamEnergyLoss           ("ParamEnergyLoss");
-    safeFill<float, float, xAOD::Muon>(muon, accMuon_ParamEnergyLoss, m_ParamEnergyLoss, -1);
-
-    static SG::AuxElement::Accessor< float >         accMuon_ParamEnergyLossSigmaMinus ("ParamEnergyLossSigmaMinus");
-    safeFill<float, float, xAOD::Muon>(muon, accMuon_ParamEnergyLossSigmaMinus, m_ParamEnergyLossSigmaMinus, -1);
-
-    static SG::AuxElement::Accessor< float >         accMuon_ParamEnergyLossSigmaPlus  ("ParamEnergyLossSigmaPlus");
-    safeFill<float, float, xAOD::Muon>(muon, accMuon_ParamEnergyLossSigmaPlus, m_ParamEnergyLossSigmaPlus, -1);
-
-  }
-  
   return;
 }
@@ -114,6 +114,8 @@ EL::StatusCode MuonEfficiencyCorrector :: initialize ()
     return EL::StatusCode::FAILURE;
   }
 
+  m_inContainerKeys.setPrefix( m_inContainerName );
+
 
   const xAOD::EventInfo* eventInfo(nullptr);
   ANA_CHECK( HelperFunctions::retrieve(eventInfo, m_eventInfoContainerName, m_event, m_store, msg()) );
@@ -378,6 +380,7 @@ EL::StatusCode MuonEfficiencyCorrector :: initialize ()
 
 EL::StatusCode MuonEfficiencyCorrector :: execute ()
 {
+  xAH::ExecuteProfiler profiler(this);
   // Here you do everything that needs to be done on every single
   // events, e.g. read input variables, apply cuts, and fill
   // histograms and trees.  This is where most of your actual analysis
@@ -410,13 +413,16 @@ EL::StatusCode MuonEfficiencyCorrector :: execute ()
   bool writeSystNames(true);
 
   // loop over systematic sets available
-  for ( auto systName : systNames ) {
+  xAH::SystematicRegistry& systRegistry = xAH::SystematicRegistry::instance();
+  for ( const auto& systName : systNames ) {
+
+    unsigned int systID = systRegistry.id( systName );
     const xAOD::MuonContainer* inputMuons(nullptr);
 
     // some systematics might have rejected the event
-    if ( m_store->contains<xAOD::MuonContainer>( m_inContainerName+systName ) ) {
+    if ( m_store->contains<xAOD::MuonContainer>( m_inContainerKeys.key(systID) ) ) {
       // retrieve input muons
-      ANA_CHECK( HelperFunctions::retrieve(inputMuons, m_inContainerName+systName, m_event, m_store, msg()) );
+      ANA_CHECK( HelperFunctions::retrieve(inputMuons, m_inContainerKeys.key(systID), m_event, m_store, msg()) );
 
       ANA_MSG_DEBUG( "Number of muons: " << static_cast<int>(inputMuons->size()) );
       ANA_MSG_DEBUG( "Input syst: " << systName );
@@ -8,10 +8,42 @@
 
 
 #include <xAODAnaHelpers/MuonHists.h>
+#include <xAODPrimitives/tools/getIsolationAccessor.h>
 #include <sstream>
 
 ANA_MSG_SOURCE(msgMuonHists, "MuonHists")
 
+namespace {
+
+  // the accessors of the isolation and quality flags, shared by execute and auxIDs
+  const SG::AuxElement::ConstAccessor<char> isIsoLooseTrackOnlyAcc ("isIsolated_LooseTrackOnly");
+  const SG::AuxElement::ConstAccessor<char> isIsoLooseAcc ("isIsolated_Loose");
+  const SG::AuxElement::ConstAccessor<char> isIsoTightAcc ("isIsolated_Tight");
+  const SG::AuxElement::ConstAccessor<char> isIsoGradientAcc ("isIsolated_Gradient");
+  const SG::AuxElement::ConstAccessor<char> isIsoGradientLooseAcc ("isIsolated_GradientLoose");
+  const SG::AuxElement::ConstAccessor<char> isIsoGradientT1Acc ("isIsolated_GradientT1");
+  const SG::AuxElement::ConstAccessor<char> isIsoGradientT2Acc ("isIsolated_GradientT2");
+  const SG::AuxElement::ConstAccessor<char> isIsoMU0p06Acc ("isIsolated_MU0p06");
+  const SG::AuxElement::ConstAccessor<char> isIsoFixedCutLooseAcc ("isIsolated_FixedCutLoose");
+  const SG::AuxElement::ConstAccessor<char> isIsoFixedCutTightAcc ("isIsolated_FixedCutTight");
+  const SG::AuxElement::ConstAccessor<char> isIsoFixedCutTightTrackOnlyAcc ("isIsolated_FixedCutTightTrackOnly");
+  const SG::AuxElement::ConstAccessor<char> isIsoUserDefinedFixEfficiencyAcc ("isIsolated_UserDefinedFixEfficiency");
+  const SG::AuxElement::ConstAccessor<char> isIsoUserDefinedCutAcc ("isIsolated_UserDefinedCut");
+
+  const SG::AuxElement::ConstAccessor<char> isVeryLooseQAcc ("isVeryLooseQ");
+  const SG::AuxElement::ConstAccessor<char> isLooseQAcc ("isLooseQ");
+  const SG::AuxElement::ConstAccessor<char> isMediumQAcc ("isMediumQ");
+  const SG::AuxElement::ConstAccessor<char> isTightQAcc ("isTightQ");
+
+  // the isolation variables filled for m_isolation
+  const xAOD::Iso::IsolationType isolationTypes[] = {
+    xAOD::Iso::ptcone20,    xAOD::Iso::ptcone30,    xAOD::Iso::ptcone40,
+    xAOD::Iso::ptvarcone20, xAOD::Iso::ptvarcone30, xAOD::Iso::ptvarcone40,
+    xAOD::Iso::topoetcone20, xAOD::Iso::topoetcone30, xAOD::Iso::topoetcone40
+  };
+
+}
+
 using std::vector;
 
 MuonHists :: MuonHists (std::string name, std::string detailStr, const std::string& prefix, const std::string& titlePrefix) :
@@ -97,69 +129,50 @@ StatusCode MuonHists::execute( const xAOD::IParticle* particle, float eventWeigh
 
   if ( m_infoSwitch->m_isolation ) {
 
-    static SG::AuxElement::Accessor<char> isIsoLooseTrackOnlyAcc ("isIsolated_LooseTrackOnly");
-    static SG::AuxElement::Accessor<char> isIsoLooseAcc ("isIsolated_Loose");
-    static SG::AuxElement::Accessor<char> isIsoTightAcc ("isIsolated_Tight");
-    static SG::AuxElement::Accessor<char> isIsoGradientAcc ("isIsolated_Gradient");
-    static SG::AuxElement::Accessor<char> isIsoGradientLooseAcc ("isIsolated_GradientLoose");
-    static SG::AuxElement::Accessor<char> isIsoGradientT1Acc ("isIsolated_GradientT1");
-    static SG::AuxElement::Accessor<char> isIsoGradientT2Acc ("isIsolated_GradientT2");
-    static SG::AuxElement::Accessor<char> isIsoMU0p06Acc ("isIsolated_MU0p06");
-    static SG::AuxElement::Accessor<char> isIsoFixedCutLooseAcc ("isIsolated_FixedCutLoose");
-    static SG::AuxElement::Accessor<char> isIsoFixedCutTightAcc ("isIsolated_FixedCutTight");
-    static SG::AuxElement::Accessor<char> isIsoFixedCutTightTrackOnlyAcc ("isIsolated_FixedCutTightTrackOnly");
-    static SG::AuxElement::Accessor<char> isIsoUserDefinedFixEfficiencyAcc ("isIsolated_UserDefinedFixEfficiency");
-    static SG::AuxElement::Accessor<char> isIsoUserDefinedCutAcc ("isIsolated_UserDefinedCut");
-
-    if ( isIsoLooseTrackOnlyAcc.isAvailable( *muon ) ) { m_isIsolated_LooseTrackOnly->Fill( isIsoLooseTrackOnlyAcc( *muon ) ,  eventWeight ); } else {m_isIsolated_LooseTrackOnly->Fill( -1 ,  eventWeight );}
-    if ( isIsoLooseAcc.isAvailable( *muon ) )          { m_isIsolated_Loose->Fill( isIsoLooseAcc( *muon ) ,  eventWeight ); } else { m_isIsolated_Loose->Fill( -1 ,  eventWeight ); }
-    if ( isIsoTightAcc.isAvailable( *muon ) )          { m_isIsolated_Tight->Fill( isIsoTightAcc( *muon ) ,  eventWeight ); } else { m_isIsolated_Tight->Fill( -1 ,  eventWeight ); }
-    if ( isIsoGradientAcc.isAvailable( *muon ) )       { m_isIsolated_Gradient->Fill( isIsoGradientAcc( *muon ) ,  eventWeight ); } else { m_isIsolated_Gradient->Fill( -1 ,  eventWeight ); }
-    if ( isIsoGradientLooseAcc.isAvailable( *muon ) )  { m_isIsolated_GradientLoose->Fill( isIsoGradientLooseAcc( *muon ) ,  eventWeight ); } else { m_isIsolated_GradientLoose->Fill( -1 ,  eventWeight ); }
-    if ( isIsoGradientT1Acc.isAvailable( *muon ) )     { m_isIsolated_GradientT1->Fill( isIsoGradientT1Acc( *muon ) ,  eventWeight ); } else { m_isIsolated_GradientT1->Fill( -1 ,  eventWeight ); }
-    if ( isIsoGradientT2Acc.isAvailable( *muon ) )     { m_isIsolated_GradientT2->Fill( isIsoGradientT2Acc( *muon ) ,  eventWeight ); } else { m_isIsolated_GradientT2->Fill( -1 ,  eventWeight ); }
-    if ( isIsoMU0p06Acc.isAvailable( *muon ) )          { m_isIsolated_MU0p06->Fill( isIsoMU0p06Acc( *muon ) ,  eventWeight ); } else { m_isIsolated_MU0p06->Fill( -1 ,  eventWeight ); }
-    if ( isIsoFixedCutLooseAcc.isAvailable( *muon ) )          { m_isIsolated_FixedCutLoose->Fill( isIsoFixedCutLooseAcc( *muon ) ,  eventWeight ); } else { m_isIsolated_FixedCutLoose->Fill( -1 ,  eventWeight ); }
-    if ( isIsoFixedCutTightAcc.isAvailable( *muon ) )          { m_isIsolated_FixedCutTight->Fill( isIsoFixedCutTightAcc( *muon ) ,  eventWeight ); } else { m_isIsolated_FixedCutTight->Fill( -1 ,  eventWeight ); }
-    if ( isIsoFixedCutTightTrackOnlyAcc.isAvailable( *muon ) )          { m_isIsolated_FixedCutTightTrackOnly->Fill( isIsoFixedCutTightTrackOnlyAcc( *muon ) ,  eventWeight ); } else { m_isIsolated_FixedCutTightTrackOnly->Fill( -1 ,  eventWeight ); }
-    if ( isIsoUserDefinedFixEfficiencyAcc.isAvailable( *muon ) ) { m_isIsolated_UserDefinedFixEfficiency->Fill( isIsoUserDefinedFixEfficiencyAcc( *muon ) ,  eventWeight ); } else { m_isIsolated_UserDefinedFixEfficiency->Fill( -1 ,  eventWeight ); }
-    if ( isIsoUserDefinedCutAcc.isAvailable( *muon ) )           { m_isIsolated_UserDefinedCut->Fill( isIsoUserDefinedCutAcc( *muon ) ,  eventWeight ); } else { m_isIsolated_UserDefinedCut->Fill( -1 ,  eventWeight ); }
-
-    m_ptcone20     ->Fill( muon->isolation( xAOD::Iso::ptcone20 )     ,  eventWeight );
-    m_ptcone30     ->Fill( muon->isolation( xAOD::Iso::ptcone30 )     ,  eventWeight );
-    m_ptcone40     ->Fill( muon->isolation( xAOD::Iso::ptcone40 )     ,  eventWeight );
-    m_ptvarcone20  ->Fill( muon->isolation( xAOD::Iso::ptvarcone20 )  ,  eventWeight );
-    m_ptvarcone30  ->Fill( muon->isolation( xAOD::Iso::ptvarcone30 )  ,  eventWeight );
-    m_ptvarcone40  ->Fill( muon->isolation( xAOD::Iso::ptvarcone40 )  ,  eventWeight );
-    m_topoetcone20 ->Fill( muon->isolation( xAOD::Iso::topoetcone20 ) ,  eventWeight );
-    m_topoetcone30 ->Fill( muon->isolation( xAOD::Iso::topoetcone30 ) ,  eventWeight );
-    m_topoetcone40 ->Fill( muon->isolation( xAOD::Iso::topoetcone40 ) ,  eventWeight );
+    if ( isIsoLooseTrackOnlyAcc.isAvailable( *muon ) ) { fill( m_isIsolated_LooseTrackOnly, isIsoLooseTrackOnlyAcc( *muon ) ,  eventWeight ); } else {fill( m_isIsolated_LooseTrackOnly, -1 ,  eventWeight );}
+    if ( isIsoLooseAcc.isAvailable( *muon ) )          { fill( m_isIsolated_Loose, isIsoLooseAcc( *muon ) ,  eventWeight ); } else { fill( m_isIsolated_Loose, -1 ,  eventWeight ); }
+    if ( isIsoTightAcc.isAvailable( *muon ) )          { fill( m_isIsolated_Tight, isIsoTightAcc( *muon ) ,  eventWeight ); } else { fill( m_isIsolated_Tight, -1 ,  eventWeight ); }
+    if ( isIsoGradientAcc.isAvailable( *muon ) )       { fill( m_isIsolated_Gradient, isIsoGradientAcc( *muon ) ,  eventWeight ); } else { fill( m_isIsolated_Gradient, -1 ,  eventWeight ); }
+    if ( isIsoGradientLooseAcc.isAvailable( *muon ) )  { fill( m_isIsolated_GradientLoose, isIsoGradientLooseAcc( *muon ) ,  eventWeight ); } else { fill( m_isIsolated_GradientLoose, -1 ,  eventWeight ); }
+    if ( isIsoGradientT1Acc.isAvailable( *muon ) )     { fill( m_isIsolated_GradientT1, isIsoGradientT1Acc( *muon ) ,  eventWeight ); } else { fill( m_isIsolated_GradientT1, -1 ,  eventWeight ); }
+    if ( isIsoGradientT2Acc.isAvailable( *muon ) )     { fill( m_isIsolated_GradientT2, isIsoGradientT2Acc( *muon ) ,  eventWeight ); } else { fill( m_isIsolated_GradientT2, -1 ,  eventWeight ); }
+    if ( isIsoMU0p06Acc.isAvailable( *muon ) )          { fill( m_isIsolated_MU0p06, isIsoMU0p06Acc( *muon ) ,  eventWeight ); } else { fill( m_isIsolated_MU0p06, -1 ,  eventWeight ); }
+    if ( isIsoFixedCutLooseAcc.isAvailable( *muon ) )          { fill( m_isIsolated_FixedCutLoose, isIsoFixedCutLooseAcc( *muon ) ,  eventWeight ); } else { fill( m_isIsolated_FixedCutLoose, -1 ,  eventWeight ); }
+    if ( isIsoFixedCutTightAcc.isAvailable( *muon ) )          { fill( m_isIsolated_FixedCutTight, isIsoFixedCutTightAcc( *muon ) ,  eventWeight ); } else { fill( m_isIsolated_FixedCutTight, -1 ,  eventWeight ); }
+    if ( isIsoFixedCutTightTrackOnlyAcc.isAvailable( *muon ) )          { fill( m_isIsolated_FixedCutTightTrackOnly, isIsoFixedCutTightTrackOnlyAcc( *muon ) ,  eventWeight ); } else { fill( m_isIsolated_FixedCutTightTrackOnly, -1 ,  eventWeight ); }
+    if ( isIsoUserDefinedFixEfficiencyAcc.isAvailable( *muon ) ) { fill( m_isIsolated_UserDefinedFixEfficiency, isIsoUserDefinedFixEfficiencyAcc( *muon ) ,  eventWeight ); } else { fill( m_isIsolated_UserDefinedFixEfficiency, -1 ,  eventWeight ); }
+    if ( isIsoUserDefinedCutAcc.isAvailable( *muon ) )           { fill( m_isIsolated_UserDefinedCut, isIsoUserDefinedCutAcc( *muon ) ,  eventWeight ); } else { fill( m_isIsolated_UserDefinedCut, -1 ,  eventWeight ); }
+
+    fill( m_ptcone20,      muon->isolation( xAOD::Iso::ptcone20 )     ,  eventWeight );
+    fill( m_ptcone30,      muon->isolation( xAOD::Iso::ptcone30 )     ,  eventWeight );
+    fill( m_ptcone40,      muon->isolation( xAOD::Iso::ptcone40 )     ,  eventWeight );
+    fill( m_ptvarcone20,   muon->isolation( xAOD::Iso::ptvarcone20 )  ,  eventWeight );
+    fill( m_ptvarcone30,   muon->isolation( xAOD::Iso::ptvarcone30 )  ,  eventWeight );
+    fill( m_ptvarcone40,   muon->isolation( xAOD::Iso::ptvarcone40 )  ,  eventWeight );
+    fill( m_topoetcone20,  muon->isolation( xAOD::Iso::topoetcone20 ) ,  eventWeight );
+    fill( m_topoetcone30,  muon->isolation( xAOD::Iso::topoetcone30 ) ,  eventWeight );
+    fill( m_topoetcone40,  muon->isolation( xAOD::Iso::topoetcone40 ) ,  eventWeight );
 
     float muonPt = muon->pt();
-    m_ptcone20_rel     ->Fill( muon->isolation( xAOD::Iso::ptcone20 )     / muonPt,  eventWeight );
-    m_ptcone30_rel     ->Fill( muon->isolation( xAOD::Iso::ptcone30 )     / muonPt,  eventWeight );
-    m_ptcone40_rel     ->Fill( muon->isolation( xAOD::Iso::ptcone40 )     / muonPt,  eventWeight );
-    m_ptvarcone20_rel  ->Fill( muon->isolation( xAOD::Iso::ptvarcone20 )  / muonPt,  eventWeight );
-    m_ptvarcone30_rel  ->Fill( muon->isolation( xAOD::Iso::ptvarcone30 )  / muonPt,  eventWeight );
-    m_ptvarcone40_rel  ->Fill( muon->isolation( xAOD::Iso::ptvarcone40 )  / muonPt,  eventWeight );
-    m_topoetcone20_rel ->Fill( muon->isolation( xAOD::Iso::topoetcone20 ) / muonPt,  eventWeight );
-    m_topoetcone30_rel ->Fill( muon->isolation( xAOD::Iso::topoetcone30 ) / muonPt,  eventWeight );
-    m_topoetcone40_rel ->Fill( muon->isolation( xAOD::Iso::topoetcone40 ) / muonPt,  eventWeight );
+    fill( m_ptcone20_rel,      muon->isolation( xAOD::Iso::ptcone20 )     / muonPt,  eventWeight );
+    fill( m_ptcone30_rel,      muon->isolation( xAOD::Iso::ptcone30 )     / muonPt,  eventWeight );
+    fill( m_ptcone40_rel,      muon->isolation( xAOD::Iso::ptcone40 )     / muonPt,  eventWeight );
+    fill( m_ptvarcone20_rel,   muon->isolation( xAOD::Iso::ptvarcone20 )  / muonPt,  eventWeight );
+    fill( m_ptvarcone30_rel,   muon->isolation( xAOD::Iso::ptvarcone30 )  / muonPt,  eventWeight );
+    fill( m_ptvarcone40_rel,   muon->isolation( xAOD::Iso::ptvarcone40 )  / muonPt,  eventWeight );
+    fill( m_topoetcone20_rel,  muon->isolation( xAOD::Iso::topoetcone20 ) / muonPt,  eventWeight );
+    fill( m_topoetcone30_rel,  muon->isolation( xAOD::Iso::topoetcone30 ) / muonPt,  eventWeight );
+    fill( m_topoetcone40_rel,  muon->isolation( xAOD::Iso::topoetcone40 ) / muonPt,  eventWeight );
 
 
   }
 
 
   if ( m_infoSwitch->m_quality ) {
-    static SG::AuxElement::Accessor<char> isVeryLooseQAcc ("isVeryLooseQ");
-    static SG::AuxElement::Accessor<char> isLooseQAcc ("isLooseQ");
-    static SG::AuxElement::Accessor<char> isMediumQAcc ("isMediumQ");
-    static SG::AuxElement::Accessor<char> isTightQAcc ("isTightQ");
-
-    if( isVeryLooseQAcc.isAvailable( *muon ) ) { m_isVeryLoose->Fill( static_cast<int>(isVeryLooseQAcc( *muon )),  eventWeight ); } else { m_isVeryLoose->Fill( -1 ,  eventWeight ); }
-    if( isLooseQAcc.isAvailable( *muon ) )     { m_isLoose    ->Fill( static_cast<int>(isLooseQAcc    ( *muon )),  eventWeight ); }         else { m_isLoose->Fill( -1 ,  eventWeight ); }
-    if( isMediumQAcc.isAvailable( *muon ) )    { m_isMedium   ->Fill( static_cast<int>(isMediumQAcc   ( *muon )),  eventWeight ); }       else { m_isMedium->Fill( -1 ,  eventWeight ); }
-    if( isTightQAcc.isAvailable( *muon ) )     { m_isTight    ->Fill( static_cast<int>(isTightQAcc    ( *muon )),  eventWeight ); }         else { m_isTight->Fill( -1 ,  eventWeight ); }
+    if( isVeryLooseQAcc.isAvailable( *muon ) ) { fill( m_isVeryLoose, static_cast<int>(isVeryLooseQAcc( *muon )),  eventWeight ); } else { fill( m_isVeryLoose, -1 ,  eventWeight ); }
+    if( isLooseQAcc.isAvailable( *muon ) )     { fill( m_isLoose,    static_cast<int>(isLooseQAcc    ( *muon )),  eventWeight ); }         else { fill( m_isLoose, -1 ,  eventWeight ); }
+    if( isMediumQAcc.isAvailable( *muon ) )    { fill( m_isMedium,   static_cast<int>(isMediumQAcc   ( *muon )),  eventWeight ); }       else { fill( m_isMedium, -1 ,  eventWeight ); }
+    if( isTightQAcc.isAvailable( *muon ) )     { fill( m_isTight,    static_cast<int>(isTightQAcc    ( *muon )),  eventWeight ); }         else { fill( m_isTight, -1 ,  eventWeight ); }
 
   }
 
@@ -189,52 +202,72 @@ StatusCode MuonHists::execute( const xAH::Particle* particle, float eventWeight,
   if ( m_infoSwitch->m_isolation ) {
 
 
-    m_isIsolated_LooseTrackOnly           ->Fill( muon->isIsolated_LooseTrackOnly ,  eventWeight );
-    m_isIsolated_Loose                    ->Fill( muon->isIsolated_Loose ,  eventWeight );
-    m_isIsolated_Tight                    ->Fill( muon->isIsolated_Tight ,  eventWeight );
-    m_isIsolated_Gradient                 ->Fill( muon->isIsolated_Gradient ,  eventWeight );
-    m_isIsolated_GradientLoose            ->Fill( muon->isIsolated_GradientLoose ,  eventWeight );
+    fill( m_isIsolated_LooseTrackOnly,            muon->isIsolated_LooseTrackOnly ,  eventWeight );
+    fill( m_isIsolated_Loose,                     muon->isIsolated_Loose ,  eventWeight );
+    fill( m_isIsolated_Tight,                     muon->isIsolated_Tight ,  eventWeight );
+    fill( m_isIsolated_Gradient,                  muon->isIsolated_Gradient ,  eventWeight );
+    fill( m_isIsolated_GradientLoose,             muon->isIsolated_GradientLoose ,  eventWeight );
     //m_isIsolated_GradientT1               ->Fill( muon->isIsolated_GradientLoose ,  eventWeight );
     //m_isIsolated_GradientT2               ->Fill( muon->isIsoGradientT2Acc ,  eventWeight );
     //m_isIsolated_MU0p06                   ->Fill( muon->isIsoMU0p06Acc ,  eventWeight );
-    m_isIsolated_FixedCutLoose            ->Fill( muon->isIsolated_FixedCutLoose ,  eventWeight );
+    fill( m_isIsolated_FixedCutLoose,             muon->isIsolated_FixedCutLoose ,  eventWeight );
     //m_isIsolated_FixedCutTight            ->Fill( muon->isIsolated_FixedCutTight ,  eventWeight );
-    m_isIsolated_FixedCutTightTrackOnly   ->Fill( muon->isIsolated_FixedCutTightTrackOnly ,  eventWeight );
-    m_isIsolated_UserDefinedFixEfficiency ->Fill( muon->isIsolated_UserDefinedFixEfficiency ,  eventWeight );
-    m_isIsolated_UserDefinedCut           ->Fill( muon->isIsolated_UserDefinedCut ,  eventWeight );
-
-    m_ptcone20     ->Fill( muon->ptcone20      ,  eventWeight );
-    m_ptcone30     ->Fill( muon->ptcone30      ,  eventWeight );
-    m_ptcone40     ->Fill( muon->ptcone40      ,  eventWeight );
-    m_ptvarcone20  ->Fill( muon->ptvarcone20   ,  eventWeight );
-    m_ptvarcone30  ->Fill( muon->ptvarcone30   ,  eventWeight );
-    m_ptvarcone40  ->Fill( muon->ptvarcone40   ,  eventWeight );
-    m_topoetcone20 ->Fill( muon->topoetcone20  ,  eventWeight );
-    m_topoetcone30 ->Fill( muon->topoetcone30  ,  eventWeight );
-    m_topoetcone40 ->Fill( muon->topoetcone40  ,  eventWeight );
+    fill( m_isIsolated_FixedCutTightTrackOnly,    muon->isIsolated_FixedCutTightTrackOnly ,  eventWeight );
+    fill( m_isIsolated_UserDefinedFixEfficiency,  muon->isIsolated_UserDefinedFixEfficiency ,  eventWeight );
+    fill( m_isIsolated_UserDefinedCut,            muon->isIsolated_UserDefinedCut ,  eventWeight );
+
+    fill( m_ptcone20,      muon->ptcone20      ,  eventWeight );
+    fill( m_ptcone30,      muon->ptcone30      ,  eventWeight );
+    fill( m_ptcone40,      muon->ptcone40      ,  eventWeight );
+    fill( m_ptvarcone20,   muon->ptvarcone20   ,  eventWeight );
+    fill( m_ptvarcone30,   muon->ptvarcone30   ,  eventWeight );
+    fill( m_ptvarcone40,   muon->ptvarcone40   ,  eventWeight );
+    fill( m_topoetcone20,  muon->topoetcone20  ,  eventWeight );
+    fill( m_topoetcone30,  muon->topoetcone30  ,  eventWeight );
+    fill( m_topoetcone40,  muon->topoetcone40  ,  eventWeight );
 
     float muonPt = muon->p4.Pt();
-    m_ptcone20_rel     ->Fill( muon->ptcone20/muonPt        ,  eventWeight );
-    m_ptcone30_rel     ->Fill( muon->ptcone30/muonPt        ,  eventWeight );
-    m_ptcone40_rel     ->Fill( muon->ptcone40/muonPt        ,  eventWeight );
-    m_ptvarcone20_rel  ->Fill( muon->ptvarcone20 /muonPt    ,  eventWeight );
-    m_ptvarcone30_rel  ->Fill( muon->ptvarcone30 /muonPt    ,  eventWeight );
-    m_ptvarcone40_rel  ->Fill( muon->ptvarcone40 /muonPt    ,  eventWeight );
-    m_topoetcone20_rel ->Fill( muon->topoetcone20/muonPt    ,  eventWeight );
-    m_topoetcone30_rel ->Fill( muon->topoetcone30/muonPt    ,  eventWeight );
-    m_topoetcone40_rel ->Fill( muon->topoetcone40/muonPt    ,  eventWeight );
+    fill( m_ptcone20_rel,      muon->ptcone20/muonPt        ,  eventWeight );
+    fill( m_ptcone30_rel,      muon->ptcone30/muonPt        ,  eventWeight );
+    fill( m_ptcone40_rel,      muon->ptcone40/muonPt        ,  eventWeight );
+    fill( m_ptvarcone20_rel,   muon->ptvarcone20 /muonPt    ,  eventWeight );
+    fill( m_ptvarcone30_rel,   muon->ptvarcone30 /muonPt    ,  eventWeight );
+    fill( m_ptvarcone40_rel,   muon->ptvarcone40 /muonPt    ,  eventWeight );
+    fill( m_topoetcone20_rel,  muon->topoetcone20/muonPt    ,  eventWeight );
+    fill( m_topoetcone30_rel,  muon->topoetcone30/muonPt    ,  eventWeight );
+    fill( m_topoetcone40_rel,  muon->topoetcone40/muonPt    ,  eventWeight );
 
   }
 
 
   if ( m_infoSwitch->m_quality ) {
 
-    m_isVeryLoose->Fill( muon->  isVeryLoose,  eventWeight );
-    m_isLoose    ->Fill( muon->  isLoose    ,  eventWeight );
-    m_isMedium   ->Fill( (muon->isMedium + muon->isTight)  ,  eventWeight );
-    m_isTight    ->Fill( muon->  isTight    ,  eventWeight );
+    fill( m_isVeryLoose, muon->  isVeryLoose,  eventWeight );
+    fill( m_isLoose,     muon->  isLoose    ,  eventWeight );
+    fill( m_isMedium,    (muon->isMedium + muon->isTight)  ,  eventWeight );
+    fill( m_isTight,     muon->  isTight    ,  eventWeight );
 
   }
 
   return StatusCode::SUCCESS;
 }
+
+void MuonHists::auxIDs( std::set< SG::auxid_t >& auxids ) const {
+  IParticleHists::auxIDs( auxids );
+
+  if ( m_infoSwitch->m_isolation ) {
+    for ( const auto* acc : { &isIsoLooseTrackOnlyAcc, &isIsoLooseAcc, &isIsoTightAcc, &isIsoGradientAcc, &isIsoGradientLooseAcc, &isIsoGradientT1Acc, &isIsoGradientT2Acc, &isIsoMU0p06Acc,
+                              &isIsoFixedCutLooseAcc, &isIsoFixedCutTightAcc, &isIsoFixedCutTightTrackOnlyAcc, &isIsoUserDefinedFixEfficiencyAcc, &isIsoUserDefinedCutAcc } ) {
+      auxids.insert( acc->auxid() );
+    }
+    for ( xAOD::Iso::IsolationType type : isolationTypes ) {
+      auxids.insert( xAOD::getIsolationAccessor( type )->auxid() );
+    }
+  }
+
+  if ( m_infoSwitch->m_quality ) {
+    for ( const auto* acc : { &isVeryLooseQAcc, &isLooseQAcc, &isMediumQAcc, &isTightQAcc } ) {
+      auxids.insert( acc->auxid() );
+    }
+  }
+}
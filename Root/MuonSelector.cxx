@@ -115,6 +115,9 @@ EL::StatusCode MuonSelector :: initialize ()
 
   ANA_MSG_INFO( "Initializing MuonSelector Interface... ");
 
+  // |eta| is left to the MuonSelectionTool
+  m_kinematicPreFilter.setCuts( m_pT_min, m_pT_max, 1e8 );
+
   // Let's see if the algorithm has been already used before:
   // if yes, will write object cutflow in a different histogram!
   //
@@ -173,6 +176,9 @@ EL::StatusCode MuonSelector :: initialize ()
         m_mu_cutflow_cosmic_cut		 = m_mu_cutflowHist_2->GetXaxis()->FindBin("cosmic_cut");
     }
 
+    m_mu_cutflowCounter_1.setHistogram( m_mu_cutflowHist_1 );
+    if ( m_isUsedBefore ) m_mu_cutflowCounter_2.setHistogram( m_mu_cutflowHist_2 );
+
   }// if m_useCutFlow
 
   m_event = wk()->xaodEvent();
@@ -225,6 +231,9 @@ EL::StatusCode MuonSelector :: initialize ()
     return EL::StatusCode::FAILURE;
   }
 
+  m_inContainerKeys.setPrefix( m_inContainerName );
+  m_outContainerKeys.setPrefix( m_outContainerName );
+
   m_numEvent      = 0;
   m_numObject     = 0;
   m_numEventPass  = 0;
@@ -334,6 +343,7 @@ EL::StatusCode MuonSelector :: initialize ()
 
 EL::StatusCode MuonSelector :: execute ()
 {
+  xAH::ExecuteProfiler profiler(this);
   // Here you do everything that needs to be done on every single
   // events, e.g. read input variables, apply cuts, and fill
   // histograms and trees.  This is where most of your actual analysis
@@ -438,11 +448,14 @@ EL::StatusCode MuonSelector :: execute ()
     // loop over systematic sets
     //
     bool eventPassThisSyst(false);
-    for ( auto systName : *systNames ) {
+    xAH::SystematicRegistry& systRegistry = xAH::SystematicRegistry::instance();
+    for ( const auto& systName : *systNames ) {
 
-      ANA_MSG_DEBUG( " syst name: " << systName << "  input container name: " << m_inContainerName+systName );
+      unsigned int systID = systRegistry.id( systName );
 
-      ANA_CHECK( HelperFunctions::retrieve(inMuons, m_inContainerName + systName, m_event, m_store, msg()) );
+      ANA_MSG_DEBUG( " syst name: " << systName << "  input container name: " << m_inContainerKeys.key(systID) );
+
+      ANA_CHECK( HelperFunctions::retrieve(inMuons, m_inContainerKeys.key(systID), m_event, m_store, msg()) );
 
       // create output container (if requested) - one for each systematic
       //
@@ -465,13 +478,13 @@ EL::StatusCode MuonSelector :: execute ()
       //
       eventPass = ( eventPass || eventPassThisSyst );
 
-      ANA_MSG_DEBUG( " syst name: " << systName << "  output container name: " << m_outContainerName+systName );
+      ANA_MSG_DEBUG( " syst name: " << systName << "  output container name: " << m_outContainerKeys.key(systID) );
 
       if ( m_createSelectedContainer ) {
         if ( eventPassThisSyst ) {
           // add ConstDataVector to TStore
 	  //
-          ANA_CHECK( m_store->record( selectedMuons, m_outContainerName+systName ));
+          ANA_CHECK( m_store->record( selectedMuons, m_outContainerKeys.key(systID) ));
         } else {
           // if the event does not pass the selection for this syst, CDV won't be ever recorded to TStore, so we have to delete it!
           delete selectedMuons; selectedMuons = nullptr;
@@ -509,11 +522,19 @@ bool MuonSelector :: executeSelection ( const xAOD::MuonContainer* inMuons, floa
   ANA_MSG_DEBUG( "In  executeSelection..." );
   const xAOD::VertexContainer* vertices(nullptr);
   ANA_CHECK( HelperFunctions::retrieve(vertices, "PrimaryVertices", m_event, m_store, msg()) );
-  const xAOD::Vertex *pvx = HelperFunctions::getPrimaryVertex(vertices, msg());
+  const xAOD::EventInfo* eventInfo(nullptr);
+  ANA_CHECK( HelperFunctions::retrieve(eventInfo, m_eventInfoContainerName, m_event, m_store, msg()) );
+  const xAOD::Vertex *pvx = HelperFunctions::getPrimaryVertex(vertices, eventInfo, msg());
 
   int nPass(0); int nObj(0);
   static SG::AuxElement::Decorator< char > passSelDecor( "passSel" );
 
+  // cheap kinematic cuts for all muons at once, passCuts only has to look at the survivors
+  const bool usePreFilter = m_doKinematicPreFilter && m_kinematicPreFilter.active();
+  if ( usePreFilter ) {
+    m_kinematicPreFilter.apply( *inMuons, [](const xAOD::Muon* muon) { return muon->eta(); } );
+  }
+
   for ( auto mu_itr : *inMuons ) { // duplicated of basic loop
 
     // if only looking at a subset of muons make sure all are decorated
@@ -528,7 +549,13 @@ bool MuonSelector :: executeSelection ( const xAOD::MuonContainer* inMuons, floa
     }
 
     nObj++;
-    bool passSel = this->passCuts( mu_itr, pvx );
+    bool passSel(false);
+    if ( usePreFilter && !m_kinematicPreFilter.passed( nObj-1 ) ) {
+      if(m_useCutFlow) m_mu_cutflowCounter_1.fill( m_mu_cutflow_all );
+      if ( m_isUsedBefore && m_useCutFlow ) { m_mu_cutflowCounter_2.fill( m_mu_cutflow_all ); }
+    } else {
+      passSel = this->passCuts( mu_itr, pvx );
+    }
     if ( m_decorateSelectedObjects ) {
       passSelDecor( *mu_itr ) = passSel;
     }
@@ -633,9 +660,6 @@ bool MuonSelector :: executeSelection ( const xAOD::MuonContainer* inMuons, floa
 
       ANA_MSG_DEBUG( "Doing di-muon trigger matching...");
 
-      const xAOD::EventInfo* eventInfo(nullptr);
-      ANA_CHECK( HelperFunctions::retrieve(eventInfo, m_eventInfoContainerName, m_event, m_store, msg()) );
-
       typedef std::pair< std::pair<unsigned int,unsigned int>, char> dimuon_trigmatch_pair;
       typedef std::multimap< std::string, dimuon_trigmatch_pair >    dimuon_trigmatch_pair_map;
       static SG::AuxElement::Decorator< dimuon_trigmatch_pair_map >  diMuonTrigMatchPairMapDecor( "diMuonTrigMatchPairMap" );
@@ -714,6 +738,8 @@ EL::StatusCode MuonSelector :: finalize ()
     ANA_MSG_INFO( "Filling cutflow");
     m_cutflowHist ->SetBinContent( m_cutflow_bin, m_numEventPass        );
     m_cutflowHistW->SetBinContent( m_cutflow_bin, m_weightNumEventPass  );
+    m_mu_cutflowCounter_1.flush();
+    m_mu_cutflowCounter_2.flush();
   }
 
   return EL::StatusCode::SUCCESS;
@@ -743,8 +769,8 @@ int MuonSelector :: passCuts( const xAOD::Muon* muon, const xAOD::Vertex *primar
 
   ANA_MSG_DEBUG( "In  passCuts..." );
   // fill cutflow bin 'all' before any cut
-  if(m_useCutFlow) m_mu_cutflowHist_1->Fill( m_mu_cutflow_all, 1 );
-  if ( m_isUsedBefore && m_useCutFlow ) { m_mu_cutflowHist_2->Fill( m_mu_cutflow_all, 1 ); }
+  if(m_useCutFlow) m_mu_cutflowCounter_1.fill( m_mu_cutflow_all );
+  if ( m_isUsedBefore && m_useCutFlow ) { m_mu_cutflowCounter_2.fill( m_mu_cutflow_all ); }
   ANA_MSG_DEBUG( "In  passCuts2..." );
   // *********************************************************************************************************************************************************************
   //
@@ -772,8 +798,8 @@ int MuonSelector :: passCuts( const xAOD::Muon* muon, const xAOD::Vertex *primar
     return 0;
   }
 
-  if(m_useCutFlow) m_mu_cutflowHist_1->Fill( m_mu_cutflow_eta_and_quaility_cut, 1 );
-  if ( m_isUsedBefore && m_useCutFlow ) { m_mu_cutflowHist_2->Fill( m_mu_cutflow_eta_and_quaility_cut, 1 ); }
+  if(m_useCutFlow) m_mu_cutflowCounter_1.fill( m_mu_cutflow_eta_and_quaility_cut );
+  if ( m_isUsedBefore && m_useCutFlow ) { m_mu_cutflowCounter_2.fill( m_mu_cutflow_eta_and_quaility_cut ); }
 
   // *********************************************************************************************************************************************************************
   //
@@ -786,8 +812,8 @@ int MuonSelector :: passCuts( const xAOD::Muon* muon, const xAOD::Vertex *primar
       return 0;
     }
   }
-  if(m_useCutFlow) m_mu_cutflowHist_1->Fill( m_mu_cutflow_ptmax_cut, 1 );
-  if ( m_isUsedBefore && m_useCutFlow ) { m_mu_cutflowHist_2->Fill( m_mu_cutflow_ptmax_cut, 1 ); }
+  if(m_useCutFlow) m_mu_cutflowCounter_1.fill( m_mu_cutflow_ptmax_cut );
+  if ( m_isUsedBefore && m_useCutFlow ) { m_mu_cutflowCounter_2.fill( m_mu_cutflow_ptmax_cut ); }
 
   // *********************************************************************************************************************************************************************
   //
@@ -799,8 +825,8 @@ int MuonSelector :: passCuts( const xAOD::Muon* muon, const xAOD::Vertex *primar
       return 0;
     }
   }
-  if(m_useCutFlow) m_mu_cutflowHist_1->Fill( m_mu_cutflow_ptmin_cut, 1 );
-  if ( m_isUsedBefore && m_useCutFlow ) { m_mu_cutflowHist_2->Fill( m_mu_cutflow_ptmin_cut, 1 ); }
+  if(m_useCutFlow) m_mu_cutflowCounter_1.fill( m_mu_cutflow_ptmin_cut );
+  if ( m_isUsedBefore && m_useCutFlow ) { m_mu_cutflowCounter_2.fill( m_mu_cutflow_ptmin_cut ); }
 
   // *********************************************************************************************************************************************************************
   //
@@ -813,8 +839,8 @@ int MuonSelector :: passCuts( const xAOD::Muon* muon, const xAOD::Vertex *primar
   //    return 0;
   //  }
   //}
-  //if(m_useCutFlow) m_mu_cutflowHist_1->Fill( m_mu_cutflow_type_cut, 1 );
-  //if ( m_isUsedBefore && m_useCutFlow ) { m_mu_cutflowHist_2->Fill( m_mu_cutflow_type_cut, 1 ); }
+  //if(m_useCutFlow) m_mu_cutflowCounter_1.fill( m_mu_cutflow_type_cut );
+  //if ( m_isUsedBefore && m_useCutFlow ) { m_mu_cutflowCounter_2.fill( m_mu_cutflow_type_cut ); }
 
   // *********************************************************************************************************************************************************************
   //
@@ -854,8 +880,8 @@ int MuonSelector :: passCuts( const xAOD::Muon* muon, const xAOD::Vertex *primar
       ANA_MSG_DEBUG( "Muon failed z0*sin(theta) cut.");
       return 0;
   }
-  if(m_useCutFlow) m_mu_cutflowHist_1->Fill( m_mu_cutflow_z0sintheta_cut, 1 );
-  if ( m_isUsedBefore && m_useCutFlow ) { m_mu_cutflowHist_2->Fill( m_mu_cutflow_z0sintheta_cut, 1 ); }
+  if(m_useCutFlow) m_mu_cutflowCounter_1.fill( m_mu_cutflow_z0sintheta_cut );
+  if ( m_isUsedBefore && m_useCutFlow ) { m_mu_cutflowCounter_2.fill( m_mu_cutflow_z0sintheta_cut ); }
 
   // decorate muon w/ z0*sin(theta) info
   static SG::AuxElement::Decorator< float > z0sinthetaDecor("z0sintheta");
@@ -867,8 +893,8 @@ int MuonSelector :: passCuts( const xAOD::Muon* muon, const xAOD::Vertex *primar
       ANA_MSG_DEBUG( "Muon failed d0 cut.");
       return 0;
   }
-  if(m_useCutFlow) m_mu_cutflowHist_1->Fill( m_mu_cutflow_d0_cut, 1 );
-  if ( m_isUsedBefore && m_useCutFlow ) { m_mu_cutflowHist_2->Fill( m_mu_cutflow_d0_cut, 1 ); }
+  if(m_useCutFlow) m_mu_cutflowCounter_1.fill( m_mu_cutflow_d0_cut );
+  if ( m_isUsedBefore && m_useCutFlow ) { m_mu_cutflowCounter_2.fill( m_mu_cutflow_d0_cut ); }
 
   // d0sig cut
   //
@@ -876,8 +902,8 @@ int MuonSelector :: passCuts( const xAOD::Muon* muon, const xAOD::Vertex *primar
       ANA_MSG_DEBUG( "Muon failed d0 significance cut.");
       return 0;
   }
-  if(m_useCutFlow) m_mu_cutflowHist_1->Fill( m_mu_cutflow_d0sig_cut, 1 );
-  if ( m_isUsedBefore && m_useCutFlow ) { m_mu_cutflowHist_2->Fill( m_mu_cutflow_d0sig_cut, 1 ); }
+  if(m_useCutFlow) m_mu_cutflowCounter_1.fill( m_mu_cutflow_d0sig_cut );
+  if ( m_isUsedBefore && m_useCutFlow ) { m_mu_cutflowCounter_2.fill( m_mu_cutflow_d0sig_cut ); }
 
   // decorate muon w/ d0sig info
   static SG::AuxElement::Decorator< float > d0SigDecor("d0sig");
@@ -910,8 +936,8 @@ int MuonSelector :: passCuts( const xAOD::Muon* muon, const xAOD::Vertex *primar
     ANA_MSG_DEBUG( "Muon failed isolation cut " <<  m_MinIsoWPCut );
     return 0;
   }
-  if(m_useCutFlow) m_mu_cutflowHist_1->Fill( m_mu_cutflow_iso_cut, 1 );
-  if ( m_isUsedBefore && m_useCutFlow ) { m_mu_cutflowHist_2->Fill( m_mu_cutflow_iso_cut, 1 ); }
+  if(m_useCutFlow) m_mu_cutflowCounter_1.fill( m_mu_cutflow_iso_cut );
+  if ( m_isUsedBefore && m_useCutFlow ) { m_mu_cutflowCounter_2.fill( m_mu_cutflow_iso_cut ); }
 
   if( m_removeCosmicMuon ){
 
@@ -923,8 +949,8 @@ int MuonSelector :: passCuts( const xAOD::Muon* muon, const xAOD::Vertex *primar
       ANA_MSG_DEBUG("Muon failed cosmic cut" );
       return 0;
     }
-    if(m_useCutFlow) m_mu_cutflowHist_1->Fill( m_mu_cutflow_cosmic_cut, 1 );
-    if ( m_isUsedBefore && m_useCutFlow ) { m_mu_cutflowHist_2->Fill( m_mu_cutflow_cosmic_cut, 1 ); }
+    if(m_useCutFlow) m_mu_cutflowCounter_1.fill( m_mu_cutflow_cosmic_cut );
+    if ( m_isUsedBefore && m_useCutFlow ) { m_mu_cutflowCounter_2.fill( m_mu_cutflow_cosmic_cut ); }
 
   }
 
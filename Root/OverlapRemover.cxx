@@ -137,6 +137,17 @@ EL::StatusCode OverlapRemover :: initialize ()
   m_outAuxContainerName_Photons     = m_outContainerName_Photons + "Aux.";   // the period is very important!
   m_outAuxContainerName_Taus        = m_outContainerName_Taus + "Aux.";      // the period is very important!
 
+  m_inContainerKeys_Electrons.setPrefix( m_inContainerName_Electrons );
+  m_inContainerKeys_Muons.setPrefix( m_inContainerName_Muons );
+  m_inContainerKeys_Jets.setPrefix( m_inContainerName_Jets );
+  m_inContainerKeys_Photons.setPrefix( m_inContainerName_Photons );
+  m_inContainerKeys_Taus.setPrefix( m_inContainerName_Taus );
+  m_outContainerKeys_Electrons.setPrefix( m_outContainerName_Electrons );
+  m_outContainerKeys_Muons.setPrefix( m_outContainerName_Muons );
+  m_outContainerKeys_Jets.setPrefix( m_outContainerName_Jets );
+  m_outContainerKeys_Photons.setPrefix( m_outContainerName_Photons );
+  m_outContainerKeys_Taus.setPrefix( m_outContainerName_Taus );
+
   if ( setCounters() == EL::StatusCode::FAILURE ) {
     ANA_MSG_ERROR( "Failed to properly set event/object counters. Exiting." );
     return EL::StatusCode::FAILURE;
@@ -163,6 +174,15 @@ EL::StatusCode OverlapRemover :: initialize ()
 
   ANA_CHECK( ORUtils::recommendedTools(orFlags, m_ORToolbox));
   ANA_CHECK( m_ORToolbox.initialize());
+
+  if ( m_reuseNominalOR && !m_useSpatialIndex ) {
+    ANA_MSG_INFO( "Reusing nominal OLR decisions needs the spatial index, switching on m_useSpatialIndex" );
+    m_useSpatialIndex = true;
+  }
+  if ( m_useSpatialIndex ) {
+    ANA_MSG_INFO( "Only objects with a neighbour within DeltaR < " << m_spatialIndexMaxDeltaR << " will be passed to the OLR tool" );
+    m_ORGrid = xAH::EtaPhiGrid( m_spatialIndexMaxDeltaR );
+  }
   ANA_MSG_INFO( "OverlapRemover Interface succesfully initialized!" );
 
   return EL::StatusCode::SUCCESS;
@@ -171,6 +191,7 @@ EL::StatusCode OverlapRemover :: initialize ()
 
 EL::StatusCode OverlapRemover :: execute ()
 {
+  xAH::ExecuteProfiler profiler(this);
   // Here you do everything that needs to be done on every single
   // events, e.g. read input variables, apply cuts, and fill
   // histograms and trees.  This is where most of your actual analysis
@@ -179,6 +200,7 @@ EL::StatusCode OverlapRemover :: execute ()
   ANA_MSG_DEBUG("Applying Overlap Removal... ");
 
   m_numEvent++;
+  m_ORNominalResultsValid = false;
 
   // get the collections from TEvent or TStore
   const xAOD::ElectronContainer* inElectrons (nullptr);
@@ -335,6 +357,14 @@ EL::StatusCode OverlapRemover :: finalize ()
 
   ANA_MSG_INFO( "Deleting tool instances...");
 
+  if ( m_useCutFlow ) {
+    m_el_cutflowCounter_1.flush();
+    m_mu_cutflowCounter_1.flush();
+    m_jet_cutflowCounter_1.flush();
+    m_ph_cutflowCounter_1.flush();
+    m_tau_cutflowCounter_1.flush();
+  }
+
   return EL::StatusCode::SUCCESS;
 }
 
@@ -379,26 +409,26 @@ EL::StatusCode OverlapRemover :: fillObjectCutflow (const xAOD::IParticleContain
       case xAOD::Type::Electron:
         type = "electron";
         if (!overlapAcc( *obj_itr ))
-          m_el_cutflowHist_1->Fill( m_el_cutflow_OR_cut, 1 );
+          m_el_cutflowCounter_1.fill( m_el_cutflow_OR_cut );
         break;
       case xAOD::Type::Muon:
         if (!overlapAcc( *obj_itr ))
-          m_mu_cutflowHist_1->Fill( m_mu_cutflow_OR_cut, 1 );
+          m_mu_cutflowCounter_1.fill( m_mu_cutflow_OR_cut );
         type = "muon";
         break;
       case xAOD::Type::Jet:
         if (!overlapAcc( *obj_itr ))
-          m_jet_cutflowHist_1->Fill( m_jet_cutflow_OR_cut, 1 );
+          m_jet_cutflowCounter_1.fill( m_jet_cutflow_OR_cut );
         type = "jet";
         break;
       case xAOD::Type::Photon:
         if (!overlapAcc( *obj_itr ))
-          m_ph_cutflowHist_1->Fill( m_ph_cutflow_OR_cut, 1 );
+          m_ph_cutflowCounter_1.fill( m_ph_cutflow_OR_cut );
         type = "photon";
         break;
       case xAOD::Type::Tau:
         if (!overlapAcc( *obj_itr ))
-          m_tau_cutflowHist_1->Fill( m_tau_cutflow_OR_cut, 1 );
+          m_tau_cutflowCounter_1.fill( m_tau_cutflow_OR_cut );
         type = "tau";
         break;
       default:
@@ -509,7 +539,7 @@ EL::StatusCode OverlapRemover :: executeOR(  const xAOD::ElectronContainer* inEl
       // do the actual OR
       //
       ANA_MSG_DEBUG(  "Calling removeOverlaps()");
-      ANA_CHECK( m_ORToolbox.masterTool->removeOverlaps(inElectrons, inMuons, inJets, inTaus, inPhotons));
+      ANA_CHECK( removeOverlaps(inElectrons, inMuons, inJets, inTaus, inPhotons, syst_type));
       ANA_MSG_DEBUG(  "Done Calling removeOverlaps()");
 
       std::string ORdecor("passOR");
@@ -613,18 +643,20 @@ EL::StatusCode OverlapRemover :: executeOR(  const xAOD::ElectronContainer* inEl
       if ( nomContainerNotFound ) {return EL::StatusCode::SUCCESS;}
 
 
-      for ( auto systName : *sysVec) {
+      for ( const auto& systName : *sysVec ) {
 
         if ( systName.empty() ) continue;
 
+        unsigned int systID = xAH::SystematicRegistry::instance().id( systName );
+
         // ... instead, the electron input container will be different for each syst
         //
-        std::string el_syst_cont_name = m_inContainerName_Electrons + systName;
+        const std::string& el_syst_cont_name = m_inContainerKeys_Electrons.key(systID);
         ANA_CHECK( HelperFunctions::retrieve(inElectrons, el_syst_cont_name, 0, m_store, msg()) );
 
         // do the actual OR
         //
-        ANA_CHECK( m_ORToolbox.masterTool->removeOverlaps(inElectrons, inMuons, inJets, inTaus, inPhotons));
+        ANA_CHECK( removeOverlaps(inElectrons, inMuons, inJets, inTaus, inPhotons, syst_type));
 
         const std::string ORdecor("passOR");
         if(m_useCutFlow){
@@ -659,11 +691,11 @@ EL::StatusCode OverlapRemover :: executeOR(  const xAOD::ElectronContainer* inEl
         //
         if ( m_createSelectedContainers ) {
           // a different syst varied container will be stored for each syst variation
-          ANA_CHECK( m_store->record( selectedElectrons, m_outContainerName_Electrons + systName ));
-          if ( m_useMuons )  { ANA_CHECK( m_store->record( selectedMuons,     m_outContainerName_Muons + systName )); }
-          ANA_CHECK( m_store->record( selectedJets,      m_outContainerName_Jets + systName ));
-          if ( m_usePhotons ){ ANA_CHECK( m_store->record( selectedPhotons, m_outContainerName_Photons + systName )); }
-          if ( m_useTaus )   { ANA_CHECK( m_store->record( selectedTaus, m_outContainerName_Taus + systName )); }
+          ANA_CHECK( m_store->record( selectedElectrons, m_outContainerKeys_Electrons.key(systID) ));
+          if ( m_useMuons )  { ANA_CHECK( m_store->record( selectedMuons,     m_outContainerKeys_Muons.key(systID) )); }
+          ANA_CHECK( m_store->record( selectedJets,      m_outContainerKeys_Jets.key(systID) ));
+          if ( m_usePhotons ){ ANA_CHECK( m_store->record( selectedPhotons, m_outContainerKeys_Photons.key(systID) )); }
+          if ( m_useTaus )   { ANA_CHECK( m_store->record( selectedTaus, m_outContainerKeys_Taus.key(systID) )); }
         }
 
         m_vecOutContainerNames->push_back(systName);
@@ -718,18 +750,20 @@ EL::StatusCode OverlapRemover :: executeOR(  const xAOD::ElectronContainer* inEl
       if ( nomContainerNotFound ) {return EL::StatusCode::SUCCESS;}
 
 
-      for ( auto systName : *sysVec) {
+      for ( const auto& systName : *sysVec ) {
 
         if ( systName.empty() ) continue;
 
+        unsigned int systID = xAH::SystematicRegistry::instance().id( systName );
+
         // ... instead, the muon input container will be different for each syst
         //
-        std::string mu_syst_cont_name = m_inContainerName_Muons + systName;
+        const std::string& mu_syst_cont_name = m_inContainerKeys_Muons.key(systID);
         ANA_CHECK( HelperFunctions::retrieve(inMuons, mu_syst_cont_name, 0, m_store, msg()) );
 
         // do the actual OR
         //
-        ANA_CHECK( m_ORToolbox.masterTool->removeOverlaps(inElectrons, inMuons, inJets, inTaus, inPhotons));
+        ANA_CHECK( removeOverlaps(inElectrons, inMuons, inJets, inTaus, inPhotons, syst_type));
 
         const std::string ORdecor("passOR");
         if(m_useCutFlow){
@@ -764,11 +798,11 @@ EL::StatusCode OverlapRemover :: executeOR(  const xAOD::ElectronContainer* inEl
         if ( m_createSelectedContainers ) {
           // a different syst varied container will be stored for each syst variation
           //
-          if ( m_useElectrons ) { ANA_CHECK( m_store->record( selectedElectrons, m_outContainerName_Electrons + systName )); }
-          ANA_CHECK( m_store->record( selectedMuons,     m_outContainerName_Muons + systName ));
-          ANA_CHECK( m_store->record( selectedJets,      m_outContainerName_Jets + systName ));
-          if ( m_usePhotons )   { ANA_CHECK( m_store->record( selectedPhotons, m_outContainerName_Photons + systName )); }
-          if ( m_useTaus )      { ANA_CHECK( m_store->record( selectedTaus, m_outContainerName_Taus + systName )); }
+          if ( m_useElectrons ) { ANA_CHECK( m_store->record( selectedElectrons, m_outContainerKeys_Electrons.key(systID) )); }
+          ANA_CHECK( m_store->record( selectedMuons,     m_outContainerKeys_Muons.key(systID) ));
+          ANA_CHECK( m_store->record( selectedJets,      m_outContainerKeys_Jets.key(systID) ));
+          if ( m_usePhotons )   { ANA_CHECK( m_store->record( selectedPhotons, m_outContainerKeys_Photons.key(systID) )); }
+          if ( m_useTaus )      { ANA_CHECK( m_store->record( selectedTaus, m_outContainerKeys_Taus.key(systID) )); }
         }
 
         m_vecOutContainerNames->push_back(systName);
@@ -824,18 +858,20 @@ EL::StatusCode OverlapRemover :: executeOR(  const xAOD::ElectronContainer* inEl
 
       if ( nomContainerNotFound ) {return EL::StatusCode::SUCCESS;}
 
-      for( auto systName : *sysVec ) {
+      for ( const auto& systName : *sysVec ) {
 
         if ( systName.empty() ) continue;
 
+        unsigned int systID = xAH::SystematicRegistry::instance().id( systName );
+
         // ... instead, the jet input container will be different for each syst
         //
-        std::string jet_syst_cont_name = m_inContainerName_Jets + systName;
+        const std::string& jet_syst_cont_name = m_inContainerKeys_Jets.key(systID);
         ANA_CHECK( HelperFunctions::retrieve(inJets, jet_syst_cont_name, 0, m_store, msg()) );
 
         // do the actual OR
         //
-        ANA_CHECK( m_ORToolbox.masterTool->removeOverlaps(inElectrons, inMuons, inJets, inTaus, inPhotons));
+        ANA_CHECK( removeOverlaps(inElectrons, inMuons, inJets, inTaus, inPhotons, syst_type));
 
         const std::string ORdecor("passOR");
         if(m_useCutFlow){
@@ -871,11 +907,11 @@ EL::StatusCode OverlapRemover :: executeOR(  const xAOD::ElectronContainer* inEl
         if ( m_createSelectedContainers ) {
           // a different syst varied container will be stored for each syst variation
           //
-          if ( m_useElectrons ) { ANA_CHECK( m_store->record( selectedElectrons, m_outContainerName_Electrons + systName )); }
-          if ( m_useMuons )   { ANA_CHECK( m_store->record( selectedMuons,     m_outContainerName_Muons + systName )); }
-          ANA_CHECK( m_store->record( selectedJets,      m_outContainerName_Jets + systName ));
-          if ( m_usePhotons )   { ANA_CHECK( m_store->record( selectedPhotons, m_outContainerName_Photons + systName )); }
-          if ( m_useTaus )      { ANA_CHECK( m_store->record( selectedTaus, m_outContainerName_Taus + systName )); }
+          if ( m_useElectrons ) { ANA_CHECK( m_store->record( selectedElectrons, m_outContainerKeys_Electrons.key(systID) )); }
+          if ( m_useMuons )   { ANA_CHECK( m_store->record( selectedMuons,     m_outContainerKeys_Muons.key(systID) )); }
+          ANA_CHECK( m_store->record( selectedJets,      m_outContainerKeys_Jets.key(systID) ));
+          if ( m_usePhotons )   { ANA_CHECK( m_store->record( selectedPhotons, m_outContainerKeys_Photons.key(systID) )); }
+          if ( m_useTaus )      { ANA_CHECK( m_store->record( selectedTaus, m_outContainerKeys_Taus.key(systID) )); }
         }
 
         m_vecOutContainerNames->push_back(systName);
@@ -929,18 +965,20 @@ EL::StatusCode OverlapRemover :: executeOR(  const xAOD::ElectronContainer* inEl
 
       if ( nomContainerNotFound ) {return EL::StatusCode::SUCCESS;}
 
-      for( auto systName : *sysVec ) {
+      for ( const auto& systName : *sysVec ) {
 
         if ( systName.empty() ) continue;
 
+        unsigned int systID = xAH::SystematicRegistry::instance().id( systName );
+
         // ... instead, the photon input container will be different for each syst
         //
-        std::string photon_syst_cont_name = m_inContainerName_Photons + systName;
+        const std::string& photon_syst_cont_name = m_inContainerKeys_Photons.key(systID);
         ANA_CHECK( HelperFunctions::retrieve(inPhotons, photon_syst_cont_name, 0, m_store, msg()) );
 
         // do the actual OR
         //
-        ANA_CHECK( m_ORToolbox.masterTool->removeOverlaps(inElectrons, inMuons, inJets, inTaus, inPhotons));
+        ANA_CHECK( removeOverlaps(inElectrons, inMuons, inJets, inTaus, inPhotons, syst_type));
 
 
         const std::string ORdecor("passOR");
@@ -977,11 +1015,11 @@ EL::StatusCode OverlapRemover :: executeOR(  const xAOD::ElectronContainer* inEl
         if ( m_createSelectedContainers ) {
           // a different syst varied container will be stored for each syst variation
           //
-          if( m_useElectrons ){ ANA_CHECK( m_store->record( selectedElectrons, m_outContainerName_Electrons + systName )); }
-          if( m_useMuons )    { ANA_CHECK( m_store->record( selectedMuons,     m_outContainerName_Muons + systName )); }
-          ANA_CHECK( m_store->record( selectedJets,      m_outContainerName_Jets + systName ));
-          ANA_CHECK( m_store->record( selectedPhotons,   m_outContainerName_Photons + systName ));
-          if ( m_useTaus )    { ANA_CHECK( m_store->record( selectedTaus, m_outContainerName_Taus + systName )); }
+          if( m_useElectrons ){ ANA_CHECK( m_store->record( selectedElectrons, m_outContainerKeys_Electrons.key(systID) )); }
+          if( m_useMuons )    { ANA_CHECK( m_store->record( selectedMuons,     m_outContainerKeys_Muons.key(systID) )); }
+          ANA_CHECK( m_store->record( selectedJets,      m_outContainerKeys_Jets.key(systID) ));
+          ANA_CHECK( m_store->record( selectedPhotons,   m_outContainerKeys_Photons.key(systID) ));
+          if ( m_useTaus )    { ANA_CHECK( m_store->record( selectedTaus, m_outContainerKeys_Taus.key(systID) )); }
         }
 
         m_vecOutContainerNames->push_back(systName);
@@ -1035,18 +1073,20 @@ EL::StatusCode OverlapRemover :: executeOR(  const xAOD::ElectronContainer* inEl
 
       if ( nomContainerNotFound ) {return EL::StatusCode::SUCCESS;}
 
-      for( auto systName : *sysVec ) {
+      for ( const auto& systName : *sysVec ) {
 
         if ( systName.empty() ) continue;
 
+        unsigned int systID = xAH::SystematicRegistry::instance().id( systName );
+
         // ... instead, the tau input container will be different for each syst
         //
-        std::string tau_syst_cont_name = m_inContainerName_Taus + systName;
+        const std::string& tau_syst_cont_name = m_inContainerKeys_Taus.key(systID);
         ANA_CHECK( HelperFunctions::retrieve(inTaus, tau_syst_cont_name, 0, m_store, msg()) );
 
         // do the actual OR
         //
-        ANA_CHECK( m_ORToolbox.masterTool->removeOverlaps(inElectrons, inMuons, inJets, inTaus, inPhotons));
+        ANA_CHECK( removeOverlaps(inElectrons, inMuons, inJets, inTaus, inPhotons, syst_type));
 
         const std::string ORdecor("passOR");
         if(m_useCutFlow){
@@ -1082,11 +1122,11 @@ EL::StatusCode OverlapRemover :: executeOR(  const xAOD::ElectronContainer* inEl
         if ( m_createSelectedContainers ) {
           // a different syst varied container will be stored for each syst variation
           //
-          if( m_useElectrons ) { ANA_CHECK( m_store->record( selectedElectrons, m_outContainerName_Electrons + systName )); }
-          if( m_useMuons )     { ANA_CHECK( m_store->record( selectedMuons,     m_outContainerName_Muons + systName )); }
-          ANA_CHECK( m_store->record( selectedJets,      m_outContainerName_Jets + systName ));
-          if ( m_usePhotons )  { ANA_CHECK( m_store->record( selectedPhotons,   m_outContainerName_Photons + systName )); }
-          ANA_CHECK( m_store->record( selectedTaus, m_outContainerName_Taus + systName ));
+          if( m_useElectrons ) { ANA_CHECK( m_store->record( selectedElectrons, m_outContainerKeys_Electrons.key(systID) )); }
+          if( m_useMuons )     { ANA_CHECK( m_store->record( selectedMuons,     m_outContainerKeys_Muons.key(systID) )); }
+          ANA_CHECK( m_store->record( selectedJets,      m_outContainerKeys_Jets.key(systID) ));
+          if ( m_usePhotons )  { ANA_CHECK( m_store->record( selectedPhotons,   m_outContainerKeys_Photons.key(systID) )); }
+          ANA_CHECK( m_store->record( selectedTaus, m_outContainerKeys_Taus.key(systID) ));
         }
 
         m_vecOutContainerNames->push_back(systName);
@@ -1106,6 +1146,215 @@ EL::StatusCode OverlapRemover :: executeOR(  const xAOD::ElectronContainer* inEl
 
 }
 
+EL::StatusCode OverlapRemover :: removeOverlaps( const xAOD::ElectronContainer* inElectrons, const xAOD::MuonContainer* inMuons, const xAOD::JetContainer* inJets,
+                                                const xAOD::TauJetContainer* inTaus, const xAOD::PhotonContainer* inPhotons, SystType syst_type )
+{
+  if ( !m_useSpatialIndex ) {
+    ANA_CHECK( m_ORToolbox.masterTool->removeOverlaps(inElectrons, inMuons, inJets, inTaus, inPhotons));
+    return EL::StatusCode::SUCCESS;
+  }
+
+  // index all objects the tool would consider. The order matters: selectORCandidates() walks the containers in the same order
+  m_ORGrid.clear();
+  m_ORGridObjects.clear();
+  if ( inElectrons ) fillORGrid(inElectrons);
+  if ( inMuons )     fillORGrid(inMuons);
+  if ( inJets )      fillORGrid(inJets);
+  if ( inTaus )      fillORGrid(inTaus);
+  if ( inPhotons )   fillORGrid(inPhotons);
+
+  // objects with a possible overlap partner go to the tool, and are grouped with it:
+  // the decisions within a group do not depend on anything outside of it
+  const std::size_t nObjects = m_ORGridObjects.size();
+  m_ORAction.assign( nObjects, OR_PASS );
+  m_ORGroup.resize( nObjects );
+  for ( std::size_t i = 0; i < nObjects; ++i ) m_ORGroup[i] = i;
+
+  for ( std::size_t i = 0; i < nObjects; ++i ) {
+    const xAOD::IParticle* obj = m_ORGridObjects[i];
+    const int type = static_cast<int>( obj->type() );
+    m_ORGrid.forEachNeighbour( obj->rapidity(), obj->phi(), m_spatialIndexMaxDeltaR, [&](const xAH::EtaPhiGrid::Entry& entry) {
+      if ( entry.index <= i || !canOverlap(type, entry.category) ) return;
+      m_ORAction[i]           = OR_RUN;
+      m_ORAction[entry.index] = OR_RUN;
+      const std::size_t group = findORGroup(i);
+      m_ORGroup[ findORGroup(entry.index) ] = group;
+    });
+  }
+
+  // for a systematic, only groups containing an object that differs from nominal have to be redone
+  const bool reuseNominal = m_reuseNominalOR && syst_type != NOMINAL && m_ORNominalResultsValid;
+  if ( reuseNominal ) {
+    ++m_ORRunCount;
+    m_ORGroupChanged.assign( nObjects, 0 );
+    m_ORSystObjects.clear();
+    std::size_t nMatched(0);
+
+    // the objects that were close to where a changed or missing object used to be need to be redone as well
+    auto markNominalNeighbours = [&](const NominalORResult& nominal) {
+      m_ORGrid.forEachNeighbour( nominal.rapidity, nominal.phi, m_spatialIndexMaxDeltaR, [&](const xAH::EtaPhiGrid::Entry& entry) {
+        if ( canOverlap(nominal.type, entry.category) ) m_ORGroupChanged[ findORGroup(entry.index) ] = 1;
+      });
+    };
+
+    for ( std::size_t i = 0; i < nObjects; ++i ) {
+      const xAOD::IParticle* obj = m_ORGridObjects[i];
+      const xAOD::IParticle* original = xAOD::getOriginalObject( *obj );
+      if ( m_linkOverlapObjects ) m_ORSystObjects[ original ? original : obj ] = obj;
+      auto nominal = m_ORNominalResults.find( original ? original : obj );
+      if ( nominal == m_ORNominalResults.end() ) {
+        m_ORGroupChanged[ findORGroup(i) ] = 1;
+        continue;
+      }
+      nominal->second.matched = m_ORRunCount;
+      ++nMatched;
+      if ( nominal->second.pt != obj->pt() || nominal->second.rapidity != obj->rapidity() || nominal->second.phi != obj->phi() || nominal->second.bTagged != isORBTagged(obj) ) {
+        m_ORGroupChanged[ findORGroup(i) ] = 1;
+        markNominalNeighbours( nominal->second );
+      }
+    }
+
+    if ( nMatched < m_ORNominalResults.size() ) {
+      for ( const auto& nominal : m_ORNominalResults ) {
+        if ( nominal.second.matched != m_ORRunCount ) markNominalNeighbours( nominal.second );
+      }
+    }
+
+    for ( std::size_t i = 0; i < nObjects; ++i ) {
+      if ( m_ORAction[i] == OR_RUN && !m_ORGroupChanged[ findORGroup(i) ] ) m_ORAction[i] = OR_REUSE;
+    }
+  }
+
+  std::size_t gridIndex(0);
+  selectORCandidates(inElectrons, m_ORElectrons, gridIndex);
+  selectORCandidates(inMuons,     m_ORMuons,     gridIndex);
+  selectORCandidates(inJets,      m_ORJets,      gridIndex);
+  selectORCandidates(inTaus,      m_ORTaus,      gridIndex);
+  selectORCandidates(inPhotons,   m_ORPhotons,   gridIndex);
+
+  ANA_MSG_DEBUG( "Passing " << m_ORElectrons.size() + m_ORMuons.size() + m_ORJets.size() + m_ORTaus.size() + m_ORPhotons.size() << " objects to the OLR tool, " << nObjects << " objects considered" );
+
+  ANA_CHECK( m_ORToolbox.masterTool->removeOverlaps( inElectrons ? m_ORElectrons.asDataVector() : nullptr,
+                                                     inMuons     ? m_ORMuons.asDataVector()     : nullptr,
+                                                     inJets      ? m_ORJets.asDataVector()      : nullptr,
+                                                     inTaus      ? m_ORTaus.asDataVector()      : nullptr,
+                                                     inPhotons   ? m_ORPhotons.asDataVector()   : nullptr ));
+
+  // keep the nominal decisions for the systematics of this event
+  if ( m_reuseNominalOR && syst_type == NOMINAL ) {
+    static SG::AuxElement::ConstAccessor< char > passORAcc("passOR");
+    static SG::AuxElement::ConstAccessor< ElementLink<xAOD::IParticleContainer> > overlapObjectAcc("overlapObject");
+
+    m_ORNominalResults.clear();
+    for ( auto obj : m_ORGridObjects ) {
+      const xAOD::IParticle* original = xAOD::getOriginalObject( *obj );
+      NominalORResult& nominal = m_ORNominalResults[ original ? original : obj ];
+      nominal.rapidity = obj->rapidity();
+      nominal.phi      = obj->phi();
+      nominal.pt       = obj->pt();
+      nominal.type     = static_cast<int>( obj->type() );
+      nominal.bTagged  = isORBTagged( obj );
+      nominal.passOR   = passORAcc( *obj );
+      nominal.overlapPartner = nullptr;
+      if ( m_linkOverlapObjects && overlapObjectAcc.isAvailable( *obj ) && overlapObjectAcc( *obj ).isValid() ) {
+        const xAOD::IParticle* partner = *overlapObjectAcc( *obj );
+        const xAOD::IParticle* partnerOriginal = xAOD::getOriginalObject( *partner );
+        nominal.overlapPartner = partnerOriginal ? partnerOriginal : partner;
+      }
+      nominal.matched  = 0;
+    }
+    m_ORNominalResultsValid = true;
+  }
+
+  return EL::StatusCode::SUCCESS;
+}
+
+bool OverlapRemover :: isORInput( const xAOD::IParticle* obj ) const
+{
+  static SG::AuxElement::ConstAccessor< char > selectAcc("passSel");
+  return !m_useSelected || selectAcc( *obj );
+}
+
+bool OverlapRemover :: canOverlap( int type1, int type2 ) const
+{
+  // objects of different types can overlap, and electrons with each other if requested
+  return type1 != type2 || ( m_doEleEleOR && type1 == static_cast<int>(xAOD::Type::Electron) );
+}
+
+void OverlapRemover :: fillORGrid( const xAOD::IParticleContainer* inCont )
+{
+  for ( auto obj : *inCont ) {
+    if ( !isORInput(obj) ) continue;
+    m_ORGrid.insert( obj->rapidity(), obj->phi(), static_cast<int>( obj->type() ), m_ORGridObjects.size() );
+    m_ORGridObjects.push_back( obj );
+  }
+}
+
+std::size_t OverlapRemover :: findORGroup( std::size_t index )
+{
+  while ( m_ORGroup[index] != index ) {
+    m_ORGroup[index] = m_ORGroup[ m_ORGroup[index] ];
+    index = m_ORGroup[index];
+  }
+  return index;
+}
+
+char OverlapRemover :: isORBTagged( const xAOD::IParticle* obj ) const
+{
+  if ( m_bTagWP.empty() || obj->type() != xAOD::Type::Jet ) return 0;
+  SG::AuxElement::ConstAccessor< char > isBTag( m_bTagWP );
+  return isBTag.isAvailable( *obj ) ? isBTag( *obj ) : 0;
+}
+
+ElementLink<xAOD::IParticleContainer> OverlapRemover :: systOverlapLink( const xAOD::IParticle* nominalPartner ) const
+{
+  ElementLink<xAOD::IParticleContainer> link;
+  if ( !nominalPartner ) return link;
+  // the partner is in the same unchanged group, so it is part of this run as well
+  auto found = m_ORSystObjects.find( nominalPartner );
+  if ( found == m_ORSystObjects.end() ) return link;
+  const xAOD::IParticle* partner = found->second;
+  link.toIndexedElement( *static_cast<const xAOD::IParticleContainer*>( partner->container() ), partner->index() );
+  return link;
+}
+
+template<typename CONT_T>
+void OverlapRemover :: selectORCandidates( const CONT_T* inCont, ConstDataVector<CONT_T>& view, std::size_t& gridIndex )
+{
+  static SG::AuxElement::Decorator< char > passORDecor("passOR");
+  static SG::AuxElement::Decorator< ElementLink<xAOD::IParticleContainer> > overlapObjectDecor("overlapObject");
+
+  view.clear( SG::VIEW_ELEMENTS );
+  if ( !inCont ) return;
+
+  for ( auto obj : *inCont ) {
+    // objects the tool does not consider go through it as before, so they get the same decorations as without the index
+    if ( !isORInput(obj) ) {
+      view.push_back( obj );
+      continue;
+    }
+
+    switch ( m_ORAction[gridIndex++] ) {
+      case OR_RUN:
+        view.push_back( obj );
+        break;
+      case OR_REUSE:
+      {
+        const xAOD::IParticle* original = xAOD::getOriginalObject( *obj );
+        const NominalORResult& nominal = m_ORNominalResults.at( original ? original : obj );
+        passORDecor( *obj ) = nominal.passOR;
+        if ( m_linkOverlapObjects ) overlapObjectDecor( *obj ) = systOverlapLink( nominal.overlapPartner );
+        break;
+      }
+      default:
+        // the objects are shared between systematics, so clear what an earlier run may have left
+        passORDecor( *obj ) = true;
+        if ( m_linkOverlapObjects ) overlapObjectDecor( *obj ) = ElementLink<xAOD::IParticleContainer>();
+        break;
+    }
+  }
+}
+
 EL::StatusCode OverlapRemover :: setCutFlowHist( )
 {
 
@@ -1127,6 +1376,12 @@ EL::StatusCode OverlapRemover :: setCutFlowHist( )
     m_ph_cutflow_OR_cut   = m_ph_cutflowHist_1->GetXaxis()->FindBin("OR_cut");
     m_tau_cutflowHist_1   = (TH1D*)file->Get("cutflow_taus_1");
     m_tau_cutflow_OR_cut  = m_tau_cutflowHist_1->GetXaxis()->FindBin("OR_cut");
+
+    m_el_cutflowCounter_1.setHistogram( m_el_cutflowHist_1 );
+    m_mu_cutflowCounter_1.setHistogram( m_mu_cutflowHist_1 );
+    m_jet_cutflowCounter_1.setHistogram( m_jet_cutflowHist_1 );
+    m_ph_cutflowCounter_1.setHistogram( m_ph_cutflowHist_1 );
+    m_tau_cutflowCounter_1.setHistogram( m_tau_cutflowHist_1 );
   }
 
   return EL::StatusCode::SUCCESS;
@@ -313,6 +313,7 @@ EL::StatusCode PhotonCalibrator :: initialize ()
 
 EL::StatusCode PhotonCalibrator :: execute ()
 {
+  xAH::ExecuteProfiler profiler(this);
   // Here you do everything that needs to be done on every single
   // events, e.g. read input variables, apply cuts, and fill
   // histograms and trees.  This is where most of your actual analysis
@@ -65,6 +65,21 @@ PhotonContainer::PhotonContainer(const std::string& name, const std::string& det
   if(m_infoSwitch.m_trigger){
     m_trigMatched=new std::vector<std::vector<std::string> >();
   }
+
+  //
+  // aux variables copied as they are, for every photon in FillParticle
+  //
+  if ( m_infoSwitch.m_isolation ) {
+    m_auxColumns.add<char, int>("isIsolated_FixedCutTightCaloOnly", m_isIsolated_Cone40CaloOnly, -1);
+    m_auxColumns.add<char, int>("isIsolated_FixedCutTight", m_isIsolated_Cone40, -1);
+    m_auxColumns.add<char, int>("isIsolated_FixedCutLoose", m_isIsolated_Cone20, -1);
+  }
+
+  if ( m_infoSwitch.m_PID ) {
+    m_auxColumns.add<bool, int>("PhotonID_Loose", m_IsLoose, -1);
+    m_auxColumns.add<bool, int>("PhotonID_Medium", m_IsMedium, -1);
+    m_auxColumns.add<bool, int>("PhotonID_Tight", m_IsTight, -1);
+  }
 }
 
 PhotonContainer::~PhotonContainer()
@@ -375,7 +390,7 @@ void PhotonContainer::clear()
 
   // trigger
   if(m_infoSwitch.m_trigger){
-    m_trigMatched->clear();
+    clearColumn( m_trigMatched );
   }
 
 }
@@ -394,16 +409,6 @@ void PhotonContainer::FillPhoton( const xAOD::IParticle* particle )
 
 
   if ( m_infoSwitch.m_isolation ) {
-
-    static SG::AuxElement::Accessor<char> isIsoCone40CaloOnlyAcc    ("isIsolated_FixedCutTightCaloOnly");
-    safeFill<char, int, xAOD::Photon>(photon, isIsoCone40CaloOnlyAcc, m_isIsolated_Cone40CaloOnly, -1);
-
-    static SG::AuxElement::Accessor<char> isIsoCone40Acc            ("isIsolated_FixedCutTight");
-    safeFill<char, int, xAOD::Photon>(photon, isIsoCone40Acc, m_isIsolated_Cone40, -1);
-
-    static SG::AuxElement::Accessor<char> isIsoCone20Acc            ("isIsolated_FixedCutLoose");
-    safeFill<char, int, xAOD::Photon>(photon, isIsoCone20Acc, m_isIsolated_Cone20, -1);
-
     m_ptcone20     -> push_back( photon->isolation( xAOD::Iso::ptcone20    ) / m_units  );
     m_ptcone30     -> push_back( photon->isolation( xAOD::Iso::ptcone30    ) / m_units  );
     m_ptcone40     -> push_back( photon->isolation( xAOD::Iso::ptcone40    ) / m_units  );
@@ -416,19 +421,6 @@ void PhotonContainer::FillPhoton( const xAOD::IParticle* particle )
 
   }
 
-  if ( m_infoSwitch.m_PID ) {
-
-    static SG::AuxElement::Accessor<bool> phLooseAcc  ("PhotonID_Loose");
-    safeFill<bool, int, xAOD::Photon>(photon, phLooseAcc, m_IsLoose, -1);
-
-    static SG::AuxElement::Accessor<bool> phMediumAcc ("PhotonID_Medium");
-    safeFill<bool, int, xAOD::Photon>(photon, phMediumAcc, m_IsMedium, -1);
-
-    static SG::AuxElement::Accessor<bool> phTightAcc  ("PhotonID_Tight");
-    safeFill<bool, int, xAOD::Photon>(photon, phTightAcc, m_IsTight, -1);
-
-  }
-
   if (m_infoSwitch.m_purity) {
     static SG::AuxElement::Accessor<float> radhad1  ("Rhad1"  );
     static SG::AuxElement::Accessor<float> radhad   ("Rhad"   );
@@ -476,7 +468,7 @@ void PhotonContainer::FillPhoton( const xAOD::IParticle* particle )
   if (m_infoSwitch.m_trigger) {
     static SG::AuxElement::Accessor< std::vector< std::string> > trigMatched("trigMatched");
 
-    m_trigMatched ->push_back( trigMatched(*photon) );
+    pushRow( m_trigMatched, trigMatched(*photon) );
   }
 
   return;
@@ -1,9 +1,21 @@
 #include <xAODAnaHelpers/PhotonHists.h>
+#include <xAODPrimitives/tools/getIsolationAccessor.h>
 #include <sstream>
 
 #include "xAODAnaHelpers/HelperFunctions.h"
 ANA_MSG_SOURCE(msgPhotonHists, "PhotonHists")
 
+namespace {
+
+  // the isolation variables filled for m_isolation
+  const xAOD::Iso::IsolationType isolationTypes[] = {
+    xAOD::Iso::ptcone20,    xAOD::Iso::ptcone30,    xAOD::Iso::ptcone40,
+    xAOD::Iso::ptvarcone20, xAOD::Iso::ptvarcone30, xAOD::Iso::ptvarcone40,
+    xAOD::Iso::topoetcone20, xAOD::Iso::topoetcone30, xAOD::Iso::topoetcone40
+  };
+
+}
+
 PhotonHists :: PhotonHists (std::string name, std::string detailStr) :
   IParticleHists(name, detailStr, "photon", "photon"),
   m_infoSwitch(new HelperClasses::PhotonInfoSwitch(m_detailStr))
@@ -53,17 +65,26 @@ StatusCode PhotonHists::execute( const xAOD::IParticle* particle, float eventWei
 
   // isolation
   if ( m_infoSwitch->m_isolation ) {
-    m_ptcone20    ->Fill( photon->isolation( xAOD::Iso::ptcone20    ) / 1e3, eventWeight );
-    m_ptcone30    ->Fill( photon->isolation( xAOD::Iso::ptcone30    ) / 1e3, eventWeight );
-    m_ptcone40    ->Fill( photon->isolation( xAOD::Iso::ptcone40    ) / 1e3, eventWeight );
-    m_ptvarcone20 ->Fill( photon->isolation( xAOD::Iso::ptvarcone20 ) / 1e3, eventWeight );
-    m_ptvarcone30 ->Fill( photon->isolation( xAOD::Iso::ptvarcone30 ) / 1e3, eventWeight );
-    m_ptvarcone40 ->Fill( photon->isolation( xAOD::Iso::ptvarcone40 ) / 1e3, eventWeight );
-    m_topoetcone20->Fill( photon->isolation( xAOD::Iso::topoetcone20) / 1e3, eventWeight );
-    m_topoetcone30->Fill( photon->isolation( xAOD::Iso::topoetcone30) / 1e3, eventWeight );
-    m_topoetcone40->Fill( photon->isolation( xAOD::Iso::topoetcone40) / 1e3, eventWeight );
+    fill( m_ptcone20,     photon->isolation( xAOD::Iso::ptcone20    ) / 1e3, eventWeight );
+    fill( m_ptcone30,     photon->isolation( xAOD::Iso::ptcone30    ) / 1e3, eventWeight );
+    fill( m_ptcone40,     photon->isolation( xAOD::Iso::ptcone40    ) / 1e3, eventWeight );
+    fill( m_ptvarcone20,  photon->isolation( xAOD::Iso::ptvarcone20 ) / 1e3, eventWeight );
+    fill( m_ptvarcone30,  photon->isolation( xAOD::Iso::ptvarcone30 ) / 1e3, eventWeight );
+    fill( m_ptvarcone40,  photon->isolation( xAOD::Iso::ptvarcone40 ) / 1e3, eventWeight );
+    fill( m_topoetcone20, photon->isolation( xAOD::Iso::topoetcone20) / 1e3, eventWeight );
+    fill( m_topoetcone30, photon->isolation( xAOD::Iso::topoetcone30) / 1e3, eventWeight );
+    fill( m_topoetcone40, photon->isolation( xAOD::Iso::topoetcone40) / 1e3, eventWeight );
   }
 
   return StatusCode::SUCCESS;
 }
 
+void PhotonHists::auxIDs( std::set< SG::auxid_t >& auxids ) const {
+  IParticleHists::auxIDs( auxids );
+
+  if ( m_infoSwitch->m_isolation ) {
+    for ( xAOD::Iso::IsolationType type : isolationTypes ) {
+      auxids.insert( xAOD::getIsolationAccessor( type )->auxid() );
+    }
+  }
+}
@@ -106,6 +106,8 @@ EL::StatusCode PhotonSelector :: initialize ()
 
   ANA_MSG_INFO( "Initializing PhotonSelector Interface... ");
 
+  m_kinematicPreFilter.setCuts( m_pT_min, m_pT_max, m_eta_max );
+
   // Let's see if the algorithm has been already used before:
   // if yes, will write object cutflow in a different histogram!
   //
@@ -140,6 +142,8 @@ EL::StatusCode PhotonSelector :: initialize ()
     m_ph_cutflow_eta_cut         = m_ph_cutflowHist_1->GetXaxis()->FindBin("eta_cut"); // including crack veto, if applied
     m_ph_cutflow_iso_cut         = m_ph_cutflowHist_1->GetXaxis()->FindBin("iso_cut");
 
+    m_ph_cutflowCounter_1.setHistogram( m_ph_cutflowHist_1 );
+
 
   }
 
@@ -164,6 +168,9 @@ EL::StatusCode PhotonSelector :: initialize ()
     return EL::StatusCode::FAILURE;
   }
 
+  m_inContainerKeys.setPrefix( m_inContainerName );
+  m_outContainerKeys.setPrefix( m_outContainerName );
+
 
   m_numEvent      = 0;
   m_numObject     = 0;
@@ -201,6 +208,7 @@ EL::StatusCode PhotonSelector :: initialize ()
 
 EL::StatusCode PhotonSelector :: execute ()
 {
+  xAH::ExecuteProfiler profiler(this);
   // Here you do everything that needs to be done on every single
   // events, e.g. read input variables, apply cuts, and fill
   // histograms and trees.  This is where most of your actual analysis
@@ -271,11 +279,14 @@ EL::StatusCode PhotonSelector :: execute ()
     // loop over systematic sets
     //
     bool eventPassThisSyst(false);
-    for ( auto systName : *systNames) {
+    xAH::SystematicRegistry& systRegistry = xAH::SystematicRegistry::instance();
+    for ( const auto& systName : *systNames ) {
+
+      unsigned int systID = systRegistry.id( systName );
 
-      ANA_MSG_DEBUG( " syst name: " << systName << "  input container name: " << m_inContainerName+systName );
+      ANA_MSG_DEBUG( " syst name: " << systName << "  input container name: " << m_inContainerKeys.key(systID) );
 
-      ANA_CHECK( HelperFunctions::retrieve(inPhotons, m_inContainerName + systName, m_event, m_store, msg()));
+      ANA_CHECK( HelperFunctions::retrieve(inPhotons, m_inContainerKeys.key(systID), m_event, m_store, msg()));
 
       // create output container (if requested) - one for each systematic
       //
@@ -298,13 +309,13 @@ EL::StatusCode PhotonSelector :: execute ()
       //
       eventPass = ( eventPass || eventPassThisSyst );
 
-      ANA_MSG_DEBUG( " syst name: " << systName << "  output container name: " << m_outContainerName+systName );
+      ANA_MSG_DEBUG( " syst name: " << systName << "  output container name: " << m_outContainerKeys.key(systID) );
 
       if ( m_createSelectedContainer ) {
         if ( eventPassThisSyst ) {
           // add ConstDataVector to TStore
 	  //
-          ANA_CHECK( m_store->record( selectedPhotons, m_outContainerName+systName ));
+          ANA_CHECK( m_store->record( selectedPhotons, m_outContainerKeys.key(systID) ));
         } else {
           // if the event does not pass the selection for this syst, CDV won't be ever recorded to TStore, so we have to delete it!
 	  //
@@ -339,6 +350,12 @@ bool PhotonSelector :: executeSelection ( const xAOD::PhotonContainer* inPhotons
   int nPass(0); int nObj(0);
   static SG::AuxElement::Decorator< char > passSelDecor( "passSel" );
 
+  // cheap kinematic cuts for all photons at once, passCuts only has to look at the survivors
+  const bool usePreFilter = m_doKinematicPreFilter && m_kinematicPreFilter.active();
+  if ( usePreFilter ) {
+    m_kinematicPreFilter.apply( *inPhotons, [](const xAOD::Photon* photon) { return ( photon->caloCluster() ) ? photon->caloCluster()->etaBE(2) : -999.0; } );
+  }
+
   for ( auto ph_itr : *inPhotons ) { // duplicated of basic loop
 
     // if only looking at a subset of photons make sure all are decorated
@@ -354,7 +371,12 @@ bool PhotonSelector :: executeSelection ( const xAOD::PhotonContainer* inPhotons
 
     nObj++;
 
-    bool passSel = this->passCuts( ph_itr );
+    bool passSel(false);
+    if ( usePreFilter && !m_kinematicPreFilter.passed( nObj-1 ) ) {
+      if(m_useCutFlow) m_ph_cutflowCounter_1.fill( m_ph_cutflow_all );
+    } else {
+      passSel = this->passCuts( ph_itr );
+    }
     if ( m_decorateSelectedObjects ) {
       passSelDecor( *ph_itr ) = passSel;
     }
@@ -417,7 +439,7 @@ bool PhotonSelector :: passCuts( const xAOD::Photon* photon )
     ANA_MSG_ERROR("Please call PhotonCalibrator before calling PhotonSelector, or check the quality requirement (should be either of Tight/Medium/Loose) [" << m_name << " " << photonIDKeyName << "]");
   }
 
-  if(m_useCutFlow) m_ph_cutflowHist_1->Fill( m_ph_cutflow_all, 1 );
+  if(m_useCutFlow) m_ph_cutflowCounter_1.fill( m_ph_cutflow_all );
 
   // *********************************************************************************************************************************************************************
   //
@@ -429,7 +451,7 @@ bool PhotonSelector :: passCuts( const xAOD::Photon* photon )
       return false;
     }
   }
-  if(m_useCutFlow) m_ph_cutflowHist_1->Fill( m_ph_cutflow_author_cut, 1 );
+  if(m_useCutFlow) m_ph_cutflowCounter_1.fill( m_ph_cutflow_author_cut );
 
   // *********************************************************************************************************************************************************************
   //
@@ -446,7 +468,7 @@ bool PhotonSelector :: passCuts( const xAOD::Photon* photon )
       return 0;
     }
   }
-  if(m_useCutFlow) m_ph_cutflowHist_1->Fill( m_ph_cutflow_OQ_cut, 1 );
+  if(m_useCutFlow) m_ph_cutflowCounter_1.fill( m_ph_cutflow_OQ_cut );
 
   // *********************************************************************************************************************************************************************
   //
@@ -459,7 +481,7 @@ bool PhotonSelector :: passCuts( const xAOD::Photon* photon )
       return false;
     }
   }
-  if(m_useCutFlow) m_ph_cutflowHist_1->Fill( m_ph_cutflow_PID_cut, 1 );
+  if(m_useCutFlow) m_ph_cutflowCounter_1.fill( m_ph_cutflow_PID_cut );
 
   // *********************************************************************************************************************************************************************
   //
@@ -471,7 +493,7 @@ bool PhotonSelector :: passCuts( const xAOD::Photon* photon )
       return false;
     }
   }
-  if(m_useCutFlow) m_ph_cutflowHist_1->Fill( m_ph_cutflow_ptmax_cut, 1 );
+  if(m_useCutFlow) m_ph_cutflowCounter_1.fill( m_ph_cutflow_ptmax_cut );
 
   // *********************************************************************************************************************************************************************
   //
@@ -483,7 +505,7 @@ bool PhotonSelector :: passCuts( const xAOD::Photon* photon )
       return false;
     }
   }
-  if(m_useCutFlow) m_ph_cutflowHist_1->Fill( m_ph_cutflow_ptmin_cut, 1 );
+  if(m_useCutFlow) m_ph_cutflowCounter_1.fill( m_ph_cutflow_ptmin_cut );
 
   // *********************************************************************************************************************************************************************
   //
@@ -506,7 +528,7 @@ bool PhotonSelector :: passCuts( const xAOD::Photon* photon )
       return false;
     }
   }
-  if(m_useCutFlow) m_ph_cutflowHist_1->Fill( m_ph_cutflow_eta_cut, 1 );
+  if(m_useCutFlow) m_ph_cutflowCounter_1.fill( m_ph_cutflow_eta_cut );
 
   // *********************************************************************************************************************************************************************
   //
@@ -536,7 +558,7 @@ bool PhotonSelector :: passCuts( const xAOD::Photon* photon )
     ANA_MSG_DEBUG( "Photon failed isolation cut " << m_MinIsoWPCut );
     return false;
   }
-  if(m_useCutFlow) m_ph_cutflowHist_1->Fill( m_ph_cutflow_iso_cut, 1 );
+  if(m_useCutFlow) m_ph_cutflowCounter_1.fill( m_ph_cutflow_iso_cut );
 
   return true;
 }
@@ -573,6 +595,7 @@ EL::StatusCode PhotonSelector :: finalize ()
     ANA_MSG_INFO( "Filling cutflow");
     m_cutflowHist ->SetBinContent( m_cutflow_bin, m_numEventPass        );
     m_cutflowHistW->SetBinContent( m_cutflow_bin, m_weightNumEventPass  );
+    m_ph_cutflowCounter_1.flush();
   }
 
   ANA_MSG_DEBUG("Cutflow filled");
@@ -0,0 +1,26 @@
+#include <xAODAnaHelpers/SystematicRegistry.h>
+
+using namespace xAH;
+
+SystematicRegistry& SystematicRegistry::instance()
+{
+  static SystematicRegistry registry;
+  return registry;
+}
+
+SystematicRegistry::SystematicRegistry()
+{
+  // nominal is always the first one
+  id( "" );
+}
+
+unsigned int SystematicRegistry::id( const std::string& systName )
+{
+  auto it = m_ids.find( systName );
+  if ( it != m_ids.end() ) return it->second;
+
+  unsigned int newID = m_names.size();
+  m_ids.emplace( systName, newID );
+  m_names.push_back( systName );
+  return newID;
+}
@@ -0,0 +1,72 @@
+#include <xAODAnaHelpers/TaskPool.h>
+
+using namespace xAH;
+
+TaskPool::TaskPool(unsigned int nThreads)
+{
+  for(unsigned int i = 1; i < nThreads; ++i)
+    m_workers.emplace_back(&TaskPool::workerLoop, this);
+}
+
+TaskPool::~TaskPool()
+{
+  {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_stop = true;
+  }
+  m_wake.notify_all();
+  for(auto& worker : m_workers) worker.join();
+}
+
+void TaskPool::run(std::size_t nTasks, const std::function<void(std::size_t)>& task)
+{
+  // nothing to share, skip the hand-off
+  if(m_workers.empty() || nTasks < 2){
+    for(std::size_t i = 0; i < nTasks; ++i) task(i);
+    return;
+  }
+
+  {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_task    = &task;
+    m_nTasks  = nTasks;
+    m_next    = 0;
+    m_pending = m_workers.size();
+    ++m_generation;
+  }
+  m_wake.notify_all();
+
+  drain(task, nTasks);
+
+  // every worker has to check in, so none of them is still holding on to this batch when the next one starts
+  std::unique_lock<std::mutex> lock(m_mutex);
+  m_done.wait(lock, [this]{ return m_pending == 0; });
+  m_task = nullptr;
+}
+
+void TaskPool::drain(const std::function<void(std::size_t)>& task, std::size_t nTasks)
+{
+  for(std::size_t i = m_next++; i < nTasks; i = m_next++) task(i);
+}
+
+void TaskPool::workerLoop()
+{
+  unsigned long seen = 0;
+  while(true){
+    const std::function<void(std::size_t)>* task(nullptr);
+    std::size_t nTasks(0);
+    {
+      std::unique_lock<std::mutex> lock(m_mutex);
+      m_wake.wait(lock, [this, seen]{ return m_stop || m_generation != seen; });
+      if(m_stop) return;
+      seen   = m_generation;
+      task   = m_task;
+      nTasks = m_nTasks;
+    }
+
+    drain(*task, nTasks);
+
+    std::lock_guard<std::mutex> lock(m_mutex);
+    if(--m_pending == 0) m_done.notify_one();
+  }
+}
@@ -154,6 +154,9 @@ EL::StatusCode TauSelector :: initialize ()
       m_tau_cutflow_selected             = m_tau_cutflowHist_2->GetXaxis()->FindBin("selected");
     }
 
+    m_tau_cutflowCounter_1.setHistogram( m_tau_cutflowHist_1 );
+    if ( m_isUsedBefore ) m_tau_cutflowCounter_2.setHistogram( m_tau_cutflowHist_2 );
+
   }
 
   m_event = wk()->xaodEvent();
@@ -169,6 +172,9 @@ EL::StatusCode TauSelector :: initialize ()
     return EL::StatusCode::FAILURE;
   }
 
+  m_inContainerKeys.setPrefix( m_inContainerName );
+  m_outContainerKeys.setPrefix( m_outContainerName );
+
   m_numEvent      = 0;
   m_numObject     = 0;
   m_numEventPass  = 0;
@@ -205,6 +211,7 @@ EL::StatusCode TauSelector :: initialize ()
 
 EL::StatusCode TauSelector :: execute ()
 {
+  xAH::ExecuteProfiler profiler(this);
   // Here you do everything that needs to be done on every single
   // events, e.g. read input variables, apply cuts, and fill
   // histograms and trees.  This is where most of your actual analysis
@@ -279,11 +286,14 @@ EL::StatusCode TauSelector :: execute ()
     // loop over systematic sets
     //
     bool eventPassThisSyst(false);
-    for ( auto systName : *systNames ) {
+    xAH::SystematicRegistry& systRegistry = xAH::SystematicRegistry::instance();
+    for ( const auto& systName : *systNames ) {
+
+      unsigned int systID = systRegistry.id( systName );
 
-      ANA_MSG_DEBUG( " syst name: " << systName << "  input container name: " << m_inContainerName+systName );
+      ANA_MSG_DEBUG( " syst name: " << systName << "  input container name: " << m_inContainerKeys.key(systID) );
 
-      ANA_CHECK( HelperFunctions::retrieve(inTaus, m_inContainerName + systName, m_event, m_store, msg()) );
+      ANA_CHECK( HelperFunctions::retrieve(inTaus, m_inContainerKeys.key(systID), m_event, m_store, msg()) );
 
       // create output container (if requested) - one for each systematic
       //
@@ -306,13 +316,13 @@ EL::StatusCode TauSelector :: execute ()
       //
       eventPass = ( eventPass || eventPassThisSyst );
 
-      ANA_MSG_DEBUG( " syst name: " << systName << "  output container name: " << m_outContainerName+systName );
+      ANA_MSG_DEBUG( " syst name: " << systName << "  output container name: " << m_outContainerKeys.key(systID) );
 
       if ( m_createSelectedContainer ) {
         if ( eventPassThisSyst ) {
           // add ConstDataVector to TStore
 	  //
-          ANA_CHECK( m_store->record( selectedTaus, m_outContainerName+systName ));
+          ANA_CHECK( m_store->record( selectedTaus, m_outContainerKeys.key(systID) ));
         } else {
           // if the event does not pass the selection for this syst, CDV won't be ever recorded to TStore, so we have to delete it!
           delete selectedTaus; selectedTaus = nullptr;
@@ -443,6 +453,8 @@ EL::StatusCode TauSelector :: finalize ()
     ANA_MSG_INFO( "Filling cutflow");
     m_cutflowHist ->SetBinContent( m_cutflow_bin, m_numEventPass        );
     m_cutflowHistW->SetBinContent( m_cutflow_bin, m_weightNumEventPass  );
+    m_tau_cutflowCounter_1.flush();
+    m_tau_cutflowCounter_2.flush();
   }
 
   return EL::StatusCode::SUCCESS;
@@ -471,8 +483,8 @@ EL::StatusCode TauSelector :: histFinalize ()
 int TauSelector :: passCuts( const xAOD::TauJet* tau ) {
 
   // fill cutflow bin 'all' before any cut
-  if(m_useCutFlow) m_tau_cutflowHist_1->Fill( m_tau_cutflow_all, 1 );
-  if ( m_isUsedBefore && m_useCutFlow ) { m_tau_cutflowHist_2->Fill( m_tau_cutflow_all, 1 ); }
+  if(m_useCutFlow) m_tau_cutflowCounter_1.fill( m_tau_cutflow_all );
+  if ( m_isUsedBefore && m_useCutFlow ) { m_tau_cutflowCounter_2.fill( m_tau_cutflow_all ); }
 
   // **********************************************************************************************************
   //
@@ -491,8 +503,8 @@ int TauSelector :: passCuts( const xAOD::TauJet* tau ) {
     return 0;
   }
 
-  if(m_useCutFlow) m_tau_cutflowHist_1->Fill( m_tau_cutflow_selected, 1 );
-  if ( m_isUsedBefore && m_useCutFlow ) { m_tau_cutflowHist_2->Fill( m_tau_cutflow_selected, 1 ); }
+  if(m_useCutFlow) m_tau_cutflowCounter_1.fill( m_tau_cutflow_selected );
+  if ( m_isUsedBefore && m_useCutFlow ) { m_tau_cutflowCounter_2.fill( m_tau_cutflow_selected ); }
 
   return 1;
 }
@@ -250,7 +250,7 @@ void TrackContainer::clear()
   if(m_infoSwitch.m_fitpars){
     m_chiSquared->clear();
     m_d0->clear();
-    m_definingParametersCovMatrix->clear();
+    clearColumn( m_definingParametersCovMatrix );
     m_expectInnermostPixelLayerHit->clear();
     m_expectNextToInnermostPixelLayerHit->clear();
     m_numberDoF->clear();
@@ -203,8 +203,8 @@ StatusCode TrackHists::execute( const xAOD::TrackParticleContainer* trks, const
     ANA_CHECK( this->execute( (*trk_itr), pvx, eventWeight, eventInfo ));
   }
 
-  m_trk_n -> Fill( trks->size(), eventWeight );
-  m_trk_n_l -> Fill( trks->size(), eventWeight );
+  fill( m_trk_n,  trks->size(), eventWeight );
+  fill( m_trk_n_l,  trks->size(), eventWeight );
 
   return StatusCode::SUCCESS;
 }
@@ -226,53 +226,53 @@ StatusCode TrackHists::execute( const xAOD::TrackParticle* trk, const xAOD::Vert
 
   float        sinT        = sin(trk->theta());
 
-  m_trk_Pt       -> Fill( trkPt,            eventWeight );
-  m_trk_Pt_l     -> Fill( trkPt,            eventWeight );
-  m_trk_P        -> Fill( trkP,             eventWeight );
-  m_trk_P_l      -> Fill( trkP,             eventWeight );
-  m_trk_Eta      -> Fill( trkEta,           eventWeight );
-  m_trk_Phi      -> Fill( trkPhi,           eventWeight );
-  m_trk_d0       -> Fill( d0,               eventWeight );
-  m_trk_d0_s     -> Fill( d0,               eventWeight );
-  m_trk_z0       -> Fill( z0,               eventWeight );
-  m_trk_z0_s     -> Fill( z0,               eventWeight );
-  m_trk_z0sinT   -> Fill(z0*sinT,           eventWeight );
-
-  m_trk_chi2Prob -> Fill( chi2Prob ,        eventWeight );
-  m_trk_charge   -> Fill( trk->charge() ,   eventWeight );
+  fill( m_trk_Pt,        trkPt,            eventWeight );
+  fill( m_trk_Pt_l,      trkPt,            eventWeight );
+  fill( m_trk_P,         trkP,             eventWeight );
+  fill( m_trk_P_l,       trkP,             eventWeight );
+  fill( m_trk_Eta,       trkEta,           eventWeight );
+  fill( m_trk_Phi,       trkPhi,           eventWeight );
+  fill( m_trk_d0,        d0,               eventWeight );
+  fill( m_trk_d0_s,      d0,               eventWeight );
+  fill( m_trk_z0,        z0,               eventWeight );
+  fill( m_trk_z0_s,      z0,               eventWeight );
+  fill( m_trk_z0sinT,    z0*sinT,           eventWeight );
+
+  fill( m_trk_chi2Prob,  chi2Prob ,        eventWeight );
+  fill( m_trk_charge,    trk->charge() ,   eventWeight );
 
   if(m_fill2D){
 
-    m_trk_Eta_vs_trk_P       -> Fill( trkP,   trkEta,   eventWeight );
-    m_trk_Eta_vs_trk_P_l     -> Fill( trkP,   trkEta,   eventWeight );
-    m_trk_Phi_vs_trk_P       -> Fill( trkP,   trkPhi,   eventWeight );
-    m_trk_Phi_vs_trk_P_l     -> Fill( trkP,   trkPhi,   eventWeight );
-    m_trk_Eta_vs_trk_Phi     -> Fill( trkPhi, trkEta,   eventWeight );
-    m_trk_d0_vs_trk_P        -> Fill( trkP,   d0,       eventWeight );
-    m_trk_d0_vs_trk_P_l      -> Fill( trkP,   d0,       eventWeight );
-    m_trk_z0_vs_trk_P        -> Fill( trkP,   z0,       eventWeight );
-    m_trk_z0_vs_trk_P_l      -> Fill( trkP,   z0,       eventWeight );
-    m_trk_z0sinT_vs_trk_P    -> Fill( trkP,   z0*sinT,  eventWeight );
-    m_trk_z0sinT_vs_trk_P_l  -> Fill( trkP,   z0*sinT,  eventWeight );
+    fill( m_trk_Eta_vs_trk_P,        trkP,   trkEta,   eventWeight );
+    fill( m_trk_Eta_vs_trk_P_l,      trkP,   trkEta,   eventWeight );
+    fill( m_trk_Phi_vs_trk_P,        trkP,   trkPhi,   eventWeight );
+    fill( m_trk_Phi_vs_trk_P_l,      trkP,   trkPhi,   eventWeight );
+    fill( m_trk_Eta_vs_trk_Phi,      trkPhi, trkEta,   eventWeight );
+    fill( m_trk_d0_vs_trk_P,         trkP,   d0,       eventWeight );
+    fill( m_trk_d0_vs_trk_P_l,       trkP,   d0,       eventWeight );
+    fill( m_trk_z0_vs_trk_P,         trkP,   z0,       eventWeight );
+    fill( m_trk_z0_vs_trk_P_l,       trkP,   z0,       eventWeight );
+    fill( m_trk_z0sinT_vs_trk_P,     trkP,   z0*sinT,  eventWeight );
+    fill( m_trk_z0sinT_vs_trk_P_l,   trkP,   z0*sinT,  eventWeight );
 
   }
 
   if(m_fillIPDetails){
     float d0Err = sqrt((trk->definingParametersCovMatrixVec().at(0)));
     float d0Sig = (d0Err > 0) ? d0/d0Err : -1 ;
-    m_trk_d0_l         -> Fill(d0    , eventWeight );
-    m_trk_d0_ss        -> Fill(d0    , eventWeight );
-    m_trk_d0Err        -> Fill(d0Err , eventWeight );
-    m_trk_d0Sig        -> Fill(d0Sig , eventWeight );
+    fill( m_trk_d0_l,          d0    , eventWeight );
+    fill( m_trk_d0_ss,         d0    , eventWeight );
+    fill( m_trk_d0Err,         d0Err , eventWeight );
+    fill( m_trk_d0Sig,         d0Sig , eventWeight );
 
     float z0Err = sqrt((trk->definingParametersCovMatrixVec().at(2)));
     float z0Sig = (z0Err > 0) ? z0/z0Err : -1 ;
 
-    m_trk_z0_l         -> Fill(z0         , eventWeight );
-    m_trk_z0sinT_l     -> Fill(z0*sinT,     eventWeight );
-    m_trk_z0Err        -> Fill(z0Err      , eventWeight );
-    m_trk_z0Sig        -> Fill(z0Sig      , eventWeight );
-    m_trk_z0SigsinT    -> Fill(z0Sig*sinT , eventWeight );
+    fill( m_trk_z0_l,          z0         , eventWeight );
+    fill( m_trk_z0sinT_l,      z0*sinT,     eventWeight );
+    fill( m_trk_z0Err,         z0Err      , eventWeight );
+    fill( m_trk_z0Sig,         z0Sig      , eventWeight );
+    fill( m_trk_z0SigsinT,     z0Sig*sinT , eventWeight );
 
   }
 
@@ -300,14 +300,14 @@ StatusCode TrackHists::execute( const xAOD::TrackParticle* trk, const xAOD::Vert
 
     uint8_t nSi     = nPix     + nSCT;
     uint8_t nSiDead = nPixDead + nSCTDead;
-    m_trk_nBL        -> Fill( nBL         , eventWeight );
-    m_trk_nSi        -> Fill( nSi         , eventWeight );
-    m_trk_nSiAndDead -> Fill( nSi+nSiDead , eventWeight );
-    m_trk_nSiDead    -> Fill( nSiDead     , eventWeight );
-    m_trk_nSCT       -> Fill( nSCT        , eventWeight );
-    m_trk_nPix       -> Fill( nPix        , eventWeight );
-    m_trk_nPixHoles  -> Fill( nPixHoles   , eventWeight );
-    m_trk_nTRT       -> Fill( nTRT        , eventWeight );
+    fill( m_trk_nBL,         nBL         , eventWeight );
+    fill( m_trk_nSi,         nSi         , eventWeight );
+    fill( m_trk_nSiAndDead,  nSi+nSiDead , eventWeight );
+    fill( m_trk_nSiDead,     nSiDead     , eventWeight );
+    fill( m_trk_nSCT,        nSCT        , eventWeight );
+    fill( m_trk_nPix,        nPix        , eventWeight );
+    fill( m_trk_nPixHoles,   nPixHoles   , eventWeight );
+    fill( m_trk_nTRT,        nTRT        , eventWeight );
     // m_trk_nTRTHoles  -> Fill( nTRTHoles   , eventWeight );
     // m_trk_nTRTDead   -> Fill( nTRTDead    , eventWeight );
 
@@ -321,29 +321,29 @@ StatusCode TrackHists::execute( const xAOD::TrackParticle* trk, const xAOD::Vert
 
   if(m_fillChi2Details){
     float chi2NDoF     = (ndof > 0) ? chi2/ndof : -1;
-    m_trk_chi2Prob_l   -> Fill(chi2Prob   , eventWeight );
-    m_trk_chi2Prob_s   -> Fill(chi2Prob   , eventWeight );
-    m_trk_chi2Prob_ss  -> Fill(chi2Prob   , eventWeight );
-    m_trk_chi2ndof     -> Fill(chi2NDoF   , eventWeight );
-    m_trk_chi2ndof_l   -> Fill(chi2NDoF   , eventWeight );
+    fill( m_trk_chi2Prob_l,    chi2Prob   , eventWeight );
+    fill( m_trk_chi2Prob_s,    chi2Prob   , eventWeight );
+    fill( m_trk_chi2Prob_ss,   chi2Prob   , eventWeight );
+    fill( m_trk_chi2ndof,      chi2NDoF   , eventWeight );
+    fill( m_trk_chi2ndof_l,    chi2NDoF   , eventWeight );
   }
 
   if(m_fillDebugging){
-    m_trk_eta_vl      -> Fill( trkEta,     eventWeight );
-    m_trk_z0_vl       -> Fill( z0,         eventWeight );
-    m_trk_z0_m        -> Fill( z0,         eventWeight );
-    m_trk_z0_raw_m    -> Fill( trk->z0(),  eventWeight );
-    m_trk_z0_atlas_m  -> Fill( trk->z0() + trk->vz(),  eventWeight );
-    m_trk_vz          -> Fill( trk->vz(),  eventWeight );
-    m_trk_d0_vl       -> Fill( d0,         eventWeight );
-    m_trk_pt_ss       -> Fill( trkPt,      eventWeight );
-    m_trk_phiManyBins -> Fill( trkPhi,     eventWeight );
+    fill( m_trk_eta_vl,       trkEta,     eventWeight );
+    fill( m_trk_z0_vl,        z0,         eventWeight );
+    fill( m_trk_z0_m,         z0,         eventWeight );
+    fill( m_trk_z0_raw_m,     trk->z0(),  eventWeight );
+    fill( m_trk_z0_atlas_m,   trk->z0() + trk->vz(),  eventWeight );
+    fill( m_trk_vz,           trk->vz(),  eventWeight );
+    fill( m_trk_d0_vl,        d0,         eventWeight );
+    fill( m_trk_pt_ss,        trkPt,      eventWeight );
+    fill( m_trk_phiManyBins,  trkPhi,     eventWeight );
   }
 
   if(m_fillVsLumi && eventInfo){
     uint32_t lumiBlock = eventInfo->lumiBlock();
 
-    m_lBlock                ->Fill(lumiBlock, eventWeight);
+    fill( m_lBlock,                 lumiBlock, eventWeight );
     m_trk_z0_vs_lBlock      ->Fill(lumiBlock, z0,                     eventWeight);
     m_trk_z0_raw_vs_lBlock  ->Fill(lumiBlock, trk->z0(),              eventWeight);
     m_trk_z0_atlas_vs_lBlock->Fill(lumiBlock, trk->z0() + trk->vz(),  eventWeight);
@@ -352,9 +352,9 @@ StatusCode TrackHists::execute( const xAOD::TrackParticle* trk, const xAOD::Vert
 
     m_pv_valid_vs_lBlock    ->Fill(lumiBlock, bool(pvx),              eventWeight);
 
-    m_bsX    ->Fill(eventInfo->beamPosX(),              eventWeight);
-    m_bsY    ->Fill(eventInfo->beamPosY(),              eventWeight);
-    m_bsZ    ->Fill(eventInfo->beamPosZ(),              eventWeight);
+    fill( m_bsX,     eventInfo->beamPosX(),              eventWeight );
+    fill( m_bsY,     eventInfo->beamPosY(),              eventWeight );
+    fill( m_bsZ,     eventInfo->beamPosZ(),              eventWeight );
 
     m_bsX_vs_lBlock    ->Fill(lumiBlock, eventInfo->beamPosX(),              eventWeight);
     m_bsY_vs_lBlock    ->Fill(lumiBlock, eventInfo->beamPosY(),              eventWeight);
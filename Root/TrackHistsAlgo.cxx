@@ -59,6 +59,7 @@ EL::StatusCode TrackHistsAlgo :: initialize ()
 
 EL::StatusCode TrackHistsAlgo :: execute ()
 {
+  xAH::ExecuteProfiler profiler(this);
   const xAOD::EventInfo* eventInfo(nullptr);
   ANA_CHECK( HelperFunctions::retrieve(eventInfo, m_eventInfoContainerName, m_event, m_store, msg()) );
 
@@ -74,7 +75,7 @@ EL::StatusCode TrackHistsAlgo :: execute ()
   // get primary vertex
   const xAOD::VertexContainer *vertices(nullptr);
   ANA_CHECK( HelperFunctions::retrieve(vertices, "PrimaryVertices", m_event, m_store, msg()) );
-  const xAOD::Vertex *pvx = HelperFunctions::getPrimaryVertex(vertices, msg());
+  const xAOD::Vertex *pvx = HelperFunctions::getPrimaryVertex(vertices, eventInfo, msg());
 
   ANA_CHECK( m_plots->execute( tracks, pvx, eventWeight, eventInfo ));
 
@@ -141,6 +141,7 @@ EL::StatusCode TrackSelector :: initialize ()
 
 EL::StatusCode TrackSelector :: execute ()
 {
+  xAH::ExecuteProfiler profiler(this);
 
   ANA_MSG_DEBUG("Applying Track Selection... " << m_name);
 
@@ -166,7 +167,9 @@ EL::StatusCode TrackSelector :: executeTrackCollection ()
   // get primary vertex
   const xAOD::VertexContainer *vertices(nullptr);
   ANA_CHECK( HelperFunctions::retrieve(vertices, "PrimaryVertices", m_event, m_store, msg()) );
-  const xAOD::Vertex *pvx = HelperFunctions::getPrimaryVertex(vertices, msg());
+  const xAOD::EventInfo* eventInfo(nullptr);
+  ANA_CHECK( HelperFunctions::retrieve(eventInfo, m_eventInfoContainerName, m_event, m_store, msg()) );
+  const xAOD::Vertex *pvx = HelperFunctions::getPrimaryVertex(vertices, eventInfo, msg());
 
 
   // create output container (if requested) - deep copy
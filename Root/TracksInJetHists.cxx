@@ -19,6 +19,7 @@ StatusCode TracksInJetHists::initialize() {
   //
   m_trkPlots = new TrackHists(m_name, "IPDetails HitCounts TPErrors Chi2Details Debugging vsLumiBlock");
   m_trkPlots -> initialize();
+  addNested( m_trkPlots );
 
   //
   //  d0
@@ -74,9 +75,9 @@ StatusCode TracksInJetHists::execute( const xAOD::TrackParticle* trk, const xAOD
   float d0Err_wrtPV  = sqrt((trk->definingParametersCovMatrixVec().at(0)));
   float d0Sig_wrtPV  = d0Err_wrtPV ? d0_wrtPV/d0Err_wrtPV : -1;
   float d0SigSigned  = sign*fabs(d0Sig_wrtPV);
-  m_trk_d0       ->Fill(signedD0,    eventWeight);
-  m_trk_d0Sig    ->Fill(d0SigSigned, eventWeight);
-  m_trk_d0SigPDF ->Fill(d0SigSigned, eventWeight);
+  fill( m_trk_d0,        signedD0,    eventWeight );
+  fill( m_trk_d0Sig,     d0SigSigned, eventWeight );
+  fill( m_trk_d0SigPDF,  d0SigSigned, eventWeight );
 
   //
   // Signed Z0
@@ -89,25 +90,25 @@ StatusCode TracksInJetHists::execute( const xAOD::TrackParticle* trk, const xAOD
   float z0Err            = sqrt((trk->definingParametersCovMatrixVec().at(2)));
   float sinT             = sin(trk->theta());
 
-  m_trk_z0_signed     ->Fill(z0_wrtPV_signed,         eventWeight);
-  m_trk_z0sinT_signed ->Fill(z0_wrtPV_signed*sinT,    eventWeight);
+  fill( m_trk_z0_signed,      z0_wrtPV_signed,         eventWeight );
+  fill( m_trk_z0sinT_signed,  z0_wrtPV_signed*sinT,    eventWeight );
   if(z0Err){
-    m_trk_z0Sig_signed     ->Fill(z0_wrtPV_signed/z0Err,         eventWeight);
-    m_trk_z0Sig_signed_pdf ->Fill(z0_wrtPV_signed/z0Err,         eventWeight);
-    m_trk_z0SigsinT_signed ->Fill(z0_wrtPV_signed/z0Err*sinT,    eventWeight);
+    fill( m_trk_z0Sig_signed,      z0_wrtPV_signed/z0Err,         eventWeight );
+    fill( m_trk_z0Sig_signed_pdf,  z0_wrtPV_signed/z0Err,         eventWeight );
+    fill( m_trk_z0SigsinT_signed,  z0_wrtPV_signed/z0Err*sinT,    eventWeight );
   }
 
-  m_trk_z0sinTd0->Fill(z0_wrtPV_signed*sinT, signedD0, eventWeight);
+  fill( m_trk_z0sinTd0, z0_wrtPV_signed*sinT, signedD0, eventWeight );
 
   float dEta = trk->eta() - jet->p4().Eta();
   float dPhi = HelperFunctions::dPhi(trk->phi(), jet->p4().Phi());
   float dR   = sqrt(dPhi*dPhi + dEta*dEta);
   //float dR = trk->p4().DeltaR(jet->p4());
 
-  m_trk_jetdPhi ->Fill(HelperFunctions::dPhi(trk->phi(),jet->p4().Phi()), eventWeight);
-  m_trk_jetdEta ->Fill(trk->eta() - jet->eta(),       eventWeight);
-  m_trk_jetdR   ->Fill(dR,   eventWeight);
-  m_trk_jetdR_l ->Fill(dR,   eventWeight);
+  fill( m_trk_jetdPhi,  HelperFunctions::dPhi(trk->phi(),jet->p4().Phi()), eventWeight );
+  fill( m_trk_jetdEta,  trk->eta() - jet->eta(),       eventWeight );
+  fill( m_trk_jetdR,    dR,   eventWeight );
+  fill( m_trk_jetdR_l,  dR,   eventWeight );
 
   return StatusCode::SUCCESS;
 }
@@ -3,6 +3,9 @@
 #include <EventLoop/Worker.h>
 #include <EventLoop/OutputStream.h>
 
+#include <TNamed.h>
+#include <TROOT.h>
+
 #include <xAODJet/JetContainer.h>
 #include <xAODTracking/VertexContainer.h>
 #include <xAODEventInfo/EventInfo.h>
@@ -17,6 +20,11 @@
 // this is needed to distribute the algorithm to the workers
 ClassImp(TreeAlgo)
 
+namespace {
+  // m_asyncWrite of the first TreeAlgo initialized in this job: -1 before that, then 0 or 1
+  int jobAsyncWrite = -1;
+}
+
 TreeAlgo :: TreeAlgo () :
     Algorithm("TreeAlgo")
 {
@@ -44,6 +52,31 @@ EL::StatusCode TreeAlgo :: initialize ()
   treeFile->mkdir(m_name.c_str());
   treeFile->cd(m_name.c_str());
 
+  // all the TreeAlgo write to the same "tree" file, which must not be filled from the event loop and the I/O thread at once
+  if ( jobAsyncWrite < 0 ) {
+    jobAsyncWrite = m_asyncWrite;
+  } else if ( jobAsyncWrite != m_asyncWrite ) {
+    ANA_MSG_ERROR( "m_asyncWrite is " << (m_asyncWrite ? "on" : "off") << " but " << (jobAsyncWrite ? "on" : "off") << " for the TreeAlgo initialized before; it must be the same for all of them. Exiting");
+    return EL::StatusCode::FAILURE;
+  }
+
+  if ( m_asyncWrite ) {
+    if ( m_asyncWriteQueueSize < 1 ) {
+      ANA_MSG_ERROR( "m_asyncWriteQueueSize must be at least 1. Exiting");
+      return EL::StatusCode::FAILURE;
+    }
+    ANA_MSG_INFO( "Filling the output trees on a background thread" );
+    // trees are filled on the I/O thread while the event loop keeps using ROOT
+    ROOT::EnableThreadSafety();
+    m_treeWriter = xAH::AsyncTreeWriter::shared( m_asyncWriteQueueSize );
+  }
+
+  std::string policyError;
+  if ( !m_outputPolicy.parse(m_branchPolicy, policyError) ) {
+    ANA_MSG_ERROR( "Cannot use m_branchPolicy: " << policyError << ". Exiting");
+    return EL::StatusCode::FAILURE;
+  }
+
   // to handle more than one jet collections (reco and truth)
   std::string token;
   std::istringstream ss_reco_containers(m_jetContainerName);
@@ -81,6 +114,15 @@ EL::StatusCode TreeAlgo :: initialize ()
     return EL::StatusCode::FAILURE;
   }
 
+  m_muContainerKeys.setPrefix( m_muContainerName );
+  m_elContainerKeys.setPrefix( m_elContainerName );
+  if ( !m_jetContainers.empty() ) m_jetContainerKeys.setPrefix( m_jetContainers.at(0) );
+  m_photonContainerKeys.setPrefix( m_photonContainerName );
+  m_METContainerKeys.setPrefix( m_METContainerName );
+  std::istringstream ss_fatjet_containers(m_fatJetContainerName);
+  while ( std::getline(ss_fatjet_containers, token, ' ') ){
+    m_fatJetContainerKeys.emplace_back(token);
+  }
 
 
   return EL::StatusCode::SUCCESS;
@@ -99,6 +141,7 @@ EL::StatusCode TreeAlgo :: changeInput (bool /*firstFile*/) { return EL::StatusC
 
 EL::StatusCode TreeAlgo :: execute ()
 {
+  xAH::ExecuteProfiler profiler(this);
 
   // what systematics do we need to process for this event?
   // handle the nominal case (merge all) on every event, always
@@ -168,10 +211,16 @@ EL::StatusCode TreeAlgo :: execute ()
 
   TFile* treeFile = wk()->getOutputFile ("tree");
 
+  auto inSysts = [](const std::vector<std::string>& names, const std::string& systName){
+    return std::find(names.begin(), names.end(), systName) != names.end();
+  };
+
   // let's make the tdirectory and ttrees
   for(const auto& systName: event_systNames){
     // check if we have already created the tree
     if(m_trees.find(systName) != m_trees.end()) continue;
+    // the new tree goes into the output file, which must not be written to in the meantime
+    if(m_treeWriter) m_treeWriter->drain();
     std::string treeName = systName;
     if(systName.empty()) treeName = "nominal";
 
@@ -184,6 +233,7 @@ EL::StatusCode TreeAlgo :: execute ()
 
     m_trees[systName] = createTree( m_event, outTree, treeFile, m_units, msgLvl(MSG::DEBUG), m_store );
     const auto& helpTree = m_trees[systName];
+    helpTree->SetWriter( m_treeWriter );
 
     // tell the tree to go into the file
     outTree->SetDirectory( treeFile->GetDirectory(m_name.c_str()) );
@@ -194,36 +244,73 @@ EL::StatusCode TreeAlgo :: execute ()
     }
 
     // initialize all branch addresses since we just added this tree
+    const bool deltaTree = m_deltaSystTrees && !systName.empty();
+    auto varied = [&](const std::vector<std::string>& names){ return deltaTree && inSysts(names, systName); };
+    // a delta tree has all the branches, for the events nominal rejected; the ones after the varied collections are read from nominal otherwise
+    int nOwnBranches = 0;
+    if ( deltaTree ) {
+      helpTree->AddNominalLink();
+      if (!m_muContainerName.empty() && varied(muSystNames) )         { helpTree->AddMuons(m_muDetailStr);                      }
+      if (!m_elContainerName.empty() && varied(elSystNames) )         { helpTree->AddElectrons(m_elDetailStr);                  }
+      if (!m_jetContainerName.empty() && varied(jetSystNames) )       {
+        helpTree->AddJets( m_jetDetails.size()==1 ? m_jetDetailStr : m_jetDetails.at(0), m_jetBranches.at(0).c_str() );
+      }
+      if ( !m_fatJetContainerName.empty() && varied(fatJetSystNames) ) {
+        std::string token;
+        std::istringstream ss(m_fatJetContainerName);
+        while ( std::getline(ss, token, ' ') ){
+          helpTree->AddFatJets(m_fatJetDetailStr, token);
+        }
+      }
+      if (!m_METContainerName.empty() && varied(metSystNames) )       { helpTree->AddMET(m_METDetailStr);                       }
+      if (!m_photonContainerName.empty() && varied(photonSystNames) ) { helpTree->AddPhotons(m_photonDetailStr);            }
+      nOwnBranches = outTree->GetListOfBranches()->GetEntries();
+    }
     helpTree->AddEvent( m_evtDetailStr );
-    if (!m_trigDetailStr.empty() )              { helpTree->AddTrigger(m_trigDetailStr);                           }
-    if (!m_muContainerName.empty() )            { helpTree->AddMuons(m_muDetailStr);                               }
-    if (!m_elContainerName.empty() )            { helpTree->AddElectrons(m_elDetailStr);                           }
-    if (!m_jetContainerName.empty() )           {
+    if (!m_trigDetailStr.empty() )                                { helpTree->AddTrigger(m_trigDetailStr);                           }
+    if (!m_muContainerName.empty() && !varied(muSystNames) )      { helpTree->AddMuons(m_muDetailStr);                               }
+    if (!m_elContainerName.empty() && !varied(elSystNames) )      { helpTree->AddElectrons(m_elDetailStr);                           }
+    if (!m_jetContainerName.empty() )                             {
       for(unsigned int ll=0; ll<m_jetContainers.size();++ll){
+        if(ll==0 && varied(jetSystNames)) continue;
         if(m_jetDetails.size()==1) helpTree->AddJets       (m_jetDetailStr, m_jetBranches.at(ll).c_str());
-	else{ helpTree->AddJets       (m_jetDetails.at(ll), m_jetBranches.at(ll).c_str()); }
+        else{ helpTree->AddJets       (m_jetDetails.at(ll), m_jetBranches.at(ll).c_str()); }
       }
     }
-    if (!m_l1JetContainerName.empty() )         { helpTree->AddL1Jets();                                           }
-    if (!m_trigJetContainerName.empty() )       { helpTree->AddJets(m_trigJetDetailStr, "trigJet");                }
-    if (!m_truthJetContainerName.empty() )      {
+    if (!m_l1JetContainerName.empty() )                           { helpTree->AddL1Jets();                                           }
+    if (!m_trigJetContainerName.empty() )                         { helpTree->AddJets(m_trigJetDetailStr, "trigJet");                }
+    if (!m_truthJetContainerName.empty() )                        {
       for(unsigned int ll=0; ll<m_truthJetContainers.size();++ll){
         helpTree->AddJets       (m_truthJetDetailStr, m_truthJetBranches.at(ll).c_str());
       }
     }
-    if ( !m_fatJetContainerName.empty() ) {
-	    std::string token;
-  	  std::istringstream ss(m_fatJetContainerName);
-    	while ( std::getline(ss, token, ' ') ){
-      	  helpTree->AddFatJets(m_fatJetDetailStr, token);
-			}
-		}
-    if (!m_truthFatJetContainerName.empty() )   { helpTree->AddTruthFatJets(m_truthFatJetDetailStr);               }
-    if (!m_tauContainerName.empty() )           { helpTree->AddTaus(m_tauDetailStr);                               }
-    if (!m_METContainerName.empty() )           { helpTree->AddMET(m_METDetailStr);                                }
-    if (!m_photonContainerName.empty() )        { helpTree->AddPhotons(m_photonDetailStr);                         }
-    if (!m_truthParticlesContainerName.empty()) { helpTree->AddTruthParts("xAH_truth", m_truthParticlesDetailStr); }
-    if (!m_trackParticlesContainerName.empty()) { helpTree->AddTrackParts(m_trackParticlesContainerName, m_trackParticlesDetailStr); }
+    if ( !m_fatJetContainerName.empty() && !varied(fatJetSystNames) ) {
+      std::string token;
+      std::istringstream ss(m_fatJetContainerName);
+      while ( std::getline(ss, token, ' ') ){
+        helpTree->AddFatJets(m_fatJetDetailStr, token);
+      }
+    }
+    if (!m_truthFatJetContainerName.empty() )                     { helpTree->AddTruthFatJets(m_truthFatJetDetailStr);               }
+    if (!m_tauContainerName.empty() )                             { helpTree->AddTaus(m_tauDetailStr);                               }
+    if (!m_METContainerName.empty() && !varied(metSystNames) )     { helpTree->AddMET(m_METDetailStr);                                }
+    if (!m_photonContainerName.empty() && !varied(photonSystNames) ) { helpTree->AddPhotons(m_photonDetailStr);                       }
+    if (!m_truthParticlesContainerName.empty())                   { helpTree->AddTruthParts("xAH_truth", m_truthParticlesDetailStr); }
+    if (!m_trackParticlesContainerName.empty())                   { helpTree->AddTrackParts(m_trackParticlesContainerName, m_trackParticlesDetailStr); }
+
+    if ( deltaTree ) {
+      // for xAH.trees.systematic_tree
+      std::string nominalBranches;
+      TObjArray* branches = outTree->GetListOfBranches();
+      for ( int i = nOwnBranches; i < branches->GetEntries(); ++i ) {
+        if ( !nominalBranches.empty() ) nominalBranches += ",";
+        nominalBranches += branches->At(i)->GetName();
+      }
+      outTree->GetUserInfo()->Add( new TNamed("nominalBranches", nominalBranches.c_str()) );
+    }
+
+    // compression and basket sizes have to be set once all the branches are there, before the first fill
+    m_outputPolicy.apply( outTree );
   }
 
   /* THIS IS WHERE WE START PROCESSING THE EVENT AND PLOTTING THINGS */
@@ -233,38 +320,52 @@ EL::StatusCode TreeAlgo :: execute ()
   ANA_CHECK( HelperFunctions::retrieve(eventInfo, m_eventInfoContainerName, m_event, m_store, msg()) );
   const xAOD::VertexContainer* vertices(nullptr);
   ANA_CHECK( HelperFunctions::retrieve(vertices, "PrimaryVertices", m_event, m_store, msg()) );
-  // get the primaryVertex
-  const xAOD::Vertex* primaryVertex = HelperFunctions::getPrimaryVertex( vertices , msg());
+  // get the primaryVertex, once for all the systematics and collections
+  const int pvLocation = HelperFunctions::getPrimaryVertexLocation( vertices, eventInfo, msg() );
+  const xAOD::Vertex* primaryVertex = ( pvLocation >= 0 ) ? vertices->at( pvLocation ) : nullptr;
 
+  // whether this event went into the nominal tree, which is always filled first
+  bool inNominal(false);
+
+  xAH::SystematicRegistry& systRegistry = xAH::SystematicRegistry::instance();
   for(const auto& systName: event_systNames){
     auto& helpTree = m_trees[systName];
+    TStopwatch& fillWatch = m_fillWatch[systName];
+    // the branches still hold the previous event until its fill is done
+    fillWatch.Start( false );
+    helpTree->WaitForFill();
+    fillWatch.Stop();
 
-    // assume the nominal container by default
-    std::string muSuffix("");
-    std::string elSuffix("");
-    std::string jetSuffix("");
-    std::string photonSuffix("");
-    std::string fatJetSuffix("");
-    std::string metSuffix("");
     /*
-       if we find the systematic in the corresponding vector, we will use that container's systematic version instead of nominal version
-        NB: since none of these contain the "" (nominal) case because of how I filter it, we handle the merging.. why?
-        - in each loop to make the ##systNames vectors, we check to see if the systName exists in event_systNames which is initialized
-        -   to {""} - the nominal case. If the systName exists, we do not add it to the corresponding ##systNames vector, otherwise, we do.
-        -   This precludes the nominal case in all of the ##systNames vectors, which means the default will always be to run nominal.
+       if we find the systematic in the corresponding vector, we will use that container's systematic version instead of nominal version,
+       otherwise the nominal (ID 0) one. A collection is varied by this systematic if its ID is not 0.
     */
-    if (std::find(muSystNames.begin(), muSystNames.end(), systName) != muSystNames.end()) muSuffix = systName;
-    if (std::find(elSystNames.begin(), elSystNames.end(), systName) != elSystNames.end()) elSuffix = systName;
-    if (std::find(jetSystNames.begin(), jetSystNames.end(), systName) != jetSystNames.end()) jetSuffix = systName;
-    if (std::find(photonSystNames.begin(), photonSystNames.end(), systName) != photonSystNames.end()) photonSuffix = systName;
-    if (std::find(fatJetSystNames.begin(), fatJetSystNames.end(), systName) != fatJetSystNames.end()) fatJetSuffix = systName;
-    if (std::find(metSystNames.begin(), metSystNames.end(), systName) != metSystNames.end()) metSuffix = systName;
-
-    helpTree->FillEvent( eventInfo, m_event );
-
-    // Fill trigger information
-    if ( !m_trigDetailStr.empty() )    {
-      helpTree->FillTrigger( eventInfo );
+    const unsigned int systID   = systRegistry.id( systName );
+    const unsigned int muID     = inSysts(muSystNames, systName)     ? systID : 0;
+    const unsigned int elID     = inSysts(elSystNames, systName)     ? systID : 0;
+    const unsigned int jetID    = inSysts(jetSystNames, systName)    ? systID : 0;
+    const unsigned int photonID = inSysts(photonSystNames, systName) ? systID : 0;
+    const unsigned int fatJetID = inSysts(fatJetSystNames, systName) ? systID : 0;
+    const unsigned int metID    = inSysts(metSystNames, systName)    ? systID : 0;
+
+    // a delta tree only gets the collections this systematic varies, but the same events as a full tree would;
+    // events nominal rejected have nothing to point to, they get all the branches
+    const bool deltaTree = m_deltaSystTrees && !systName.empty();
+    const bool delta = deltaTree && inNominal;
+
+    if ( delta ) {
+      // the branches left over from an event nominal rejected must not be written again
+      clearTree( helpTree );
+    } else {
+      helpTree->FillEvent( eventInfo, m_event );
+
+      // Fill trigger information
+      if ( !m_trigDetailStr.empty() )    {
+        helpTree->FillTrigger( eventInfo );
+      }
+    }
+    if ( deltaTree ) {
+      helpTree->FillNominalLink( eventInfo, inNominal );
     }
 
     // Fill jet trigger information - this can be used if with layer/cleaning info we need to turn off some variables?
@@ -274,19 +375,23 @@ EL::StatusCode TreeAlgo :: execute ()
 
     // for the containers the were supplied, fill the appropriate vectors
     if ( !m_muContainerName.empty() ) {
-      if ( !m_store->contains<xAOD::MuonContainer>(m_muContainerName + muSuffix) ) continue;
+      if ( !m_store->contains<xAOD::MuonContainer>(m_muContainerKeys.key(muID)) ) continue;
 
-      const xAOD::MuonContainer* inMuon(nullptr);
-      ANA_CHECK( HelperFunctions::retrieve(inMuon, m_muContainerName+muSuffix, m_event, m_store, msg()) );
-      helpTree->FillMuons( inMuon, primaryVertex );
+      if ( !delta || muID != 0 ) {
+        const xAOD::MuonContainer* inMuon(nullptr);
+        ANA_CHECK( HelperFunctions::retrieve(inMuon, m_muContainerKeys.key(muID), m_event, m_store, msg()) );
+        helpTree->FillMuons( inMuon, primaryVertex );
+      }
     }
 
     if ( !m_elContainerName.empty() ) {
-      if ( !m_store->contains<xAOD::ElectronContainer>(m_elContainerName + elSuffix) ) continue;
+      if ( !m_store->contains<xAOD::ElectronContainer>(m_elContainerKeys.key(elID)) ) continue;
 
-      const xAOD::ElectronContainer* inElec(nullptr);
-      ANA_CHECK( HelperFunctions::retrieve(inElec, m_elContainerName+elSuffix, m_event, m_store, msg()) );
-      helpTree->FillElectrons( inElec, primaryVertex );
+      if ( !delta || elID != 0 ) {
+        const xAOD::ElectronContainer* inElec(nullptr);
+        ANA_CHECK( HelperFunctions::retrieve(inElec, m_elContainerKeys.key(elID), m_event, m_store, msg()) );
+        helpTree->FillElectrons( inElec, primaryVertex );
+      }
     }
 
     if ( !m_jetContainerName.empty() ) {
@@ -294,11 +399,11 @@ EL::StatusCode TreeAlgo :: execute ()
       for ( unsigned int ll = 0; ll < m_jetContainers.size(); ++ll ) { // Systs only for first jet container
         const xAOD::JetContainer* inJets(nullptr);
         if ( ll==0 ) {
-          if ( !m_store->contains<xAOD::JetContainer>(m_jetContainers.at(ll)+jetSuffix) ) {
+          if ( !m_store->contains<xAOD::JetContainer>(m_jetContainerKeys.key(jetID)) ) {
             reject = true;
             break;
           }
-          ANA_CHECK( HelperFunctions::retrieve(inJets, m_jetContainers.at(ll)+jetSuffix, m_event, m_store, msg()) );
+          ANA_CHECK( HelperFunctions::retrieve(inJets, m_jetContainerKeys.key(jetID), m_event, m_store, msg()) );
         } else {
           if ( !m_store->contains<xAOD::JetContainer>(m_jetContainers.at(ll)) ) {
             reject = true;
@@ -307,7 +412,8 @@ EL::StatusCode TreeAlgo :: execute ()
           ANA_CHECK( HelperFunctions::retrieve(inJets, m_jetContainers.at(ll), m_event, m_store, msg()) );
         }
 
-        helpTree->FillJets( inJets, HelperFunctions::getPrimaryVertexLocation(vertices, msg()), m_jetBranches.at(ll) );
+        if ( delta && (ll > 0 || jetID == 0) ) continue;
+        helpTree->FillJets( inJets, pvLocation, m_jetBranches.at(ll) );
       }
       
       if ( reject ) continue;
@@ -316,17 +422,21 @@ EL::StatusCode TreeAlgo :: execute ()
     if ( !m_l1JetContainerName.empty() ){
       if ( !m_store->contains<xAOD::JetRoIContainer>(m_l1JetContainerName) ) continue;
 
-      const xAOD::JetRoIContainer* inL1Jets(nullptr);
-      ANA_CHECK( HelperFunctions::retrieve(inL1Jets, m_l1JetContainerName, m_event, m_store, msg()) );
-      helpTree->FillL1Jets( inL1Jets);
+      if ( !delta ) {
+        const xAOD::JetRoIContainer* inL1Jets(nullptr);
+        ANA_CHECK( HelperFunctions::retrieve(inL1Jets, m_l1JetContainerName, m_event, m_store, msg()) );
+        helpTree->FillL1Jets( inL1Jets);
+      }
     }
 
     if ( !m_trigJetContainerName.empty() ) {
       if ( !m_store->contains<xAOD::JetContainer>(m_trigJetContainerName) ) continue;
 
-      const xAOD::JetContainer* inTrigJets(nullptr);
-      ANA_CHECK( HelperFunctions::retrieve(inTrigJets, m_trigJetContainerName, m_event, m_store, msg()) );
-      helpTree->FillJets( inTrigJets, HelperFunctions::getPrimaryVertexLocation(vertices, msg()), "trigJet" );
+      if ( !delta ) {
+        const xAOD::JetContainer* inTrigJets(nullptr);
+        ANA_CHECK( HelperFunctions::retrieve(inTrigJets, m_trigJetContainerName, m_event, m_store, msg()) );
+        helpTree->FillJets( inTrigJets, pvLocation, "trigJet" );
+      }
     }
 
     if ( !m_truthJetContainerName.empty() ) {
@@ -336,10 +446,11 @@ EL::StatusCode TreeAlgo :: execute ()
           reject = true;
           break;
         }
+        if ( delta ) continue;
 
         const xAOD::JetContainer* inTruthJets(nullptr);
         ANA_CHECK( HelperFunctions::retrieve(inTruthJets, m_truthJetContainers.at(ll), m_event, m_store, msg()) );
-        helpTree->FillJets( inTruthJets, HelperFunctions::getPrimaryVertexLocation(vertices, msg()), m_truthJetBranches.at(ll) );
+        helpTree->FillJets( inTruthJets, pvLocation, m_truthJetBranches.at(ll) );
       }
       
       if ( reject ) continue;
@@ -347,17 +458,16 @@ EL::StatusCode TreeAlgo :: execute ()
 
     if ( !m_fatJetContainerName.empty() ) {
       bool reject = false;
-      std::string token;
-      std::istringstream ss(m_fatJetContainerName);
-      while ( std::getline(ss, token, ' ') ){
-        if ( !m_store->contains<xAOD::JetContainer>(token+fatJetSuffix) ) {
+      for ( auto& fatJetKeys : m_fatJetContainerKeys ) {
+        if ( !m_store->contains<xAOD::JetContainer>(fatJetKeys.key(fatJetID)) ) {
           reject = true;
           break;
         }
+        if ( delta && fatJetID == 0 ) continue;
 
-      	const xAOD::JetContainer* inFatJets(nullptr);
-	ANA_CHECK( HelperFunctions::retrieve(inFatJets, token+fatJetSuffix, m_event, m_store, msg()) );
-      	helpTree->FillFatJets( inFatJets, token );
+        const xAOD::JetContainer* inFatJets(nullptr);
+        ANA_CHECK( HelperFunctions::retrieve(inFatJets, fatJetKeys.key(fatJetID), m_event, m_store, msg()) );
+        helpTree->FillFatJets( inFatJets, fatJetKeys.prefix() );
       }
       
       if ( reject ) continue;
@@ -366,63 +476,129 @@ EL::StatusCode TreeAlgo :: execute ()
     if ( !m_truthFatJetContainerName.empty() ) {
       if ( !m_store->contains<xAOD::JetContainer>(m_truthFatJetContainerName) ) continue;
 
-      const xAOD::JetContainer* inTruthFatJets(nullptr);
-      ANA_CHECK( HelperFunctions::retrieve(inTruthFatJets, m_truthFatJetContainerName, m_event, m_store, msg()) );
-      helpTree->FillTruthFatJets( inTruthFatJets );
+      if ( !delta ) {
+        const xAOD::JetContainer* inTruthFatJets(nullptr);
+        ANA_CHECK( HelperFunctions::retrieve(inTruthFatJets, m_truthFatJetContainerName, m_event, m_store, msg()) );
+        helpTree->FillTruthFatJets( inTruthFatJets );
+      }
     }
 
     if ( !m_tauContainerName.empty() ) {
       if ( !m_store->contains<xAOD::TauJetContainer>(m_tauContainerName) ) continue;
 
-      const xAOD::TauJetContainer* inTaus(nullptr);
-      ANA_CHECK( HelperFunctions::retrieve(inTaus, m_tauContainerName, m_event, m_store, msg()) );
-      helpTree->FillTaus( inTaus );
+      if ( !delta ) {
+        const xAOD::TauJetContainer* inTaus(nullptr);
+        ANA_CHECK( HelperFunctions::retrieve(inTaus, m_tauContainerName, m_event, m_store, msg()) );
+        helpTree->FillTaus( inTaus );
+      }
     }
 
     if ( !m_METContainerName.empty() ) {
-      if ( !m_store->contains<xAOD::MissingETContainer>(m_METContainerName + metSuffix) ) continue;
+      if ( !m_store->contains<xAOD::MissingETContainer>(m_METContainerKeys.key(metID)) ) continue;
 
-      const xAOD::MissingETContainer* inMETCont(nullptr);
-      ANA_CHECK( HelperFunctions::retrieve(inMETCont, m_METContainerName, m_event, m_store, msg()) );
-      helpTree->FillMET( inMETCont );
+      if ( !delta || metID != 0 ) {
+        const xAOD::MissingETContainer* inMETCont(nullptr);
+        ANA_CHECK( HelperFunctions::retrieve(inMETCont, m_METContainerName, m_event, m_store, msg()) );
+        helpTree->FillMET( inMETCont );
+      }
     }
 
     if ( !m_photonContainerName.empty() ) {
-      if ( !m_store->contains<xAOD::PhotonContainer>(m_photonContainerName + photonSuffix) ) continue;
+      if ( !m_store->contains<xAOD::PhotonContainer>(m_photonContainerKeys.key(photonID)) ) continue;
 
-      const xAOD::PhotonContainer* inPhotons(nullptr);
-      ANA_CHECK( HelperFunctions::retrieve(inPhotons, m_photonContainerName+photonSuffix, m_event, m_store, msg()) );
-      helpTree->FillPhotons( inPhotons );
+      if ( !delta || photonID != 0 ) {
+        const xAOD::PhotonContainer* inPhotons(nullptr);
+        ANA_CHECK( HelperFunctions::retrieve(inPhotons, m_photonContainerKeys.key(photonID), m_event, m_store, msg()) );
+        helpTree->FillPhotons( inPhotons );
+      }
     }
 
     if ( !m_truthParticlesContainerName.empty() ) {
       if ( !m_store->contains<xAOD::TruthParticleContainer>(m_truthParticlesContainerName) ) continue;
 
-      const xAOD::TruthParticleContainer* inTruthParticles(nullptr);
-      ANA_CHECK( HelperFunctions::retrieve(inTruthParticles, m_truthParticlesContainerName, m_event, m_store, msg()));
-      helpTree->FillTruth("xAH_truth", inTruthParticles);
+      if ( !delta ) {
+        const xAOD::TruthParticleContainer* inTruthParticles(nullptr);
+        ANA_CHECK( HelperFunctions::retrieve(inTruthParticles, m_truthParticlesContainerName, m_event, m_store, msg()));
+        helpTree->FillTruth("xAH_truth", inTruthParticles);
+      }
     }
 
     if ( !m_trackParticlesContainerName.empty() ) {
       if ( !m_store->contains<xAOD::TrackParticleContainer>(m_trackParticlesContainerName) ) continue;
 
-      const xAOD::TrackParticleContainer* inTrackParticles(nullptr);
-      ANA_CHECK( HelperFunctions::retrieve(inTrackParticles, m_trackParticlesContainerName, m_event, m_store, msg()));
-      helpTree->FillTracks(m_trackParticlesContainerName, inTrackParticles);
+      if ( !delta ) {
+        const xAOD::TrackParticleContainer* inTrackParticles(nullptr);
+        ANA_CHECK( HelperFunctions::retrieve(inTrackParticles, m_trackParticlesContainerName, m_event, m_store, msg()));
+        helpTree->FillTracks(m_trackParticlesContainerName, inTrackParticles);
+      }
     }
 
     // fill the tree
+    if ( systName.empty() ) inNominal = true;
+    fillWatch.Start( false );
     helpTree->Fill();
+    fillWatch.Stop();
   }
 
   return EL::StatusCode::SUCCESS;
 
 }
 
+void TreeAlgo :: clearTree ( HelpTreeBase* helpTree ) {
+
+  helpTree->ClearEvent();
+  if ( !m_trigDetailStr.empty() )              { helpTree->ClearTrigger(); helpTree->ClearTriggerUser(); }
+  if ( !m_muContainerName.empty() )            { helpTree->ClearMuons(); }
+  if ( !m_elContainerName.empty() )            { helpTree->ClearElectrons(); }
+  if ( !m_jetContainerName.empty() ) {
+    for ( const auto& jetBranch : m_jetBranches ) { helpTree->ClearJets( jetBranch ); }
+  }
+  if ( !m_l1JetContainerName.empty() )         { helpTree->ClearL1Jets(); }
+  if ( !m_trigJetContainerName.empty() )       { helpTree->ClearJets( "trigJet" ); }
+  if ( !m_truthJetContainerName.empty() ) {
+    for ( const auto& truthJetBranch : m_truthJetBranches ) { helpTree->ClearJets( truthJetBranch ); }
+  }
+  for ( const auto& fatJetKeys : m_fatJetContainerKeys ) { helpTree->ClearFatJets( fatJetKeys.prefix() ); }
+  if ( !m_truthFatJetContainerName.empty() )   { helpTree->ClearTruthFatJets(); }
+  if ( !m_tauContainerName.empty() )           { helpTree->ClearTaus(); }
+  if ( !m_METContainerName.empty() )           { helpTree->ClearMET(); helpTree->ClearMETUser(); }
+  if ( !m_photonContainerName.empty() )        { helpTree->ClearPhotons(); }
+  if ( !m_truthParticlesContainerName.empty() ) { helpTree->ClearTruth( "xAH_truth" ); }
+  if ( !m_trackParticlesContainerName.empty() ) { helpTree->ClearTracks( m_trackParticlesContainerName ); }
+}
+
 EL::StatusCode TreeAlgo :: postExecute () { return EL::StatusCode::SUCCESS; }
 
 EL::StatusCode TreeAlgo :: finalize () {
 
+  if ( m_treeWriter ) {
+    m_treeWriter->drain();
+    if ( m_treeWriter->nFailed() ) {
+      ANA_MSG_ERROR( m_treeWriter->nFailed() << " background tree fills failed" );
+      return EL::StatusCode::FAILURE;
+    }
+    for(auto& item: m_trees){
+      if(item.second) item.second->SetWriter( nullptr );
+    }
+    m_treeWriter.reset();
+  }
+
+  if ( !m_outputPolicy.empty() ) {
+    ANA_MSG_INFO( "Output tree sizes with m_branchPolicy \"" << m_branchPolicy << "\"" );
+    for(auto& item: m_trees){
+      if(!item.second) continue;
+      TTree* tree = item.second->GetTree();
+      // the baskets still in memory are not counted until they are written
+      tree->FlushBaskets();
+      const double totMB  = tree->GetTotBytes() / 1.e6;
+      const double zipMB  = tree->GetZipBytes() / 1.e6;
+      const double fillSeconds = m_fillWatch[item.first].RealTime();
+      ANA_MSG_INFO( "  " << tree->GetName() << ": " << tree->GetEntries() << " entries, "
+                    << totMB << " MB -> " << zipMB << " MB (x" << (zipMB > 0 ? totMB/zipMB : 0.) << "), "
+                    << fillSeconds << " s filling (" << (fillSeconds > 0 ? totMB/fillSeconds : 0.) << " MB/s)" );
+    }
+  }
+
   ANA_MSG_INFO( "Deleting tree instances...");
 
   for(auto& item: m_trees){
@@ -433,7 +609,11 @@ EL::StatusCode TreeAlgo :: finalize () {
   return EL::StatusCode::SUCCESS;
 }
 
-EL::StatusCode TreeAlgo :: histFinalize () { return EL::StatusCode::SUCCESS; }
+EL::StatusCode TreeAlgo :: histFinalize ()
+{
+  ANA_CHECK( xAH::Algorithm::algFinalize());
+  return EL::StatusCode::SUCCESS;
+}
 
 HelpTreeBase* TreeAlgo :: createTree(xAOD::TEvent *event, TTree* tree, TFile* file, const float units, bool debug, xAOD::TStore* store) {
     return new HelpTreeBase( event, tree, file, units, debug, store );
@@ -0,0 +1,120 @@
+#include <xAODAnaHelpers/TreeOutputPolicy.h>
+
+#include <fnmatch.h>
+#include <cstdlib>
+#include <sstream>
+
+#include <TBranch.h>
+#include <TObjArray.h>
+
+using namespace xAH;
+
+namespace {
+
+  // ROOT compression algorithm ids, settings are 100*algorithm + level
+  int algorithmId(const std::string& name)
+  {
+    if(name == "ZLIB") return 1;
+    if(name == "LZMA") return 2;
+    if(name == "LZ4")  return 4;
+    if(name == "ZSTD") return 5;
+    return -1;
+  }
+
+  bool toNumber(const std::string& text, long long& value)
+  {
+    if(text.empty()) return false;
+    char* end(nullptr);
+    value = std::strtoll(text.c_str(), &end, 10);
+    return *end == '\0';
+  }
+
+  bool matches(const std::string& pattern, const char* name)
+  {
+    return fnmatch(pattern.c_str(), name, 0) == 0;
+  }
+
+}
+
+bool TreeOutputPolicy::parse(const std::string& rules, std::string& error)
+{
+  m_rules.clear();
+
+  std::istringstream ss(rules);
+  std::string token;
+  while(ss >> token){
+    const std::size_t colon = token.find(':');
+    if(colon == std::string::npos || colon == 0 || colon+1 == token.size()){
+      error = "rule '" + token + "' is not of the form [tree/]branch:key=value,...";
+      return false;
+    }
+
+    Rule rule;
+    const std::string pattern = token.substr(0, colon);
+    const std::size_t slash = pattern.find('/');
+    rule.treePattern   = (slash == std::string::npos) ? "*" : pattern.substr(0, slash);
+    rule.branchPattern = (slash == std::string::npos) ? pattern : pattern.substr(slash+1);
+    if(rule.branchPattern.empty()) rule.branchPattern = "*";
+
+    std::istringstream settings(token.substr(colon+1));
+    std::string setting;
+    while(std::getline(settings, setting, ',')){
+      const std::size_t eq = setting.find('=');
+      const std::string key   = setting.substr(0, eq);
+      const std::string value = (eq == std::string::npos) ? "" : setting.substr(eq+1);
+      long long number(0);
+
+      if(key == "algo"){
+        rule.algorithm = algorithmId(value);
+        if(rule.algorithm < 0){
+          error = "unknown compression algorithm '" + value + "' in rule '" + token + "'";
+          return false;
+        }
+      } else if(key == "level" && toNumber(value, number) && number >= 0 && number <= 9){
+        rule.level = number;
+      } else if(key == "basket" && toNumber(value, number) && number > 0){
+        rule.basketSize = number;
+      } else if(key == "flush" && toNumber(value, number)){
+        rule.autoFlush    = number;
+        rule.setAutoFlush = true;
+      } else {
+        error = "cannot use '" + setting + "' in rule '" + token + "'";
+        return false;
+      }
+    }
+
+    m_rules.push_back(rule);
+  }
+
+  return true;
+}
+
+void TreeOutputPolicy::apply(TTree* tree) const
+{
+  if(m_rules.empty()) return;
+
+  for(const auto& rule: m_rules){
+    if(rule.setAutoFlush && matches(rule.treePattern, tree->GetName())) tree->SetAutoFlush(rule.autoFlush);
+  }
+
+  TObjArray* branches = tree->GetListOfBranches();
+  for(int i = 0; i < branches->GetEntriesFast(); ++i){
+    TBranch* branch = static_cast<TBranch*>(branches->UncheckedAt(i));
+
+    int algorithm(-1), level(-1), basketSize(-1);
+    for(const auto& rule: m_rules){
+      if(!matches(rule.treePattern, tree->GetName()) || !matches(rule.branchPattern, branch->GetName())) continue;
+      if(rule.algorithm  >= 0) algorithm  = rule.algorithm;
+      if(rule.level      >= 0) level      = rule.level;
+      if(rule.basketSize >  0) basketSize = rule.basketSize;
+    }
+
+    if(algorithm >= 0 || level >= 0){
+      // whatever the rules leave open stays as the branch has it
+      if(algorithm < 0) algorithm = branch->GetCompressionAlgorithm();
+      if(level     < 0) level     = branch->GetCompressionLevel();
+      branch->SetCompressionSettings(100*algorithm + level);
+    }
+    if(basketSize > 0) branch->SetBasketSize(basketSize);
+  }
+}
@@ -70,6 +70,8 @@ EL::StatusCode TrigMatcher :: initialize ()
     return EL::StatusCode::FAILURE;
   }
 
+  m_inContainerKeys.setPrefix( m_inContainerName );
+
   // ***************************************
   //
   // Initialise Trig::TrigMatchingTool
@@ -97,6 +99,7 @@ EL::StatusCode TrigMatcher :: initialize ()
 
 EL::StatusCode TrigMatcher :: execute ()
 {
+  xAH::ExecuteProfiler profiler(this);
   // Here you do everything that needs to be done on every single
   // events, e.g. read input variables, apply cuts, and fill
   // histograms and trees.  This is where most of your actual analysis
@@ -125,11 +128,14 @@ EL::StatusCode TrigMatcher :: execute ()
 
     // loop over systematic sets
     //
-    for ( auto systName : *systNames) {
+    xAH::SystematicRegistry& systRegistry = xAH::SystematicRegistry::instance();
+    for ( const auto& systName : *systNames ) {
+
+      unsigned int systID = systRegistry.id( systName );
 
-      ANA_MSG_DEBUG( " syst name: " << systName << "  input container name:  " << m_inContainerName+systName );
+      ANA_MSG_DEBUG( " syst name: " << systName << "  input container name:  " << m_inContainerKeys.key(systID) );
 
-      ANA_CHECK( HelperFunctions::retrieve(inParticles, m_inContainerName + systName, m_event, m_store, msg()));
+      ANA_CHECK( HelperFunctions::retrieve(inParticles, m_inContainerKeys.key(systID), m_event, m_store, msg()));
       ANA_CHECK( executeMatching( inParticles ) );
     }
 
@@ -168,3 +174,9 @@ EL::StatusCode TrigMatcher :: finalize ()
 
   return EL::StatusCode::SUCCESS;
 }
+
+EL::StatusCode TrigMatcher :: histFinalize ()
+{
+  ANA_CHECK( xAH::Algorithm::algFinalize());
+  return EL::StatusCode::SUCCESS;
+}
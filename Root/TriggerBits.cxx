@@ -0,0 +1,179 @@
+#include <xAODAnaHelpers/TriggerBits.h>
+
+#include <algorithm>
+#include <sstream>
+#include <stdexcept>
+
+#include <TH2F.h>
+#include <TList.h>
+
+using namespace xAH;
+
+namespace {
+  const char* const menuName = "triggerMenu";
+
+  // 32-bit FNV-1a over the chain names, each followed by a newline; python/trees.py computes the same
+  const UInt_t noChainsHash = 2166136261u;
+  UInt_t hashChain(UInt_t hash, const std::string& chain)
+  {
+    for(const unsigned char c: chain){
+      hash ^= c;
+      hash *= 16777619u;
+    }
+    hash ^= '\n';
+    hash *= 16777619u;
+    return hash;
+  }
+}
+
+void TriggerBits::setBranches(TTree* tree)
+{
+  tree->Branch("passedTriggerBits",  &m_bits);
+  tree->Branch("triggerL1PSKey",     &m_l1PSKey,  "triggerL1PSKey/I");
+  tree->Branch("triggerHLTPSKey",    &m_hltPSKey, "triggerHLTPSKey/I");
+  tree->Branch("triggerMenuHash",    &m_menuHash, "triggerMenuHash/i");
+}
+
+void TriggerBits::clear()
+{
+  std::fill(m_bits.begin(), m_bits.end(), 0);
+  m_l1PSKey  = -999;
+  m_hltPSKey = -999;
+}
+
+void TriggerBits::addChain(const std::string& chain)
+{
+  m_index.emplace(chain, m_chains.size());
+  m_chains.push_back(chain);
+  m_hashes.push_back(hashChain(m_hashes.empty() ? noChainsHash : m_hashes.back(), chain));
+  for(auto& prescales: m_prescales) prescales.push_back(0.);
+}
+
+int TriggerBits::findChain(const std::string& chain) const
+{
+  auto found = m_index.find(chain);
+  return found == m_index.end() ? -1 : static_cast<int>(found->second);
+}
+
+int TriggerBits::findSet() const
+{
+  auto set = std::find(m_setKeys.begin(), m_setKeys.end(), std::make_pair(m_l1PSKey, m_hltPSKey));
+  return set == m_setKeys.end() ? -1 : static_cast<int>(set - m_setKeys.begin());
+}
+
+void TriggerBits::fill(const std::vector<std::string>& chains, const std::vector<std::string>& passed, const std::vector<float>& prescales, int l1PSKey, int hltPSKey)
+{
+  // chains not indexed yet are added sorted by name, so that the indices do not depend on which chain passes first
+  std::vector<std::string> added;
+  for(const auto& chain: chains) if(findChain(chain) < 0) added.push_back(chain);
+  for(const auto& chain: passed) if(findChain(chain) < 0) added.push_back(chain);
+  if(!added.empty()){
+    std::sort(added.begin(), added.end());
+    added.erase(std::unique(added.begin(), added.end()), added.end());
+    for(const auto& chain: added) addChain(chain);
+    m_menuHash = m_hashes.back();
+  }
+
+  m_l1PSKey  = l1PSKey;
+  m_hltPSKey = hltPSKey;
+  int set = findSet();
+  if(set < 0){
+    set = m_setKeys.size();
+    m_setKeys.emplace_back(l1PSKey, hltPSKey);
+    m_prescales.emplace_back(m_chains.size(), 0.);
+  }
+
+  for(std::size_t i = 0; i < passed.size(); ++i){
+    const unsigned int index = findChain(passed[i]);
+    // the width only grows when a chain is seen for the first time
+    if(m_bits.size() <= index/64) m_bits.resize(index/64 + 1, 0);
+    m_bits[index/64] |= ULong64_t(1) << (index%64);
+    if(i < prescales.size()) m_prescales[set][index] = prescales[i];
+  }
+}
+
+void TriggerBits::writeMenu(TTree* tree) const
+{
+  TList* userInfo = tree->GetUserInfo();
+  if(TObject* old = userInfo->FindObject(menuName)){
+    userInfo->Remove(old);
+    delete old;
+  }
+  if(m_chains.empty() || m_setKeys.empty()) return;
+
+  TH2F* menu = new TH2F(menuName, "prescale of each trigger chain (x) for each L1:HLT prescale key pair (y)",
+                        m_chains.size(), 0, m_chains.size(), m_setKeys.size(), 0, m_setKeys.size());
+  menu->SetDirectory(nullptr);
+  for(std::size_t i = 0; i < m_chains.size(); ++i) menu->GetXaxis()->SetBinLabel(i+1, m_chains[i].c_str());
+  for(std::size_t set = 0; set < m_setKeys.size(); ++set){
+    std::ostringstream keys;
+    keys << m_setKeys[set].first << ":" << m_setKeys[set].second;
+    menu->GetYaxis()->SetBinLabel(set+1, keys.str().c_str());
+    for(std::size_t i = 0; i < m_chains.size(); ++i) menu->SetBinContent(i+1, set+1, m_prescales[set][i]);
+  }
+  userInfo->Add(menu);
+}
+
+bool TriggerBits::setTree(TTree* tree)
+{
+  m_chains.clear();
+  m_index.clear();
+  m_hashes.clear();
+  m_setKeys.clear();
+  m_prescales.clear();
+  m_checkedHash = noChainsHash;
+
+  const TH2F* menu = dynamic_cast<const TH2F*>(tree->GetUserInfo()->FindObject(menuName));
+  if(!menu || !tree->GetBranch("passedTriggerBits") || !tree->GetBranch("triggerMenuHash")) return false;
+
+  const int nChains = menu->GetNbinsX();
+  const int nSets   = menu->GetNbinsY();
+  for(int i = 1; i <= nChains; ++i) addChain(menu->GetXaxis()->GetBinLabel(i));
+  for(int set = 1; set <= nSets; ++set){
+    int l1PSKey(0), hltPSKey(0);
+    char colon(0);
+    std::istringstream keys(menu->GetYaxis()->GetBinLabel(set));
+    keys >> l1PSKey >> colon >> hltPSKey;
+    m_setKeys.emplace_back(l1PSKey, hltPSKey);
+    m_prescales.emplace_back(nChains, 0.);
+    for(int i = 1; i <= nChains; ++i) m_prescales.back()[i-1] = menu->GetBinContent(i, set);
+  }
+
+  for(const char* name: {"passedTriggerBits", "triggerL1PSKey", "triggerHLTPSKey", "triggerMenuHash"})
+    tree->SetBranchStatus(name, 1);
+  tree->SetBranchAddress ("passedTriggerBits", &m_bitsPtr);
+  tree->SetBranchAddress ("triggerL1PSKey",    &m_l1PSKey);
+  tree->SetBranchAddress ("triggerHLTPSKey",   &m_hltPSKey);
+  tree->SetBranchAddress ("triggerMenuHash",   &m_menuHash);
+  return true;
+}
+
+void TriggerBits::checkMenu() const
+{
+  if(m_menuHash == m_checkedHash) return;
+  // the entry was written with the first n chains of some menu; they must be the first n chains of ours
+  if(std::find(m_hashes.begin(), m_hashes.end(), m_menuHash) == m_hashes.end())
+    throw std::runtime_error("xAH::TriggerBits: the entry was written with a different trigger menu than the one stored with the tree, were files with different menus merged?");
+  m_checkedHash = m_menuHash;
+}
+
+bool TriggerBits::passed(const std::string& chain) const
+{
+  checkMenu();
+  const int index = findChain(chain);
+  if(index < 0 || static_cast<std::size_t>(index/64) >= m_bitsPtr->size()) return false;
+  return ((*m_bitsPtr)[index/64] >> (index%64)) & 1;
+}
+
+float TriggerBits::prescale(const std::string& chain) const
+{
+  checkMenu();
+  const int set = findSet();
+  if(set < 0){
+    std::ostringstream message;
+    message << "xAH::TriggerBits: prescale keys " << m_l1PSKey << ":" << m_hltPSKey << " of the entry are not in the trigger menu stored with the tree, were files with different menus merged?";
+    throw std::runtime_error(message.str());
+  }
+  const int index = findChain(chain);
+  return index < 0 ? 0. : m_prescales[set][index];
+}
@@ -221,16 +221,16 @@ void TruthContainer::clear()
 
   if(m_infoSwitch.m_parents){
     m_nParents->clear();
-    m_parent_pdgId->clear();
-    m_parent_barcode->clear();
-    m_parent_status->clear();
+    clearColumn( m_parent_pdgId );
+    clearColumn( m_parent_barcode );
+    clearColumn( m_parent_status );
   }
 
   if(m_infoSwitch.m_children){
     m_nChildren->clear();
-    m_child_pdgId->clear();
-    m_child_barcode->clear();
-    m_child_status->clear();
+    clearColumn( m_child_pdgId );
+    clearColumn( m_child_barcode );
+    clearColumn( m_child_status );
   }
 
   return;
@@ -279,9 +279,9 @@ void TruthContainer::FillTruth( const xAOD::IParticle* particle ){
     int nParents = truth->nParents();
     m_nParents->push_back(nParents);
 
-    m_parent_pdgId  ->push_back(std::vector<int>());
-    m_parent_barcode->push_back(std::vector<int>());
-    m_parent_status ->push_back(std::vector<int>());
+    newRow( m_parent_pdgId );
+    newRow( m_parent_barcode );
+    newRow( m_parent_status );
     for(int iparent = 0; iparent < nParents; ++iparent){
       const xAOD::TruthParticle* parent = truth->parent(iparent);
       if(parent){
@@ -301,9 +301,9 @@ void TruthContainer::FillTruth( const xAOD::IParticle* particle ){
     int nChildren = truth->nChildren();
     m_nChildren->push_back(nChildren);
 
-    m_child_pdgId  ->push_back(std::vector<int>());
-    m_child_barcode->push_back(std::vector<int>());
-    m_child_status ->push_back(std::vector<int>());
+    newRow( m_child_pdgId );
+    newRow( m_child_barcode );
+    newRow( m_child_status );
     for(int ichild = 0; ichild < nChildren; ++ichild){
       const xAOD::TruthParticle* child = truth->child(ichild);
       if(child){
@@ -108,6 +108,8 @@ EL::StatusCode TruthSelector :: initialize ()
     m_truth_cutflow_ptmin_cut       = m_truth_cutflowHist_1->GetXaxis()->FindBin("ptmin_cut");
     m_truth_cutflow_eta_cut         = m_truth_cutflowHist_1->GetXaxis()->FindBin("eta_cut");
 
+    m_truth_cutflowCounter_1.setHistogram( m_truth_cutflowHist_1 );
+
   }
 
   if ( m_inContainerName.empty() ) {
@@ -142,6 +144,7 @@ EL::StatusCode TruthSelector :: initialize ()
 
 EL::StatusCode TruthSelector :: execute ()
 {
+  xAH::ExecuteProfiler profiler(this);
   ANA_MSG_DEBUG( "Applying Jet Selection... ");
 
   // retrieve event
@@ -270,6 +273,7 @@ EL::StatusCode TruthSelector :: finalize ()
     ANA_MSG_INFO( "Filling cutflow");
     m_cutflowHist ->SetBinContent( m_cutflow_bin, m_numEventPass        );
     m_cutflowHistW->SetBinContent( m_cutflow_bin, m_weightNumEventPass  );
+    m_truth_cutflowCounter_1.flush();
   }
 
   return EL::StatusCode::SUCCESS;
@@ -287,18 +291,18 @@ EL::StatusCode TruthSelector :: histFinalize ()
 int TruthSelector :: PassCuts( const xAOD::TruthParticle* truthPart ) {
 
   // fill cutflow bin 'all' before any cut
-  if(m_useCutFlow) m_truth_cutflowHist_1->Fill( m_truth_cutflow_all, 1 );
+  if(m_useCutFlow) m_truth_cutflowCounter_1.fill( m_truth_cutflow_all );
 
   // pT
   if ( m_pT_max != 1e8 ) {
     if ( truthPart->pt() > m_pT_max ) { return 0; }
   }
-  if(m_useCutFlow) m_truth_cutflowHist_1->Fill( m_truth_cutflow_ptmax_cut, 1 );
+  if(m_useCutFlow) m_truth_cutflowCounter_1.fill( m_truth_cutflow_ptmax_cut );
 
   if ( m_pT_min != 1e8 ) {
     if ( truthPart->pt() < m_pT_min ) { return 0; }
   }
-  if(m_useCutFlow) m_truth_cutflowHist_1->Fill( m_truth_cutflow_ptmin_cut, 1 );
+  if(m_useCutFlow) m_truth_cutflowCounter_1.fill( m_truth_cutflow_ptmin_cut );
 
   // eta
   if ( m_eta_max != 1e8 ) {
@@ -307,7 +311,7 @@ int TruthSelector :: PassCuts( const xAOD::TruthParticle* truthPart ) {
   if ( m_eta_min != 1e8 ) {
     if ( fabs(truthPart->eta()) < m_eta_min ) { return 0; }
   }
-  if(m_useCutFlow) m_truth_cutflowHist_1->Fill( m_truth_cutflow_eta_cut, 1 );
+  if(m_useCutFlow) m_truth_cutflowCounter_1.fill( m_truth_cutflow_eta_cut );
 
   // mass
   if ( m_mass_max != 1e8 ) {
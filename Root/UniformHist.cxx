@@ -0,0 +1,57 @@
+#include <xAODAnaHelpers/UniformHist.h>
+
+#include <TArrayD.h>
+#include <TAxis.h>
+#include <TProfile.h>
+
+using namespace xAH;
+
+bool UniformHist::supports(const TH1* hist)
+{
+  if(!hist || hist->GetDimension() > 2 || hist->GetSumw2N() == 0) return false;
+  // profiles keep more than the sum of weights per bin
+  if(hist->InheritsFrom(TProfile::Class())) return false;
+  if(hist->GetXaxis()->IsVariableBinSize() || hist->GetYaxis()->IsVariableBinSize()) return false;
+  return hist->CanExtendAllAxes() == 0;
+}
+
+UniformHist::UniformHist(TH1* hist) :
+  m_hist(hist),
+  m_nx(hist->GetXaxis()->GetNbins()),
+  m_ny(hist->GetDimension() > 1 ? hist->GetYaxis()->GetNbins() : 0),
+  m_xlow(hist->GetXaxis()->GetXmin()),
+  m_xhigh(hist->GetXaxis()->GetXmax()),
+  m_ylow(hist->GetYaxis()->GetXmin()),
+  m_yhigh(hist->GetYaxis()->GetXmax()),
+  m_statOverflows(TH1::GetDefaultStatOverflows()),
+  m_sumw(hist->GetNcells(), 0.),
+  m_sumw2(hist->GetNcells(), 0.)
+{
+}
+
+void UniformHist::flush()
+{
+  if(m_entries == 0) return;
+
+  // before touching the contents, an empty TH1 would otherwise recompute them from the bins
+  double stats[TH1::kNstat] = {0.};
+  m_hist->GetStats(stats);
+  const int nStats = (m_ny > 0) ? 7 : 4;
+  for(int i = 0; i < nStats; ++i) stats[i] += m_stats[i];
+
+  TArrayD& sumw2 = *m_hist->GetSumw2();
+  for(std::size_t bin = 0; bin < m_sumw.size(); ++bin){
+    if(m_sumw[bin] == 0 && m_sumw2[bin] == 0) continue;
+    m_hist->AddBinContent(bin, m_sumw[bin]);
+    sumw2[bin] += m_sumw2[bin];
+    m_sumw[bin]  = 0;
+    m_sumw2[bin] = 0;
+  }
+
+  const double entries = m_hist->GetEntries() + m_entries;
+  m_hist->PutStats(stats);
+  m_hist->SetEntries(entries);
+
+  for(auto& stat : m_stats) stat = 0;
+  m_entries = 0;
+}
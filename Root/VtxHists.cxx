@@ -170,14 +170,14 @@ StatusCode VtxHists::execute( const xAOD::Vertex* vtx, const xAOD::TrackParticle
       pt_miss_iso_x += thisTrk->p4().Px()/1e3;
       pt_miss_iso_y += thisTrk->p4().Py()/1e3;
 
-      h_trkIsoAll      -> Fill( trk_pt_cone20,       eventWeight );
+      fill( h_trkIsoAll,       trk_pt_cone20,       eventWeight );
 
       if(trk_pt_cone20/trkPt > 0.1) continue;
 
-      h_trkIso         -> Fill( trk_pt_cone20,       eventWeight );
+      fill( h_trkIso,          trk_pt_cone20,       eventWeight );
 
-      h_IsoTrk_Pt      -> Fill( trkPt,       eventWeight );
-      h_IsoTrk_Pt_l    -> Fill( trkPt,       eventWeight );
+      fill( h_IsoTrk_Pt,       trkPt,       eventWeight );
+      fill( h_IsoTrk_Pt_l,     trkPt,       eventWeight );
 
       pt_iso_vec.push_back(trkPt);
 
@@ -200,28 +200,28 @@ StatusCode VtxHists::execute( const xAOD::Vertex* vtx, const xAOD::TrackParticle
     // Leading track Pts
     for(uint iLeadTrks = 0; iLeadTrks < m_nLeadIsoTrackPts; ++iLeadTrks){
       float this_pt = (pt_iso_vec.size() > iLeadTrks) ? pt_iso_vec.at(iLeadTrks) : 0;
-      h_IsoTrk_max_Pt.at(iLeadTrks)      -> Fill( this_pt,       eventWeight );
-      h_IsoTrk_max_Pt_l.at(iLeadTrks)    -> Fill( this_pt,       eventWeight );
+      fill( h_IsoTrk_max_Pt.at(iLeadTrks),       this_pt,       eventWeight );
+      fill( h_IsoTrk_max_Pt_l.at(iLeadTrks),     this_pt,       eventWeight );
     }
 
-    h_nIsoTrks1GeV       -> Fill( nIsoTracks1GeV,        eventWeight );
-    h_nIsoTrks2GeV       -> Fill( nIsoTracks2GeV,        eventWeight );
-    h_nIsoTrks5GeV       -> Fill( nIsoTracks5GeV,        eventWeight );
-    h_nIsoTrks10GeV      -> Fill( nIsoTracks10GeV,       eventWeight );
-    h_nIsoTrks15GeV      -> Fill( nIsoTracks15GeV,       eventWeight );
-    h_nIsoTrks20GeV      -> Fill( nIsoTracks20GeV,       eventWeight );
-    h_nIsoTrks25GeV      -> Fill( nIsoTracks25GeV,       eventWeight );
-    h_nIsoTrks30GeV      -> Fill( nIsoTracks30GeV,       eventWeight );
+    fill( h_nIsoTrks1GeV,        nIsoTracks1GeV,        eventWeight );
+    fill( h_nIsoTrks2GeV,        nIsoTracks2GeV,        eventWeight );
+    fill( h_nIsoTrks5GeV,        nIsoTracks5GeV,        eventWeight );
+    fill( h_nIsoTrks10GeV,       nIsoTracks10GeV,       eventWeight );
+    fill( h_nIsoTrks15GeV,       nIsoTracks15GeV,       eventWeight );
+    fill( h_nIsoTrks20GeV,       nIsoTracks20GeV,       eventWeight );
+    fill( h_nIsoTrks25GeV,       nIsoTracks25GeV,       eventWeight );
+    fill( h_nIsoTrks30GeV,       nIsoTracks30GeV,       eventWeight );
 
-    h_pt_miss_iso_x      -> Fill(pt_miss_iso_x ,       eventWeight );
-    h_pt_miss_iso_x_l    -> Fill(pt_miss_iso_x ,       eventWeight );
+    fill( h_pt_miss_iso_x,       pt_miss_iso_x ,       eventWeight );
+    fill( h_pt_miss_iso_x_l,     pt_miss_iso_x ,       eventWeight );
 
-    h_pt_miss_iso_y      -> Fill(pt_miss_iso_y ,       eventWeight );
-    h_pt_miss_iso_y_l    -> Fill(pt_miss_iso_y ,       eventWeight );
+    fill( h_pt_miss_iso_y,       pt_miss_iso_y ,       eventWeight );
+    fill( h_pt_miss_iso_y_l,     pt_miss_iso_y ,       eventWeight );
 
     float pt_miss_iso = sqrt(pt_miss_iso_x*pt_miss_iso_x + pt_miss_iso_y*pt_miss_iso_y);
-    h_pt_miss_iso      -> Fill(pt_miss_iso ,       eventWeight );
-    h_pt_miss_iso_l    -> Fill(pt_miss_iso ,       eventWeight );
+    fill( h_pt_miss_iso,       pt_miss_iso ,       eventWeight );
+    fill( h_pt_miss_iso_l,     pt_miss_iso ,       eventWeight );
 
   }
 
@@ -231,11 +231,11 @@ StatusCode VtxHists::execute( const xAOD::Vertex* vtx, const xAOD::TrackParticle
 StatusCode VtxHists::execute( const xAOD::Vertex* vtx, float eventWeight ) {
 
   //basic
-  h_type       -> Fill( vtx->vertexType(),            eventWeight );
+  fill( h_type,        vtx->vertexType(),            eventWeight );
 
   unsigned int nTrks = vtx->nTrackParticles();
-  h_nTrks      -> Fill( nTrks,       eventWeight );
-  h_nTrks_l    -> Fill( nTrks,       eventWeight );
+  fill( h_nTrks,       nTrks,       eventWeight );
+  fill( h_nTrks_l,     nTrks,       eventWeight );
 
   if(m_fillTrkDetails){
 
@@ -257,8 +257,8 @@ StatusCode VtxHists::execute( const xAOD::Vertex* vtx, float eventWeight ) {
       const xAOD::TrackParticle* thisTrk = vtx->trackParticle(iTrkItr);
       float trkPt = thisTrk->pt()/1e3;
 
-      h_trk_Pt      -> Fill( trkPt,       eventWeight );
-      h_trk_Pt_l    -> Fill( trkPt,       eventWeight );
+      fill( h_trk_Pt,       trkPt,       eventWeight );
+      fill( h_trk_Pt_l,     trkPt,       eventWeight );
 
       if(!m_fillTrkDetails) continue;
 
@@ -287,28 +287,28 @@ StatusCode VtxHists::execute( const xAOD::Vertex* vtx, float eventWeight ) {
       // Leading track Pts
       for(uint iLeadTrks = 0; iLeadTrks < m_nLeadTrackPts; ++iLeadTrks){
 	float this_pt = (pt_vec.size() > iLeadTrks) ? pt_vec.at(iLeadTrks) : 0;
-	h_trk_max_Pt.at(iLeadTrks)      -> Fill( this_pt,       eventWeight );
-	h_trk_max_Pt_l.at(iLeadTrks)    -> Fill( this_pt,       eventWeight );
+	fill( h_trk_max_Pt.at(iLeadTrks),       this_pt,       eventWeight );
+	fill( h_trk_max_Pt_l.at(iLeadTrks),     this_pt,       eventWeight );
       }
 
-      h_nTrks1GeV       -> Fill( nTracks1GeV,        eventWeight );
-      h_nTrks2GeV       -> Fill( nTracks2GeV,        eventWeight );
-      h_nTrks5GeV       -> Fill( nTracks5GeV,        eventWeight );
-      h_nTrks10GeV      -> Fill( nTracks10GeV,       eventWeight );
-      h_nTrks15GeV      -> Fill( nTracks15GeV,       eventWeight );
-      h_nTrks20GeV      -> Fill( nTracks20GeV,       eventWeight );
-      h_nTrks25GeV      -> Fill( nTracks25GeV,       eventWeight );
-      h_nTrks30GeV      -> Fill( nTracks30GeV,       eventWeight );
+      fill( h_nTrks1GeV,        nTracks1GeV,        eventWeight );
+      fill( h_nTrks2GeV,        nTracks2GeV,        eventWeight );
+      fill( h_nTrks5GeV,        nTracks5GeV,        eventWeight );
+      fill( h_nTrks10GeV,       nTracks10GeV,       eventWeight );
+      fill( h_nTrks15GeV,       nTracks15GeV,       eventWeight );
+      fill( h_nTrks20GeV,       nTracks20GeV,       eventWeight );
+      fill( h_nTrks25GeV,       nTracks25GeV,       eventWeight );
+      fill( h_nTrks30GeV,       nTracks30GeV,       eventWeight );
 
-      h_pt_miss_x      -> Fill(pt_miss_x ,       eventWeight );
-      h_pt_miss_x_l    -> Fill(pt_miss_x ,       eventWeight );
+      fill( h_pt_miss_x,       pt_miss_x ,       eventWeight );
+      fill( h_pt_miss_x_l,     pt_miss_x ,       eventWeight );
 
-      h_pt_miss_y      -> Fill(pt_miss_y ,       eventWeight );
-      h_pt_miss_y_l    -> Fill(pt_miss_y ,       eventWeight );
+      fill( h_pt_miss_y,       pt_miss_y ,       eventWeight );
+      fill( h_pt_miss_y_l,     pt_miss_y ,       eventWeight );
 
       float pt_miss = sqrt(pt_miss_x*pt_miss_x + pt_miss_y*pt_miss_y);
-      h_pt_miss      -> Fill(pt_miss ,       eventWeight );
-      h_pt_miss_l    -> Fill(pt_miss ,       eventWeight );
+      fill( h_pt_miss,       pt_miss ,       eventWeight );
+      fill( h_pt_miss_l,     pt_miss ,       eventWeight );
     }
 
   }
@@ -324,7 +324,7 @@ float VtxHists::getIso( const xAOD::TrackParticle *inTrack,            const xAO
   for(auto trk_itr :  *trks ) {
 
     float dZ0 = abs(trk_itr->z0() - inTrack->z0());
-    h_dZ0Before->Fill(dZ0, 1.0);
+    fill( h_dZ0Before, dZ0, 1.0 );
     if(dZ0 > z0_cut) continue;
 
     float dR = trk_itr->p4().DeltaR(inTrack->p4());
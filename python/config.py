@@ -5,6 +5,8 @@ from __future__ import print_function
 import logging
 logger = logging.getLogger("xAH.config")
 
+import hashlib
+import re
 import ROOT
 ROOT.PyConfig.IgnoreCommandLineOptions = True
 ROOT.gROOT.SetBatch(True)
@@ -12,6 +14,11 @@ ROOT.gROOT.SetBatch(True)
 from .utils import NameGenerator
 
 class Config(object):
+  # algorithms whose only job is to record their output containers and systematics lists in the TStore,
+  # so they can be dropped when nothing reads those. Selectors, correctors, etc. also decorate objects
+  # owned by someone else, cut on events or fill cutflows, so they are always kept.
+  _pure_producers = ['JetCalibrator', 'MuonCalibrator', 'ElectronCalibrator', 'PhotonCalibrator']
+
   def __init__(self):
     self._algorithms = []
     self._log        = []
@@ -78,3 +85,85 @@ class Config(object):
 
     # Add the constructed algo to the list of algorithms to run
     self._algorithms.append(alg_obj)
+
+  @staticmethod
+  def _string_properties(alg):
+    """ All string-valued m_* configuration properties of an algorithm instance as (name, value) pairs """
+    for k in dir(alg):
+      if not k.startswith('m_'): continue
+      try:
+        v = getattr(alg, k)
+      except Exception:
+        continue
+      if isinstance(v, ROOT.TString): v = str(v)
+      if isinstance(v, basestring): yield k, v
+
+  @staticmethod
+  def _tokens(value):
+    """ Split lists of container/TStore names as used in the configurations (spaces, commas and MinixAOD's 'in|out' pairs) """
+    return set(filter(None, re.split(r'[\s,|]+', value)))
+
+  def fingerprint(self):
+    """ Hash of the algorithms of the job, in order, and of every option set on them
+
+        Two jobs with the same fingerprint read the same aux variables from the same input, see
+        BasicEventSelection::m_recordAuxReads.
+    """
+    h = hashlib.sha1()
+    for alg in self._algorithms:
+      h.update('{0:s}/{1:s}\n'.format(alg.ClassName(), alg.GetName()))
+    for entry in self._log:
+      h.update('{0}\n'.format(entry))
+    return h.hexdigest()[:16]
+
+  def prune(self):
+    """ Remove algorithms whose outputs no other algorithm reads and switch off systematics no other algorithm reads
+
+        The dependency graph is built from the string properties of every configured algorithm: the output
+        containers (m_outContainerName*) and systematics lists (m_outputAlgo*) an algorithm records are matched
+        against every name any algorithm refers to in its other properties (m_inContainerName*, m_inputAlgo*,
+        TreeAlgo's m_*ContainerName and m_*SystsVec, MinixAOD's copy keys, ...).
+
+        Only the calibrators in Config._pure_producers are candidates. An algorithm is dropped if none of its
+        outputs is read. If only its systematics list is not read, its m_systName* properties are cleared so it
+        runs nominal only. Repeats until nothing changes, since removing one algorithm can leave its inputs unread.
+
+        Returns the names of the removed algorithms and of the algorithms that had their systematics switched off.
+    """
+    removed, nominalOnly = [], []
+    changed = True
+    while changed:
+      changed = False
+
+      consumed = set()
+      for alg in self._algorithms:
+        for k, v in self._string_properties(alg):
+          if k.startswith('m_out') or k in ['m_name', 'm_className']: continue
+          consumed |= self._tokens(v)
+
+      for alg in list(self._algorithms):
+        if alg.ClassName() not in self._pure_producers: continue
+        props = dict(self._string_properties(alg))
+        outContainers = [v for k, v in props.iteritems() if k.startswith('m_outContainerName')]
+        outSystLists  = [v for k, v in props.iteritems() if k.startswith('m_outputAlgo')]
+        # a blank name is filled in at runtime, so we cannot tell who reads it
+        if not all(outContainers) or not all(outSystLists): continue
+
+        containersRead = any(self._tokens(v) & consumed for v in outContainers)
+        systListsRead  = any(self._tokens(v) & consumed for v in outSystLists)
+        if not containersRead and not systListsRead:
+          logger.warning("Removing {0:s} ({1:s}): nothing reads its outputs {2:s}".format(alg.GetName(), alg.ClassName(), ', '.join(outContainers + outSystLists)))
+          self._algorithms.remove(alg)
+          removed.append(alg.GetName())
+          changed = True
+        elif not systListsRead:
+          systNames = [k for k, v in props.iteritems() if k.startswith('m_systName') and v]
+          if not systNames: continue
+          logger.warning("Running {0:s} ({1:s}) nominal only: nothing reads its systematics list {2:s}".format(alg.GetName(), alg.ClassName(), ', '.join(outSystLists)))
+          for k in systNames:
+            setattr(alg, k, '')
+            self._log.append((alg.GetName(), k, ''))
+          nominalOnly.append(alg.GetName())
+          changed = True
+
+    return removed, nominalOnly
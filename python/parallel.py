@@ -0,0 +1,90 @@
+#!/usr/bin/env python
+# -*- coding: utf-8 -*-,
+from __future__ import absolute_import
+from __future__ import print_function
+import logging
+logger = logging.getLogger("xAH.parallel")
+
+import glob
+import os
+import subprocess
+import sys
+from multiprocessing.pool import ThreadPool
+
+# top-level xAH_run.py options that the parallel driver sets itself for every chunk
+_chunk_owned_options = {'--submitDir': True, '--nevents': True, '--skip': True, '-f': False, '--force': False, '--recordAuxReads': True, '--sample': True}
+
+def chunk_ranges(first, nevents, events_per_chunk):
+  """ Split [first, first+nevents) into (skip, n) event ranges of at most events_per_chunk events """
+  ranges = []
+  start = first
+  while start < first + nevents:
+    n = min(events_per_chunk, first + nevents - start)
+    ranges.append((start, n))
+    start += n
+  return ranges
+
+def chunk_command(argv, driver, chunk_dir, sample, skip, nevents, aux_reads=None):
+  """ Build the xAH_run.py command line of a single chunk from the one we were called with
+
+      Everything up to the driver name is kept, except the options we set per chunk. The chunk runs on the given sample only, always with the direct driver.
+      If aux_reads is given, the chunk records the aux variables it read there instead of in the file of --recordAuxReads.
+  """
+  cmd = [sys.executable, argv[0]]
+  args = argv[1:argv.index(driver)]
+  i = 0
+  while i < len(args):
+    opt = args[i].split('=')[0]
+    if opt in _chunk_owned_options:
+      # skip the value too, unless it was passed as --opt=value
+      i += 2 if _chunk_owned_options[opt] and '=' not in args[i] else 1
+      continue
+    cmd.append(args[i])
+    i += 1
+  if aux_reads: cmd += ['--recordAuxReads', aux_reads]
+  cmd += ['--submitDir', chunk_dir, '--sample', sample, '--skip', str(skip), '--nevents', str(nevents), '-f', 'direct']
+  return cmd
+
+def _run_chunk(job):
+  cmd, log_file = job
+  with open(log_file, 'w') as f:
+    return subprocess.call(cmd, stdout=f, stderr=subprocess.STDOUT)
+
+def run_chunks(commands, log_files, nworkers):
+  """ Run the chunk commands, at most nworkers at a time. Workers pick up the next chunk as soon as they are done. """
+  pool = ThreadPool(nworkers)
+  try:
+    return_codes = pool.map(_run_chunk, zip(commands, log_files), chunksize=1)
+  finally:
+    pool.close()
+    pool.join()
+  return return_codes
+
+def merge_outputs(chunk_dirs, submit_dir):
+  """ hadd the histogram and output stream files of all chunks into submit_dir, keeping EventLoop's layout """
+  outputs = {}
+  for chunk_dir in chunk_dirs:
+    for path in glob.glob(os.path.join(chunk_dir, 'hist-*.root')) + glob.glob(os.path.join(chunk_dir, 'data-*', '*.root')):
+      outputs.setdefault(os.path.relpath(path, chunk_dir), []).append(path)
+
+  for relpath, inputs in sorted(outputs.iteritems()):
+    target = os.path.join(submit_dir, relpath)
+    if not os.path.isdir(os.path.dirname(target)):
+      os.makedirs(os.path.dirname(target))
+    logger.info("merging {0:d} chunk(s) into {1:s}".format(len(inputs), target))
+    if subprocess.call(['hadd', '-f', target] + inputs):
+      raise RuntimeError("hadd failed for {0:s}".format(target))
+
+def merge_aux_reads(chunk_files, target):
+  """ Write the union of the aux variables read by all chunks to target """
+  from .utils import read_aux_reads, write_aux_reads
+  fingerprints, items = set(), {}
+  for chunk_file in chunk_files:
+    fingerprint, chunk_items = read_aux_reads(chunk_file)
+    fingerprints.add(fingerprint)
+    for container, variables in chunk_items.items():
+      items.setdefault(container, set()).update(variables)
+  if len(fingerprints) != 1:
+    raise RuntimeError("the chunks recorded their aux variables with different configuration fingerprints: {0:s}".format(', '.join(map(str, sorted(fingerprints)))))
+  logger.info("writing the aux variables read by {0:d} chunk(s) to {1:s}".format(len(chunk_files), target))
+  write_aux_reads(target, fingerprints.pop(), items)
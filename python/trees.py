@@ -0,0 +1,139 @@
+#!/usr/bin/env python
+# -*- coding: utf-8 -*-,
+from __future__ import absolute_import
+from __future__ import print_function
+import logging
+logger = logging.getLogger("xAH.trees")
+
+def is_delta_tree(tree):
+  """ Whether tree is a systematic tree written by TreeAlgo with m_deltaSystTrees, holding only the varied collections """
+  return bool(tree.GetBranch('inNominal'))
+
+def systematic_tree(directory, syst_name, nominal_name='nominal'):
+  """ Get the tree of a systematic from the TreeAlgo output directory, so that it reads like a full tree
+
+      If the tree was written with m_deltaSystTrees, it is wrapped in a DeltaTree. Full systematic trees are returned as they are.
+  """
+  tree = directory.Get(syst_name)
+  if not tree:
+    raise KeyError("no tree {0:s} in {1:s}".format(syst_name, directory.GetPath()))
+  if not is_delta_tree(tree):
+    return tree
+
+  nominal = directory.Get(nominal_name)
+  if not nominal:
+    raise KeyError("no tree {0:s} in {1:s} to complete {2:s}".format(nominal_name, directory.GetPath(), syst_name))
+  logger.debug("reading the unvaried branches of {0:s} from {1:s}".format(syst_name, nominal_name))
+  return DeltaTree(tree, nominal)
+
+class DeltaTree(object):
+  """ A systematic tree written with m_deltaSystTrees, read as if it had been written in full
+
+      tree = systematic_tree(directory, 'JET_JER_SINGLE_NP__1up')
+      for entry in tree:
+        print(entry.eventNumber, entry.jet_pt, entry.passL1)
+
+      Entries with inNominal set are completed from the nominal entry with the same runNumber and eventNumber: the branches listed in the
+      nominalBranches object of the tree's user info (event, trigger and unvaried collections) then come from nominal. The other entries are
+      events nominal rejected, written in full to the systematic tree. Anything else is forwarded to the systematic tree.
+
+      The nominal tree is indexed on runNumber and eventNumber rather than linked by entry number, so both trees can be hadd'ed or chained,
+      as long as they cover the same files.
+  """
+  def __init__(self, tree, nominal):
+    self.tree = tree
+    self.nominal = nominal
+    self.in_nominal = False
+    branches = tree.GetUserInfo().FindObject('nominalBranches')
+    if not branches:
+      raise KeyError("no list of nominal branches in the user info of {0:s}".format(tree.GetName()))
+    self.nominal_branches = frozenset(name for name in branches.GetTitle().split(',') if name)
+    if not nominal.GetTreeIndex():
+      nominal.BuildIndex('runNumber', 'eventNumber')
+
+  def GetEntries(self):
+    return self.tree.GetEntries()
+
+  def __len__(self):
+    return self.GetEntries()
+
+  def GetEntry(self, entry):
+    """ Read entry, and the entry of nominal it links to """
+    nbytes = self.tree.GetEntry(entry)
+    self.in_nominal = bool(self.tree.inNominal)
+    if self.in_nominal:
+      run, event = self.tree.runNumber, self.tree.eventNumber
+      nominal_bytes = self.nominal.GetEntryWithIndex(run, event)
+      if nominal_bytes <= 0:
+        raise LookupError("event {0:d} of run {1:d} of {2:s} is not in {3:s}".format(event, run, self.tree.GetName(), self.nominal.GetName()))
+      nbytes += nominal_bytes
+    return nbytes
+
+  def __iter__(self):
+    for entry in range(self.GetEntries()):
+      self.GetEntry(entry)
+      yield self
+
+  def __getattr__(self, name):
+    # only called for what is not set in __init__
+    if self.in_nominal and name in self.nominal_branches:
+      return getattr(self.nominal, name)
+    return getattr(self.tree, name)
+
+def _menu_hashes(chains):
+  """ 32-bit FNV-1a hash of the first n chains, for each n, as written by xAH::TriggerBits """
+  hashes, h = [], 2166136261
+  for chain in chains:
+    for c in bytearray(chain.encode()) + bytearray(b'\n'):
+      h = ((h ^ c) * 16777619) & 0xffffffff
+    hashes.append(h)
+  return hashes
+
+class TriggerBits(object):
+  """ Read back the trigger decisions written with the trigBitset trigger detail, see xAH::TriggerBits
+
+      trigger = TriggerBits(tree)
+      for entry in tree:
+        if trigger.passed('HLT_j380'): ...
+
+      For a TChain, the menu of the first file is used. Entries written with a different menu, e.g. after
+      merging files from different menus, raise a RuntimeError.
+  """
+  def __init__(self, tree):
+    self.tree = tree
+    if tree.InheritsFrom('TChain'):
+      tree.LoadTree(0)
+      tree = tree.GetTree()
+    menu = tree.GetUserInfo().FindObject('triggerMenu')
+    if not menu:
+      raise KeyError("no trigger menu in the user info of {0:s}".format(tree.GetName()))
+    self.chains = [menu.GetXaxis().GetBinLabel(i+1) for i in range(menu.GetNbinsX())]
+    self.index = dict((chain, i) for i, chain in enumerate(self.chains))
+    self.hashes = set(_menu_hashes(self.chains))
+    self.hashes.add(2166136261)
+    self.sets = {}
+    for s in range(menu.GetNbinsY()):
+      l1, hlt = menu.GetYaxis().GetBinLabel(s+1).split(':')
+      self.sets[(int(l1), int(hlt))] = [menu.GetBinContent(i+1, s+1) for i in range(menu.GetNbinsX())]
+
+  def _check_menu(self):
+    if self.tree.triggerMenuHash not in self.hashes:
+      raise RuntimeError("the entry was written with a different trigger menu than the one stored with the tree, were files with different menus merged?")
+
+  def passed(self, chain):
+    """ Whether chain passed in the current entry """
+    self._check_menu()
+    i = self.index.get(chain)
+    if i is None:
+      return False
+    bits = self.tree.passedTriggerBits
+    return i//64 < bits.size() and bool((bits[i//64] >> (i%64)) & 1)
+
+  def prescale(self, chain):
+    """ Prescale of chain for the keys of the current entry, 0 if the chain is unknown or never passed with these keys """
+    self._check_menu()
+    keys = (self.tree.triggerL1PSKey, self.tree.triggerHLTPSKey)
+    if keys not in self.sets:
+      raise RuntimeError("prescale keys {0:d}:{1:d} of the entry are not in the trigger menu stored with the tree, were files with different menus merged?".format(*keys))
+    i = self.index.get(chain)
+    return 0. if i is None else self.sets[keys][i]
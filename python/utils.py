@@ -102,3 +102,28 @@ def parse_json(filename):
     # Return json file
     return json.loads(content)
 
+
+def read_aux_reads(filename):
+  """ Read a file written by BasicEventSelection::m_recordAuxReads
+
+      Returns the configuration fingerprint it was written with (None if it has none) and a dictionary of the
+      aux variables read, {container: set of variables}.
+  """
+  fingerprint, items = None, {}
+  with open(filename) as f:
+    for line in f:
+      line = line.strip()
+      if line.startswith('# fingerprint '):
+        fingerprint = line.split()[2]
+      if not line or line.startswith('#'): continue
+      container, _, variables = line.partition(':')
+      items.setdefault(container, set()).update(v for v in variables.split('.') if v)
+  return fingerprint, items
+
+def write_aux_reads(filename, fingerprint, items):
+  """ Write aux variables read, {container: set of variables}, in the format of BasicEventSelection::m_recordAuxReads """
+  with open(filename, 'w') as f:
+    f.write("# aux variables read by the job, for BasicEventSelection::m_auxItemList (xAH_run.py --auxReadList)\n")
+    if fingerprint: f.write("# fingerprint {0:s}\n".format(fingerprint))
+    for container, variables in sorted(items.items()):
+      f.write("{0:s}:{1:s}\n".format(container, '.'.join(sorted(variables))))
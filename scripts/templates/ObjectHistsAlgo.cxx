@@ -65,6 +65,7 @@ EL::StatusCode ${name}HistsAlgo :: initialize ()
 
 EL::StatusCode ${name}HistsAlgo :: execute ()
 {
+  xAH::ExecuteProfiler profiler(this);
   const xAOD::EventInfo* eventInfo(nullptr);
   ANA_CHECK(HelperFunctions::retrieve(eventInfo, "EventInfo", m_event, m_store, m_verbose));
 
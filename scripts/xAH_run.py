@@ -80,6 +80,7 @@ parser.add_argument('--submitDir', dest='submit_dir', metavar='<directory>', typ
 parser.add_argument('--nevents', dest='num_events', metavar='<n>', type=int, help='Number of events to process for all datasets. (0 = no limit)', default=0)
 parser.add_argument('--skip', dest='skip_events', metavar='<n>', type=int, help='Number of events to skip at start for all datasets. (0 = no limit)', default=0)
 parser.add_argument('-f', '--force', dest='force_overwrite', action='store_true', help='Overwrite previous directory if it exists.')
+parser.add_argument('--sample', dest='sample_name', metavar='<name>', type=str, default='', help='Only run on the dataset with this name out of those found from --files. The parallel driver uses it to give every chunk a single dataset.')
 
 parser.add_argument('--version', action='version', version='xAH_run.py {version}'.format(version=__version__), help='{version}'.format(version=__version__))
 parser.add_argument('--mode', dest='access_mode', type=str, metavar='{class, branch, athena}', choices=['class', 'branch', 'athena'], default='class', help='run using class access mode, branch access mode, or athena access mode')
@@ -96,6 +97,9 @@ parser.add_argument('--inputEOS', action='store_true', dest='use_scanEOS', defau
 parser.add_argument('--scanXRD', action='store_true', dest='use_scanXRD', default=False, help='If enabled, will search the xrootd server for the given pattern')
 parser.add_argument('-l', '--log-level', type=str, default='info', help='Logging level. See https://docs.python.org/3/howto/logging.html for more info.')
 parser.add_argument('--stats', action='store_true', dest='variable_stats', default=False, help='If enabled, will variable usage statistics.')
+parser.add_argument('--pruneAlgs', action='store_true', dest='prune_algs', default=False, help='If enabled, will remove calibrators whose output containers no other algorithm reads, and run calibrators nominal only if no other algorithm reads their systematics.')
+parser.add_argument('--recordAuxReads', dest='record_aux_reads', metavar='<file>', type=str, default='', help='Write the aux variables read from the input to this file at the end of the job, one `Container:var1.var2` line per container. Needs a BasicEventSelection and a driver running on this machine (direct, local, parallel); with parallel, the file is the union of what the chunks read.')
+parser.add_argument('--auxReadList', dest='aux_read_list', metavar='<file>', type=str, default='', help='Only read the aux variables listed in this file, as written by --recordAuxReads with the same configuration; a list recorded with a different configuration is refused. Containers not listed are read in full.')
 
 # first is the driver common arguments
 drivers_common = argparse.ArgumentParser(add_help=False, description='Common Driver Arguments')
@@ -166,10 +170,20 @@ local = drivers_parser.add_parser('local',
                                   formatter_class=lambda prog: CustomFormatter(prog, max_help_position=30),
                                   parents=[drivers_common])
 
+parallel = drivers_parser.add_parser('parallel',
+                                     help='Run your jobs locally on many cores, splitting the events into chunks',
+                                     usage=baseUsageStr.format('parallel'),
+                                     formatter_class=lambda prog: CustomFormatter(prog, max_help_position=30),
+                                     parents=[drivers_common])
+
 # define arguments for prooflite driver
 prooflite.add_argument('--optPerfTree',          metavar='', type=int, required=False, default=None, help='the option to turn on the performance tree in PROOF.  if this is set to 1, it will write out the tree')
 prooflite.add_argument('--optBackgroundProcess', metavar='', type=int, required=False, default=None, help='the option to do processing in a background process in PROOF')
 
+# define arguments for parallel driver
+parallel.add_argument('--nWorkers',       metavar='<n>', type=int, required=False, default=None, help='number of chunks to process at the same time. Defaults to the number of cores.')
+parallel.add_argument('--eventsPerChunk', metavar='<n>', type=int, required=False, default=None, help='number of events per chunk. Defaults to splitting the job into 4 chunks per worker so that fast workers pick up more of them.')
+
 # define arguments for prun driver
 prun.add_argument('--optGridDestSE',           metavar='', type=str, required=False, default=None)
 prun.add_argument('--optGridSite',             metavar='', type=str, required=False, default=None)
@@ -395,6 +409,14 @@ if __name__ == "__main__":
           sh_list = ROOT.SH.DiskListLocal(mother_dir)
           ROOT.SH.scanDir(sh_all, sh_list, fname_base, os.path.basename(sample_dir))
 
+    # keep only the requested sample
+    if args.sample_name:
+      sample = sh_all.get(args.sample_name)
+      if not sample:
+        raise ValueError("no dataset named {0:s} found".format(args.sample_name))
+      sh_all = ROOT.SH.SampleHandler()
+      sh_all.add(sample)
+
     # print out the samples we found
     xAH_logger.info("\t%d different dataset(s) found", len(sh_all))
         #if not args.use_scanDQ2:
@@ -482,6 +504,11 @@ if __name__ == "__main__":
           break
 
 
+    if args.prune_algs:
+      xAH_logger.info("\tpruning algorithms with unused outputs")
+      removed, nominalOnly = configurator.prune()
+      xAH_logger.info("\tremoved {0:d} algorithm(s), switched off systematics of {1:d} algorithm(s)".format(len(removed), len(nominalOnly)))
+
     # If we wish to add an NTupleSvc, make sure an output stream (NB: must have the same name of the service itself!)
     # is created and added to the job *before* the service
     if hasattr(ROOT.EL, 'NTupleSvc'):
@@ -489,6 +516,36 @@ if __name__ == "__main__":
         if isinstance(alg, ROOT.EL.NTupleSvc) and not job.outputHas(alg.GetName()):
           job.outputAdd(ROOT.EL.OutputStream(alg.GetName()))
 
+    # Algorithms with m_doProfiling write their execute() timing into a dedicated output stream
+    for alg in configurator._algorithms:
+      if not getattr(alg, 'm_doProfiling', False): continue
+      streamName = str(alg.m_profilingStreamName)
+      if not job.outputHas(streamName):
+        xAH_logger.info("\tadding output stream {0:s} for execute() profiling".format(streamName))
+        job.outputAdd(ROOT.EL.OutputStream(streamName))
+
+    # BasicEventSelection records the aux variables read, and restricts the reading to a list of them
+    if args.record_aux_reads or args.aux_read_list:
+      eventSelections = [alg for alg in configurator._algorithms if isinstance(alg, ROOT.BasicEventSelection)]
+      if not eventSelections:
+        xAH_logger.warning("\t--recordAuxReads and --auxReadList need a BasicEventSelection in the job, ignoring them")
+      # the variables read depend on the configuration, so a list only applies to the configuration it was recorded with
+      fingerprint = configurator.fingerprint()
+      if args.record_aux_reads:
+        if args.driver not in ['direct', 'local', 'parallel']:
+          xAH_logger.warning("\tthe aux variables read are written where the job runs, {0:s} may not be on this machine".format(args.record_aux_reads))
+        for alg in eventSelections:
+          alg.m_recordAuxReads = os.path.abspath(args.record_aux_reads)
+          alg.m_auxReadsFingerprint = fingerprint
+      if args.aux_read_list:
+        from xAODAnaHelpers.utils import read_aux_reads
+        listFingerprint, items = read_aux_reads(args.aux_read_list)
+        if listFingerprint != fingerprint:
+          raise ValueError("{0:s} was recorded with configuration fingerprint {1}, this job has {2:s}. Record the aux variables read again with --recordAuxReads.".format(args.aux_read_list, listFingerprint, fingerprint))
+        xAH_logger.info("\treading only the listed aux variables of {0:d} container(s)".format(len(items)))
+        for alg in eventSelections:
+          alg.m_auxItemList = ' '.join('{0:s}:{1:s}'.format(container, '.'.join(sorted(variables))) for container, variables in sorted(items.items()))
+
     # Add the algorithms to the job
     map(job.algsAdd, configurator._algorithms)
 
@@ -527,6 +584,13 @@ if __name__ == "__main__":
         getattr(driver.options(), setter)(getattr(ROOT.EL.Job, opt), getattr(args, opt))
         xAH_logger.info("\t - driver.options().{0:s}({1:s}, {2})".format(setter, getattr(ROOT.EL.Job, opt), getattr(args, opt)))
 
+    elif (args.driver == "parallel"):
+      # every chunk is its own direct-driver job in a separate process (own TEvent, TStore and algorithm instances)
+      # since neither EventLoop nor the CP tools can be shared between threads
+      import multiprocessing
+      if args.nWorkers is None: args.nWorkers = multiprocessing.cpu_count()
+      xAH_logger.info("\tusing {0:d} workers".format(args.nWorkers))
+
     elif (args.driver == "prun"):
       driver = ROOT.EL.PrunDriver()
       for opt, t in map(lambda x: (x.dest, x.type), prun._actions):
@@ -621,7 +685,29 @@ if __name__ == "__main__":
         xAH_logger.info("\t - driver.options().{0:s}({1:s}, {2})".format(setter, getattr(ROOT.EL.Job, opt), getattr(args, opt)))
 
     xAH_logger.info("\tsubmit job")
-    if args.driver in ["prun","condor","lsf","slurm","local"] and not args.optBatchWait:
+    if args.driver == "parallel":
+      from xAODAnaHelpers import parallel as xAH_parallel
+      # --skip and --nevents apply to every sample, so every sample is split into its own chunks
+      samples = [(sample.name(), max(0, sample.getNumEntries() - args.skip_events)) for sample in sh_all]
+      if args.num_events > 0: samples = [(name, min(nevents, args.num_events)) for name, nevents in samples]
+      nevents = sum(nevents for name, nevents in samples)
+      eventsPerChunk = args.eventsPerChunk or max(1, -(-nevents // (4*args.nWorkers)))
+      chunks = [(name, skip, n) for name, nevents in samples for skip, n in xAH_parallel.chunk_ranges(args.skip_events, nevents, eventsPerChunk)]
+      xAH_logger.info("\tsplitting {0:d} events of {1:d} sample(s) into {2:d} chunk(s)".format(nevents, len(samples), len(chunks)))
+
+      chunk_dirs = [os.path.join(args.submit_dir, 'chunks', 'chunk{0:04d}'.format(i)) for i in range(len(chunks))]
+      os.makedirs(os.path.join(args.submit_dir, 'chunks'))
+      # every chunk records the aux variables it read to its own file, their union is written to --recordAuxReads below
+      aux_reads = [chunk_dir + '.auxReads.txt' if args.record_aux_reads else None for chunk_dir in chunk_dirs]
+      commands = [xAH_parallel.chunk_command(sys.argv, args.driver, chunk_dir, name, skip, n, aux_reads=chunk_aux_reads) for chunk_dir, (name, skip, n), chunk_aux_reads in zip(chunk_dirs, chunks, aux_reads)]
+      return_codes = xAH_parallel.run_chunks(commands, [chunk_dir + '.log' for chunk_dir in chunk_dirs], args.nWorkers)
+      failed = [chunk_dir for chunk_dir, rc in zip(chunk_dirs, return_codes) if rc != 0]
+      if failed:
+        raise RuntimeError("{0:d} chunk(s) failed, see {1:s}".format(len(failed), ', '.join(chunk_dir + '.log' for chunk_dir in failed)))
+      xAH_parallel.merge_outputs(chunk_dirs, args.submit_dir)
+      if args.record_aux_reads:
+        xAH_parallel.merge_aux_reads(aux_reads, args.record_aux_reads)
+    elif args.driver in ["prun","condor","lsf","slurm","local"] and not args.optBatchWait:
       driver.submitOnly(job, args.submit_dir)
     else:
       driver.submit(job, args.submit_dir)
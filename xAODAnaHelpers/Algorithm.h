@@ -12,6 +12,9 @@
 
 #include <string>
 
+// ROOT include(s):
+#include <TStopwatch.h>
+
 // for StatusCode::isSuccess
 #include "AsgTools/StatusCode.h"
 #include "AsgTools/ToolStore.h"
@@ -25,8 +28,12 @@
 #include <AsgTools/MsgStreamMacros.h>
 #include <AsgTools/MessageCheck.h>
 
+class TH1F;
+
 namespace xAH {
 
+    class ExecuteProfiler;
+
     /**
         @rst
 
@@ -139,6 +146,21 @@ namespace xAH {
          */
         int m_isMC = -1;
 
+        /**
+            @rst
+                Record the wall time, CPU time and resident memory (RSS) growth of every ``execute()`` call of this instance.
+
+                Histograms of the per-call values are booked under a directory named after :cpp:member:`~xAH::Algorithm::m_name` and one entry per instance is added to the ``summary`` tree, both in the output stream :cpp:member:`~xAH::Algorithm::m_profilingStreamName`. ``xAH_run.py`` creates the stream for you; if you steer the job yourself, add an ``EL::OutputStream`` of that name to the job.
+
+                .. note:: Only algorithms that open an :cpp:class:`xAH::ExecuteProfiler` at the top of their ``execute()`` are timed. All algorithms in |xAH| do.
+
+            @endrst
+         */
+        bool m_doProfiling = false;
+
+        /** Name of the output stream the profiling histograms and summary tree are written to */
+        std::string m_profilingStreamName = "profiling";
+
       protected:
         /**
             @rst
@@ -267,6 +289,28 @@ namespace xAH {
         }
 
       private:
+        friend class ExecuteProfiler;
+
+        /** @brief Book the profiling histograms in :cpp:member:`~xAH::Algorithm::m_profilingStreamName` */
+        StatusCode initializeProfiling();
+        /** @brief Write the per-instance profiling summary and print it */
+        StatusCode finalizeProfiling();
+        /** @brief Start timing one ``execute()`` call */
+        void profileStart();
+        /** @brief Stop timing one ``execute()`` call and fill the profiling histograms */
+        void profileStop();
+
+        TStopwatch m_profileWatch;                 //!
+        TH1F* m_profileWallTime  = nullptr;        //!
+        TH1F* m_profileCPUTime   = nullptr;        //!
+        TH1F* m_profileRSSGrowth = nullptr;        //!
+        unsigned long m_profileNCalls = 0;         //!
+        double m_profileTotalWallTime = 0.0;       //!
+        double m_profileTotalCPUTime  = 0.0;       //!
+        double m_profileMaxWallTime   = 0.0;       //!
+        long   m_profileRSSStart      = 0;         //!
+        long   m_profileRSSTotalGrowth = 0;        //!
+
         /**
             @rst
               A boolean to keep track of whether this instance was registered or not.
@@ -296,5 +340,33 @@ namespace xAH {
         std::map<std::string, bool> m_toolAlreadyUsed; //!
   };
 
+    /**
+        @rst
+            Scoped timer for a single ``execute()`` call. Create one at the very top of ``execute()``::
+
+                EL::StatusCode JetSelector :: execute ()
+                {
+                  xAH::ExecuteProfiler profiler(this);
+                  // ...
+                }
+
+            Every return path is covered since the call is closed when the profiler goes out of scope. It does nothing unless :cpp:member:`xAH::Algorithm::m_doProfiling` is set.
+
+        @endrst
+     */
+  class ExecuteProfiler {
+      public:
+        ExecuteProfiler(Algorithm* alg) :
+          m_alg(alg->m_doProfiling ? alg : nullptr)
+        {
+          if(m_alg) m_alg->profileStart();
+        }
+        ~ExecuteProfiler(){
+          if(m_alg) m_alg->profileStop();
+        }
+      private:
+        Algorithm* m_alg;
+  };
+
 }
 #endif
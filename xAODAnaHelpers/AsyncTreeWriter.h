@@ -0,0 +1,75 @@
+#ifndef xAODAnaHelpers_AsyncTreeWriter_H
+#define xAODAnaHelpers_AsyncTreeWriter_H
+
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <unordered_map>
+
+class TTree;
+
+namespace xAH {
+
+  /**
+      @rst
+          Calls ``TTree::Fill()`` on a dedicated I/O thread, so basket compression and the writes to disk no longer run on the event loop.
+
+          :cpp:func:`~xAH::AsyncTreeWriter::fill` only queues the tree and returns. The tree reads its branch buffers when the fill actually happens, so the caller must not touch the buffers of that tree again before :cpp:func:`~xAH::AsyncTreeWriter::wait` returns for it. Buffers of other trees can be filled in the meantime, which is where the gain comes from when writing one tree per systematic.
+
+          The queue holds at most ``maxQueued`` fills. Once it is full, :cpp:func:`~xAH::AsyncTreeWriter::fill` blocks until the I/O thread catches up.
+
+          All the trees are filled from the same thread, so trees sharing an output file never write to it concurrently. Anything else touching that file (creating new trees, writing it out) has to wait for :cpp:func:`~xAH::AsyncTreeWriter::drain` first.
+
+      @endrst
+   */
+  class AsyncTreeWriter
+  {
+
+  public:
+
+    /** @param maxQueued  maximum number of fills waiting to be done before fill() blocks */
+    AsyncTreeWriter(std::size_t maxQueued);
+    ~AsyncTreeWriter();
+
+    AsyncTreeWriter(const AsyncTreeWriter&) = delete;
+    AsyncTreeWriter& operator=(const AsyncTreeWriter&) = delete;
+
+    /** @brief Writer shared by everybody in this process, created with the given queue size on first use */
+    static std::shared_ptr<AsyncTreeWriter> shared(std::size_t maxQueued);
+
+    /** @brief Queue a call to ``tree->Fill()``, blocking while the queue is full */
+    void fill(TTree* tree);
+    /** @brief Return once all the fills queued for ``tree`` are done */
+    void wait(const TTree* tree);
+    /** @brief Return once the queue is empty and the I/O thread is idle */
+    void drain();
+
+    /** @brief Number of ``TTree::Fill()`` calls that reported an error so far */
+    unsigned long nFailed() const;
+
+  private:
+
+    void workerLoop();
+
+    std::size_t m_maxQueued;
+
+    mutable std::mutex      m_mutex;
+    std::condition_variable m_wake;
+    std::condition_variable m_done;
+
+    // guarded by m_mutex
+    std::deque<TTree*> m_queue;
+    std::unordered_map<const TTree*, unsigned int> m_pending;
+    unsigned long m_nFailed = 0;
+    bool          m_stop    = false;
+
+    std::thread m_worker;
+
+  };
+
+}
+
+#endif
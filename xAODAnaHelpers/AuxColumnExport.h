@@ -0,0 +1,85 @@
+#ifndef xAODAnaHelpers_AuxColumnExport_H
+#define xAODAnaHelpers_AuxColumnExport_H
+
+#include <string>
+#include <vector>
+
+#include <TTree.h>
+
+#include <AthContainers/AuxVectorData.h>
+#include <AthContainers/AuxTypeRegistry.h>
+
+namespace xAH {
+
+  /**
+      @rst
+          Writes ``float`` and ``int`` aux variables of a whole container into ``std::vector`` branches at once, reading straight from the aux store instead of going through the objects one by one.
+
+          When the objects of the container sit next to each other in the same aux store, which is the case for owning containers and for views that did not drop anything, every column is a single loop over the stored array: a plain copy, or a division by the unit for energies. Otherwise the values are picked up by index from the store of each object. Missing variables are written as ``-999``.
+
+          The columns are declared in the detail string of the container, see :cpp:class:`HelperClasses::IParticleInfoSwitch`.
+
+      @endrst
+   */
+  class AuxColumnExport
+  {
+
+  public:
+
+    enum Type { FLOAT, INT };
+
+    AuxColumnExport() = default;
+    ~AuxColumnExport();
+
+    AuxColumnExport(const AuxColumnExport&) = delete;
+    AuxColumnExport& operator=(const AuxColumnExport&) = delete;
+
+    /** @brief Export the aux variable ``auxName`` to the branch ``branchName``, dividing it by ``units`` if it is a float */
+    void add(const std::string& auxName, const std::string& branchName, Type type, float units = 1.);
+
+    bool empty() const { return m_columns.empty(); }
+
+    void setBranches(TTree* tree);
+    void clear();
+
+    /** @brief Write out one entry per object of ``container``, in the same order */
+    template<class T_CONT>
+    void fill(const T_CONT& container)
+    {
+      const std::size_t n = container.size();
+      if(m_columns.empty() || n == 0) return;
+
+      const SG::AuxVectorData* store = container[0]->container();
+      const std::size_t first = container[0]->index();
+      bool contiguous = (store != nullptr);
+      for(std::size_t i = 1; contiguous && i < n; ++i)
+        contiguous = container[i]->container() == store && container[i]->index() == first + i;
+
+      if(contiguous) {
+        fillRange(store, first, n);
+      } else {
+        for(std::size_t i = 0; i < n; ++i) fillElement(container[i]->container(), container[i]->index());
+      }
+    }
+
+  private:
+
+    struct Column {
+      std::string        branchName;
+      SG::auxid_t        auxid;
+      Type               type;
+      float              units;
+      std::vector<float>* floats = nullptr;
+      std::vector<int>*   ints   = nullptr;
+    };
+
+    void fillRange(const SG::AuxVectorData* store, std::size_t first, std::size_t n);
+    void fillElement(const SG::AuxVectorData* store, std::size_t index);
+
+    std::vector<Column> m_columns;
+
+  };
+
+}
+
+#endif
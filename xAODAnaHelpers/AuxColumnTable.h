@@ -0,0 +1,98 @@
+#ifndef xAODAnaHelpers_AuxColumnTable_H
+#define xAODAnaHelpers_AuxColumnTable_H
+
+#include <string>
+#include <vector>
+#include <type_traits>
+
+#include <AthContainers/AuxElement.h>
+#include <AthContainers/AuxVectorData.h>
+#include <AthContainers/AuxTypeRegistry.h>
+
+namespace xAH {
+
+  /**
+      @rst
+          A table of scalar aux variables that get copied into ``std::vector`` branches, one entry per object, doing the same as ``safeFill`` for each of them.
+
+          Columns are added once, when the branches are booked. The first time an object of a new container is filled, the table looks up which of the variables that container provides and where their data lives, and picks for every column either a plain copy or a push of the default value. Every other object of the same container then just runs those copies, without checking for the variables again.
+
+          :cpp:func:`~xAH::AuxColumnTable::reset` has to be called whenever the containers can change, i.e. at least once per event, since the resolved data pointers belong to the containers of that event.
+
+      @endrst
+   */
+  class AuxColumnTable
+  {
+
+  public:
+
+    /**
+        @brief Add a column, filling ``destination`` with the ``auxName`` variable of type ``T`` divided by ``units``, or with ``defaultValue`` if the variable is missing
+     */
+    template<typename T, typename U>
+    void add(const std::string& auxName, std::vector<U>* destination, U defaultValue, int units = 1)
+    {
+      static_assert(std::is_arithmetic<T>::value && std::is_arithmetic<U>::value, "only scalar aux variables can be copied");
+      Column column;
+      column.auxid        = SG::AuxTypeRegistry::instance().getAuxID<T>(auxName);
+      column.destination  = destination;
+      column.defaultValue = defaultValue;
+      column.units        = units;
+      column.copyValue    = &copyValue<T, U>;
+      column.copyDefault  = &copyDefault<U>;
+      m_columns.push_back(column);
+      reset();
+    }
+
+    bool empty() const { return m_columns.empty(); }
+
+    /** @brief Fill every column from ``obj`` */
+    void fill(const SG::AuxElement& obj)
+    {
+      if(m_columns.empty()) return;
+      if(!m_resolved || obj.container() != m_container) resolve(obj.container());
+      const std::size_t index = obj.index();
+      for(const Column& column : m_columns) column.copy(column, index);
+    }
+
+    /** @brief Forget the resolved container, so the next object looks up its variables again */
+    void reset() { m_container = nullptr; m_resolved = false; }
+
+  private:
+
+    struct Column {
+      SG::auxid_t auxid;
+      void*       destination;
+      double      defaultValue;
+      int         units;
+      const void* data = nullptr;
+      void (*copy)       (const Column&, std::size_t) = nullptr;
+      void (*copyValue)  (const Column&, std::size_t);
+      void (*copyDefault)(const Column&, std::size_t);
+    };
+
+    template<typename T, typename U>
+    static void copyValue(const Column& column, std::size_t index)
+    {
+      typedef typename SG::AuxDataTraits<T>::element_type stored_type;
+      static_cast<std::vector<U>*>(column.destination)->push_back( static_cast<const stored_type*>(column.data)[index] / column.units );
+    }
+
+    template<typename U>
+    static void copyDefault(const Column& column, std::size_t /*index*/)
+    {
+      static_cast<std::vector<U>*>(column.destination)->push_back( static_cast<U>(column.defaultValue) );
+    }
+
+    void resolve(const SG::AuxVectorData* container);
+
+    std::vector<Column> m_columns;
+
+    const SG::AuxVectorData* m_container = nullptr;
+    bool m_resolved = false;
+
+  };
+
+}
+
+#endif
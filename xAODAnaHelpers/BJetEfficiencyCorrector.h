@@ -17,6 +17,7 @@
 
 // algorithm wrapper
 #include "xAODAnaHelpers/Algorithm.h"
+#include "xAODAnaHelpers/SystematicRegistry.h"
 
 class BJetEfficiencyCorrector : public xAH::Algorithm
 {
@@ -60,6 +61,9 @@ public:
 
 private:
 
+  /// @brief input container name of each systematic, indexed by xAH::SystematicRegistry ID
+  xAH::SystematicKeys m_inContainerKeys;  //!
+
   /// @brief The decoration key written to passing objects
   std::string m_decorSF = "";
   
@@ -96,6 +96,25 @@ class BasicEventSelection : public xAH::Algorithm
     // Print Branch List
     bool m_printBranchList = false;
 
+    /**
+      @rst
+        Write the aux variables the job actually read from the input to this file at the end of the job, one ``Container:var1.var2...`` line per container, in the format of :cpp:member:`~BasicEventSelection::m_auxItemList`. Set by ``xAH_run.py --recordAuxReads``.
+      @endrst
+     */
+    std::string m_recordAuxReads = "";
+
+    /// @brief Fingerprint of the job configuration, written to :cpp:member:`~BasicEventSelection::m_recordAuxReads` so that ``xAH_run.py --auxReadList`` only applies the list to the same configuration. Set by ``xAH_run.py``.
+    std::string m_auxReadsFingerprint = "";
+
+    /**
+      @rst
+        Aux variables to read from the input, as space-separated ``Container:var1.var2...`` entries. The other aux variables of the listed containers are never read from the file; containers that are not listed are read in full.
+
+        This is usually not set by hand, but by ``xAH_run.py --auxReadList`` from the variables a previous job with the same configuration actually used; it refuses a list recorded with a different configuration fingerprint.
+      @endrst
+     */
+    std::string m_auxItemList = "";
+
   // Trigger
     /**
       @rst
@@ -157,6 +176,7 @@ class BasicEventSelection : public xAH::Algorithm
     /** @brief trigDecTool name for configurability if name is not default.  If empty, use the default name. If not empty, change the name. */
     std::string m_trigDecTool_name{"xAH_TDT"};
 
+
   private:
 
     std::set<std::pair<uint32_t,uint32_t> > m_RunNr_VS_EvtNr; //!
@@ -239,6 +259,11 @@ class BasicEventSelection : public xAH::Algorithm
     virtual EL::StatusCode finalize ();
     virtual EL::StatusCode histFinalize ();
 
+  private:
+    /// @brief Write the aux variables read from the input so far to m_recordAuxReads
+    EL::StatusCode writeAuxReads ();
+
+  public:
     /// @cond
     // this is needed to distribute the algorithm to the workers
     ClassDef(BasicEventSelection, 1);
@@ -0,0 +1,107 @@
+#ifndef xAODAnaHelpers_ColumnBuffers_H
+#define xAODAnaHelpers_ColumnBuffers_H
+
+#include <cstdint>
+#include <cstring>
+#include <vector>
+
+namespace xAH {
+
+  /**
+      @rst
+          Helpers for the ``std::vector`` branches of the :cpp:class:`~xAH::ParticleContainer` classes, holding one entry per object.
+
+          Clearing a flat column keeps its capacity, but clearing a nested ``std::vector<std::vector<U> >`` column destroys all the inner vectors, so every row of the next event would be allocated again. :cpp:func:`xAH::clearColumn` moves the inner vectors to a pool instead, and :cpp:func:`xAH::newRow` takes them back from there, so that after the first few events filling the nested columns no longer allocates.
+
+          The pool is shared by all the columns with the same element type on the same thread.
+
+      @endrst
+   */
+  template<typename U>
+  std::vector<std::vector<U> >& rowPool()
+  {
+    static thread_local std::vector<std::vector<U> > pool;
+    return pool;
+  }
+
+  /** @brief Remove all the entries of a flat column, keeping its capacity */
+  template<typename T>
+  void clearColumn(std::vector<T>* column)
+  {
+    column->clear();
+  }
+
+  /** @brief Remove all the rows of a nested column, handing their storage back to the pool */
+  template<typename U>
+  void clearColumn(std::vector<std::vector<U> >* column)
+  {
+    std::vector<std::vector<U> >& pool = rowPool<U>();
+    for(auto& row : *column) pool.push_back(std::move(row));
+    column->clear();
+  }
+
+  template<typename T>
+  void clearColumn(std::vector<T>& column)
+  {
+    clearColumn(&column);
+  }
+
+  /** @brief Append an empty row to a nested column, reusing a pooled one if there is any, and return it */
+  template<typename U>
+  std::vector<U>& newRow(std::vector<std::vector<U> >* column)
+  {
+    std::vector<std::vector<U> >& pool = rowPool<U>();
+    if(pool.empty()) {
+      column->emplace_back();
+    } else {
+      column->push_back(std::move(pool.back()));
+      pool.pop_back();
+      column->back().clear();
+    }
+    return column->back();
+  }
+
+  /** @brief Append a copy of ``row`` to a nested column, reusing a pooled row if there is any */
+  template<typename U>
+  void pushRow(std::vector<std::vector<U> >* column, const std::vector<U>& row)
+  {
+    std::vector<U>& dest = newRow(column);
+    dest.assign(row.begin(), row.end());
+  }
+
+  /**
+      @rst
+          Round ``value`` to the nearest float that has only the top ``mantissaBits`` bits of the mantissa set, ties to even. The exponent is kept, so the range is that of a float, while with 10 bits the precision is the one of a half float. The zeroed low bits cost next to nothing once the basket is compressed.
+
+      @endrst
+   */
+  inline float roundMantissa(float value, int mantissaBits)
+  {
+    if(mantissaBits >= 23 || mantissaBits < 0) return value;
+
+    std::uint32_t bits;
+    std::memcpy(&bits, &value, sizeof(bits));
+    // inf and nan stay as they are
+    if((bits & 0x7f800000u) == 0x7f800000u) return value;
+
+    const int drop = 23 - mantissaBits;
+    const std::uint32_t lsb = (bits >> drop) & 1u;
+    bits += (std::uint32_t(1) << (drop-1)) - 1 + lsb;
+    bits &= ~((std::uint32_t(1) << drop) - 1);
+    std::memcpy(&value, &bits, sizeof(bits));
+    return value;
+  }
+
+  inline void roundColumn(std::vector<float>& column, int mantissaBits)
+  {
+    for(auto& value : column) value = roundMantissa(value, mantissaBits);
+  }
+
+  inline void roundColumn(std::vector<std::vector<float> >& column, int mantissaBits)
+  {
+    for(auto& row : column) roundColumn(row, mantissaBits);
+  }
+
+}
+
+#endif
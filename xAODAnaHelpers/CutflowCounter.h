@@ -0,0 +1,55 @@
+#ifndef xAODAnaHelpers_CutflowCounter_H
+#define xAODAnaHelpers_CutflowCounter_H
+
+#include <cstddef>
+#include <vector>
+
+class TH1D;
+
+namespace xAH {
+
+  /**
+      @rst
+          Counts objects passing the cuts of an object-level cutflow in a plain array and adds the counts to the cutflow histogram only once, at :cpp:func:`~xAH::CutflowCounter::flush`.
+
+          The object cutflow histograms (``cutflow_electrons_1``, ...) have extendable, labelled axes, so every ``TH1::Fill`` goes through the axis lookup and bounds handling. The selectors fill them after every cut for every object, so instead they look up the bin of each cut once in ``initialize()`` as before and count here::
+
+            m_el_cutflowCounter_1.setHistogram( m_el_cutflowHist_1 );
+            ...
+            m_el_cutflowCounter_1.fill( m_el_cutflow_all );
+            ...
+            // in finalize()
+            m_el_cutflowCounter_1.flush();
+
+          Several algorithms can share the same histogram, each of them adds its own counts.
+
+      @endrst
+   */
+  class CutflowCounter
+  {
+
+  public:
+
+    /** @brief The histogram the counts go to. Call after the bins of all cuts have been looked up. */
+    void setHistogram(TH1D* hist);
+
+    /** @brief Count one object in bin ``bin`` of the histogram */
+    void fill(int bin)
+    {
+      if(static_cast<std::size_t>(bin) >= m_counts.size()) m_counts.resize(bin+1, 0);
+      ++m_counts[bin];
+    }
+
+    /** @brief Add the counts to the histogram (same as one ``Fill(bin, 1)`` per count) and reset them */
+    void flush();
+
+  private:
+
+    TH1D* m_hist = nullptr;
+    std::vector<unsigned long> m_counts;
+
+  };
+
+}
+
+#endif
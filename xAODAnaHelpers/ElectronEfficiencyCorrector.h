@@ -22,6 +22,7 @@
 
 // algorithm wrapper
 #include "xAODAnaHelpers/Algorithm.h"
+#include "xAODAnaHelpers/SystematicRegistry.h"
 
 /**
   @rst
@@ -81,6 +82,9 @@ public:
   std::string m_corrFileNameTrigMCEff = "";
 
 private:
+
+  /// @brief input container name of each systematic, indexed by xAH::SystematicRegistry ID
+  xAH::SystematicKeys m_inContainerKeys;  //!
   int m_numEvent;         //!
   int m_numObject;        //!
 
@@ -20,6 +20,10 @@ class ElectronHists : public IParticleHists
     virtual StatusCode initialize();
     virtual StatusCode execute( const xAOD::Electron* electron, float eventWeight, const xAOD::EventInfo* eventInfo = 0);
     virtual StatusCode execute( const xAH::Electron*  electron, float eventWeight, const xAH::EventInfo*  eventInfo = 0);
+
+    /** Adds the accessors of the isolation detail */
+    virtual void auxIDs( std::set< SG::auxid_t >& auxids ) const;
+
     using HistogramManager::book; // make other overloaded version of book() to show up in subclass
     using IParticleHists::execute; // overload
 
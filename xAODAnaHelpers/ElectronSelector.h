@@ -26,6 +26,9 @@
 
 // algorithm wrapper
 #include "xAODAnaHelpers/Algorithm.h"
+#include "xAODAnaHelpers/SystematicRegistry.h"
+#include "xAODAnaHelpers/KinematicPreFilter.h"
+#include "xAODAnaHelpers/CutflowCounter.h"
 
 // forward-declare for now until IsolationSelectionTool interface is updated
 namespace CP {
@@ -79,6 +82,15 @@ public:
   bool       	 m_createSelectedContainer = false;
   /// @brief Number of objects to process, set ``n=-1`` to look at all
   int        	 m_nToProcess = -1;
+  /**
+      @rst
+          Apply the :math:`p_T` and cluster :math:`|\eta|` cuts to the whole container in one vectorized pass and run :cpp:func:`ElectronSelector::passCuts` only on the electrons passing them.
+
+          Electrons rejected this way only enter the ``all`` bin of the object cutflow, and do not get the decorations :cpp:func:`ElectronSelector::passCuts` adds (``d0sig``, ``z0sintheta``, PID decisions, ...).
+
+      @endrst
+   */
+  bool       	 m_doKinematicPreFilter = false;
   /// @brief Require event to have minimum number of objects passing selection
   int        	 m_pass_min = -1;
   /// @brief Require event to have maximum number of objects passing selection
@@ -190,6 +202,10 @@ public:
 
 private:
 
+  /// @brief input/output container name of each systematic, indexed by xAH::SystematicRegistry ID
+  xAH::SystematicKeys m_inContainerKeys;  //!
+  xAH::SystematicKeys m_outContainerKeys; //!
+
   /**
     @brief Performs the Likelihood PID B-Layer cut locally.
     @rst
@@ -228,10 +244,14 @@ private:
   /// @brief checks if the algorithm has been used already
   bool  m_isUsedBefore = false;     //!
 
+  xAH::KinematicPreFilter m_kinematicPreFilter; //!
+
   /* object-level cutflow */
 
   TH1D* m_el_cutflowHist_1 = nullptr;            //!
+  xAH::CutflowCounter m_el_cutflowCounter_1; //!
   TH1D* m_el_cutflowHist_2 = nullptr;            //!
+  xAH::CutflowCounter m_el_cutflowCounter_2; //!
 
   int   m_el_cutflow_all;              //!
   int   m_el_cutflow_author_cut;       //!
@@ -0,0 +1,104 @@
+#ifndef xAODAnaHelpers_EtaPhiGrid_H
+#define xAODAnaHelpers_EtaPhiGrid_H
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <vector>
+
+namespace xAH {
+
+  /**
+      @rst
+          A spatial index of objects in :math:`(\eta, \phi)` (or rapidity and :math:`\phi`) for finding all objects within :math:`\Delta R` of a given direction without comparing every pair.
+
+          The plane is cut into square cells of side :math:`\Delta R_{\mathrm{max}}`, the largest distance that will be asked for, wrapping around in :math:`\phi`. A query only has to look at the cell of the direction and its eight neighbours. Objects beyond :math:`|\eta| = 5` are kept in the outermost cells, which only makes those cells busier.
+
+          Each object is stored with a ``category`` (e.g. the object type) and an ``index`` (e.g. its position in its container) of the caller's choosing::
+
+            xAH::EtaPhiGrid grid(0.4);
+            for(std::size_t i = 0; i < jets->size(); ++i)
+              grid.insert(jets->at(i)->rapidity(), jets->at(i)->phi(), JET, i);
+            grid.forEachNeighbour(el->rapidity(), el->phi(), 0.4, [&](const xAH::EtaPhiGrid::Entry& entry){ ... });
+
+          The cells keep their memory between :cpp:func:`~xAH::EtaPhiGrid::clear` calls, so the grid can be refilled every event without allocating.
+
+      @endrst
+   */
+  class EtaPhiGrid
+  {
+
+  public:
+
+    struct Entry
+    {
+      float eta;
+      float phi;
+      int category;
+      std::size_t index;
+    };
+
+    /** @param maxDeltaR  largest :math:`\Delta R` passed to forEachNeighbour() */
+    EtaPhiGrid(float maxDeltaR = 0.4);
+
+    /** @brief Remove all objects */
+    void clear();
+
+    /** @brief Number of objects in the grid */
+    std::size_t size() const { return m_size; }
+
+    void insert(float eta, float phi, int category, std::size_t index);
+
+    /**
+        @brief Call ``func(entry)`` for every object within ``deltaR`` of ``(eta, phi)``, including an object at exactly that position
+        @note  ``deltaR`` must not be larger than the one the grid was made for
+     */
+    template<typename FUNC_T>
+    void forEachNeighbour(float eta, float phi, float deltaR, FUNC_T func) const
+    {
+      const int etaCell = etaBin(eta);
+      const int phiCell = phiBin(phi);
+      const float deltaR2 = deltaR*deltaR;
+
+      for(int iEta = std::max(etaCell-1, 0); iEta <= std::min(etaCell+1, m_nEta-1); ++iEta){
+        for(int dPhi = -1; dPhi <= 1; ++dPhi){
+          // with fewer than three phi cells the neighbours wrap onto each other
+          if(m_nPhi < 3 && dPhi != 0 && (m_nPhi == 1 || dPhi == 1)) continue;
+          const int iPhi = (phiCell + dPhi + m_nPhi) % m_nPhi;
+          for(const Entry& entry : m_cells[iEta*m_nPhi + iPhi]){
+            const float dEta = entry.eta - eta;
+            const float dphi = deltaPhi(entry.phi, phi);
+            if(dEta*dEta + dphi*dphi <= deltaR2) func(entry);
+          }
+        }
+      }
+    }
+
+    static float deltaPhi(float phi1, float phi2)
+    {
+      float dphi = std::fabs(phi1 - phi2);
+      if(dphi > static_cast<float>(M_PI)) dphi = 2*static_cast<float>(M_PI) - dphi;
+      return dphi;
+    }
+
+  private:
+
+    int etaBin(float eta) const;
+    int phiBin(float phi) const;
+
+    float m_cellSize;
+    float m_etaMax;
+    int   m_nEta;
+    int   m_nPhi;
+    float m_phiCellSize;
+
+    std::vector< std::vector<Entry> > m_cells;
+    // cells that are not empty, so clear() does not have to visit all of them
+    std::vector<int> m_usedCells;
+    std::size_t m_size = 0;
+
+  };
+
+}
+
+#endif
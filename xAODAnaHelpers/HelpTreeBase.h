@@ -39,11 +39,14 @@
 #include "xAODAnaHelpers/TrackContainer.h"
 #include "xAODAnaHelpers/MuonContainer.h"
 #include "xAODAnaHelpers/TauContainer.h"
+#include "xAODAnaHelpers/AsyncTreeWriter.h"
+#include "xAODAnaHelpers/TriggerBits.h"
 #include "xAODRootAccess/TEvent.h"
 #include "xAODRootAccess/TStore.h"
 
 
 #include <map>
+#include <memory>
 
 // root includes
 #include "TTree.h"
@@ -68,6 +71,11 @@ public:
   virtual ~HelpTreeBase();
 
   void AddEvent       (const std::string detailStr = "");
+  /**
+   *  @brief  Write whether the event is in the nominal tree, where it is found by its runNumber and eventNumber. Used by the
+   *          systematic trees that leave everything they do not vary to nominal; needs `AddEvent()` for the event identifiers.
+   **/
+  void AddNominalLink ();
   void AddTrigger     (const std::string detailStr = "");
   void AddJetTrigger  (const std::string detailStr = "");
   void AddMuons       (const std::string detailStr = "", const std::string muonName = "muon");
@@ -115,6 +123,8 @@ public:
   Trig::TrigDecisionTool*      m_trigDecTool;
 
   void FillEvent( const xAOD::EventInfo* eventInfo, xAOD::TEvent* event = nullptr );
+  /** @brief  Fill the branches of `AddNominalLink()` and the event identifiers, which link the entry to nominal. `inNominal` is false if the event did not make it into the nominal tree. */
+  void FillNominalLink( const xAOD::EventInfo* eventInfo, bool inNominal );
 
   void FillTrigger( const xAOD::EventInfo* eventInfo );
   void FillJetTrigger();
@@ -157,7 +167,17 @@ public:
   void FillTau ( const xAOD::TauJet* tau,           const std::string tauName = "tau" );
   void FillMET( const xAOD::MissingETContainer* met );
 
+  /**
+   *  @brief  Write the current content of the branches out. If a writer was given with `SetWriter()`,
+   *          the fill is only queued and the branches must not be touched again before `WaitForFill()`.
+   */
   void Fill();
+  /** @brief  Return once the last `Fill()` is done, so the branches can be filled with the next event. */
+  void WaitForFill();
+  /** @brief  Hand the calls to `TTree::Fill()` to a background writer instead of doing them right away. Pass a null pointer to go back. */
+  void SetWriter(std::shared_ptr<xAH::AsyncTreeWriter> writer);
+  /** @brief  The output tree the branches are written to */
+  TTree* GetTree() const { return m_tree; }
   void ClearEvent();
   void ClearTrigger();
   void ClearJetTrigger();
@@ -296,6 +316,7 @@ public:
 protected:
 
   TTree* m_tree;
+  std::shared_ptr<xAH::AsyncTreeWriter> m_writer;
 
   int m_units; //For MeV to GeV conversion in output
 
@@ -306,6 +327,9 @@ protected:
   // event
   xAH::EventInfo*      m_eventInfo;
 
+  // link to the nominal tree
+  bool     m_inNominal;
+
   // trigger
   int m_passL1;
   int m_passHLT;
@@ -321,6 +345,7 @@ protected:
   std::vector<float> m_triggerPrescales;
   std::vector<std::string>  m_isPassBitsNames;
   std::vector<unsigned int> m_isPassBits;
+  xAH::TriggerBits          m_triggerBits;
 
   //
   //  Jets
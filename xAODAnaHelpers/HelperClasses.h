@@ -173,8 +173,11 @@ namespace HelperClasses {
         m_menuKeys     menuKeys     exact
         m_passTriggers passTriggers exact
         m_passTrigBits passTrigBits exact
+        m_trigBitset   trigBitset   exact
         ============== ============ =======
 
+        ``trigBitset`` writes the passed chains and their prescales with :cpp:class:`xAH::TriggerBits` instead of as strings.
+
     @endrst
    */
   class TriggerInfoSwitch : public InfoSwitch {
@@ -183,6 +186,7 @@ namespace HelperClasses {
     bool m_menuKeys;
     bool m_passTriggers;
     bool m_passTrigBits;
+    bool m_trigBitset;
     TriggerInfoSwitch(const std::string configStr) : InfoSwitch(configStr) { initialize(); };
   protected:
     void initialize();
@@ -232,6 +236,16 @@ namespace HelperClasses {
 
             will define ``int m_numLeading = 4``.
 
+        .. note::
+            Any float or int aux variable of the objects can be written out as it is by adding ``auxFloat_NAME``, ``auxMeV_NAME`` (a float in MeV, converted to the output unit) or ``auxInt_NAME``, which makes a branch ``<prefix>_NAME``. These are read straight from the aux store for the whole container at once. They work for every collection that is written out in full, including tracks, but not for truth particles, which are filtered while being written.
+
+            For example::
+
+                m_configStr = "... auxFloat_Jvt auxMeV_NegativeE auxInt_ConeTruthLabelID ..."
+
+        .. note::
+            The float branches of a collection can be written with fewer mantissa bits, which makes them compress much better: ``mantissaBitsXX`` or ``mantissaBits=XX`` keeps ``XX`` bits out of 23 (1 to 23, anything else makes the tree setup throw), ``precision16`` is the same as ``mantissaBits10``, the precision of a half float. The values stay floats with their full range, so reading them back needs no change.
+
 
     @endrst
    */
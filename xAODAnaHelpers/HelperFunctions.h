@@ -16,6 +16,7 @@
 #include "xAODJet/JetContainer.h"
 
 #include "xAODTracking/VertexContainer.h"
+#include "xAODEventInfo/EventInfo.h"
 #include "AthContainers/ConstDataVector.h"
 #include "xAODAnaHelpers/HelperClasses.h"
 
@@ -52,6 +53,18 @@ namespace HelperFunctions {
   int getPrimaryVertexLocation(const xAOD::VertexContainer* vertexContainer, MsgStream& msg);
   inline int getPrimaryVertexLocation(const xAOD::VertexContainer* vertexContainer){ return getPrimaryVertexLocation(vertexContainer, msg()); }
   bool applyPrimaryVertexSelection( const xAOD::JetContainer* jets, const xAOD::VertexContainer* vertices );
+
+  /**
+    @rst
+      Decorate ``eventInfo`` with the location of the primary vertex in ``vertexContainer`` (``PVLocation``) and the number of vertices with at least 2 tracks (``NPV``), so that the vertex container is scanned once per event. :cpp:class:`BasicEventSelection` does this for its ``m_vertexContainerName``.
+
+      The overloads below taking ``eventInfo`` read these decorations back, and fall back to scanning ``vertexContainer`` when they are missing or do not point at its primary vertex. They are meant for the container the decorations were made for, usually ``PrimaryVertices``.
+    @endrst
+   */
+  void cachePrimaryVertexInfo(const xAOD::EventInfo* eventInfo, const xAOD::VertexContainer* vertexContainer, MsgStream& msg);
+  int getPrimaryVertexLocation(const xAOD::VertexContainer* vertexContainer, const xAOD::EventInfo* eventInfo, MsgStream& msg);
+  const xAOD::Vertex* getPrimaryVertex(const xAOD::VertexContainer* vertexContainer, const xAOD::EventInfo* eventInfo, MsgStream& msg);
+  int countPrimaryVertices(const xAOD::VertexContainer* vertexContainer, const xAOD::EventInfo* eventInfo, int Ntracks = 2);
   float GetBTagMV2c20_Cut( int efficiency );
   std::string GetBTagMV2c20_CutStr( int efficiency );
   std::string replaceString(std::string subjet, const std::string& search, const std::string& replace);
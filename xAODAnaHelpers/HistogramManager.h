@@ -8,6 +8,8 @@
  */
 
 #include <ctype.h>
+#include <memory>
+#include <vector>
 #include <TH1.h>
 #include <TH1F.h>
 #include <TH2F.h>
@@ -16,6 +18,8 @@
 #include <EventLoop/Worker.h>
 #include <xAODRootAccess/TEvent.h>
 
+#include <xAODAnaHelpers/UniformHist.h>
+
 // for StatusCode::isSuccess
 #include <AsgTools/StatusCode.h>
 #include <AsgTools/MessageCheck.h>
@@ -58,6 +62,13 @@ class HistogramManager {
     std::vector< TH1* > m_allHists; //!
     /** @brief hold the MsgStream object */
     mutable MsgStream m_msg; //!
+    /** @brief sets of histograms booked and filled by this one, see HistogramManager#addNested */
+    std::vector< HistogramManager* > m_nested; //!
+
+    /**
+     * @brief register a set of histograms this one books in initialize() and fills in execute(), so that the fill settings, HistogramManager#flushFills, HistogramManager#closeLazyBooking and HistogramManager#memoryUsage apply to it too
+     */
+    void addNested(HistogramManager* nested) { m_nested.push_back(nested); }
 
   public:
     /**
@@ -93,7 +104,7 @@ class HistogramManager {
 
                 StatusCode JetHists::execute( const xAOD::JetContainer* jets, float eventWeight ){
                   for(const auto& jet: *jets)
-                    m_jetPt->Fill( jet->pt()/1.e3, eventWeight );
+                    fill( m_jetPt, jet->pt()/1.e3, eventWeight );
                   return StatusCode::SUCCESS;
                 }
 
@@ -190,10 +201,79 @@ class HistogramManager {
 		   std::string option = "");
 
     /**
-     * @brief record all histograms from HistogramManager#m_allHists to the worker
+     * @brief record all histograms from HistogramManager#m_allHists to the worker, except the ones still without bins in lazy booking, see HistogramManager#closeLazyBooking
      */
     void record(EL::Worker* wk);
 
+    /**
+        @brief Buffered ``hist->Fill(x, w)``
+        @rst
+            With a fill buffer (:cpp:func:`HistogramManager::setFillBuffer`) the values of each histogram are queued and handed to ``FillN`` in one call once ``size`` of them are there. ``FillN`` still bins them one by one, so this only moves the filling out of the caller's loop. Without one, this is just ``hist->Fill(x, w)``.
+
+            The histogram is found from the unique ID :cpp:func:`HistogramManager::record` gives it (its place in the booking order), so a set that books its histograms with :cpp:func:`HistogramManager::book` should not change their ``TObject::SetUniqueID``; a changed one is still found, by a linear search.
+
+            With :cpp:func:`HistogramManager::setFastFill`, histograms with fixed-width bins are counted in an :cpp:class:`xAH::UniformHist` instead, which finds the bin arithmetically; the buffer is then only used for the others.
+
+            With :cpp:func:`HistogramManager::setLazyBooking`, this is where the bins of a histogram are made.
+
+            The histograms end up with the same content either way, but are only up to date after :cpp:func:`HistogramManager::flushFills`, which the destructor calls.
+
+        @endrst
+     */
+    void fill(TH1* hist, double x, double w = 1.);
+    /**
+     * @overload
+     */
+    void fill(TH2* hist, double x, double y, double w = 1.);
+    /**
+     * @brief queue up to ``size`` values per histogram in HistogramManager#fill, 0 (default) fills them right away. Also applies to the nested sets.
+     */
+    void setFillBuffer(unsigned int size);
+    /**
+     * @brief count the values given to HistogramManager#fill for histograms with fixed-width bins in an xAH::UniformHist, off by default. Also applies to the nested sets.
+     */
+    void setFastFill(bool fast);
+    /**
+     * @brief fill all the queued values into their histograms, also of the nested sets
+     */
+    void flushFills();
+
+    /**
+        @brief Make the bins of a histogram only when it is first filled
+        @rst
+            Frees the bin contents and squared weights of the 1D and 2D histograms of this set, profiles excepted, that are still empty. The storage of each one is made again, empty, the first time :cpp:func:`HistogramManager::fill` is called for it, so histograms a job never fills cost no more than their axes. Histograms that are still without bins when :cpp:func:`HistogramManager::record` is called are only handed to the worker by :cpp:func:`HistogramManager::closeLazyBooking`, and only if they were filled by then. Also applies to the nested sets, so call it before ``record``.
+
+            .. warning:: a histogram without bins must not be filled with ``hist->Fill`` directly. Only switch this on for sets that fill their ``TH1F`` and ``TH2F`` through :cpp:func:`HistogramManager::fill`, as the ones of this package do.
+
+        @endrst
+     */
+    void setLazyBooking(bool lazy);
+    /**
+        @brief End lazy booking for this set and the nested ones
+        @rst
+            Histograms held back by :cpp:func:`HistogramManager::record` are given to the worker if they were filled, and left out of the output otherwise; ``hadd`` merges outputs with different sets of histograms as a union. Histograms recorded before their bins were freed get their booked bins back, empty. Has to be called before the histograms are written, e.g. in ``finalize``; the destructor does it for this set.
+        @endrst
+     */
+    void closeLazyBooking();
+
+    /** @brief memory held by a set of histograms, see HistogramManager#memoryUsage */
+    struct MemoryUsage {
+      /** @brief number of histograms booked */
+      std::size_t histograms = 0;
+      /** @brief of which never filled */
+      std::size_t empty = 0;
+      /** @brief bytes of bin contents, squared weights and profile entries */
+      std::size_t binBytes = 0;
+      /** @brief bytes of the fill buffers and fast counts of HistogramManager#fill */
+      std::size_t fillBytes = 0;
+
+      MemoryUsage& operator+=(const MemoryUsage& other);
+    };
+    /**
+     * @brief memory used by the histograms of this set and of the nested ones. Histograms with queued values only count as filled after HistogramManager#flushFills.
+     */
+    MemoryUsage memoryUsage() const;
+
     /**
       * @brief the standard message stream for this algorithm
       */
@@ -204,6 +284,50 @@ class HistogramManager {
     MsgStream& msg (int level) const;
 
   private:
+    /** @brief fill state of one booked histogram, HistogramManager#m_fillBuffers follows the booking order */
+    struct FillBuffer {
+      TH1* hist;
+      bool is2D = false;
+      /** @brief whether the queue and fast counts are set up for the current HistogramManager#setFillBuffer and HistogramManager#setFastFill */
+      bool ready = false;
+      /** @brief whether HistogramManager#setLazyBooking freed the bins of ``hist`` */
+      bool unallocated = false;
+      /** @brief whether ``hist`` had Sumw2 when its bins were freed */
+      bool sumw2 = false;
+      /** @brief whether HistogramManager#record held ``hist`` back because it had no bins */
+      bool heldBack = false;
+      std::vector<double> x, y, w;
+      /** @brief the counts of ``hist`` with HistogramManager#setFastFill, if it has fixed-width bins */
+      std::unique_ptr< xAH::UniformHist > uniform;
+    };
+    /** @brief queue size of HistogramManager#fill, 0 to fill right away */
+    unsigned int m_fillBufferSize = 0; //!
+    /** @brief whether HistogramManager#fill counts fixed-width histograms in an xAH::UniformHist */
+    bool m_fastFill = false; //!
+    /** @brief one per histogram in HistogramManager#m_allHists, found from the unique ID HistogramManager#record gives the histogram */
+    std::vector< FillBuffer > m_fillBuffers; //!
+    /** @brief the fill state of ``hist``, set up for the current settings; nullptr if this set did not book it */
+    FillBuffer* fillBuffer(TH1* hist, bool is2D);
+    void prepare(FillBuffer& buffer, bool is2D);
+    void flush(FillBuffer& buffer);
+    void flushOwnFills();
+
+    /** @brief whether HistogramManager#fill has to make the bins of a histogram first */
+    bool m_lazyBooking = false; //!
+    /** @brief number of histograms whose bins are freed, HistogramManager#fill looks them up only while there are any */
+    std::size_t m_nUnallocated = 0; //!
+    /** @brief worker of HistogramManager#record, to hand over the histograms it held back */
+    EL::Worker* m_worker = nullptr; //!
+    /** @brief never-filled histograms left out of the output, owned by this set */
+    std::vector< TH1* > m_dropped; //!
+    /** @brief free the bins of the histogram if it is an empty 1D or 2D histogram */
+    void release(FillBuffer& buffer);
+    /** @brief make the bins of the histogram again if they were freed */
+    void allocate(FillBuffer& buffer);
+    void closeOwnLazyBooking();
+    /** @brief bytes held by the bins of ``hist`` */
+    static std::size_t binBytes(const TH1* hist);
+
     /**
      * @brief Turn on Sumw2 for the histogram
      *
@@ -8,8 +8,11 @@
 #include <xAODAnaHelpers/Jet.h>
 #include <xAODAnaHelpers/EventInfo.h>
 #include <xAODBase/IParticleContainer.h>
+#include <AthContainers/AuxTypeRegistry.h>
 #include <AsgTools/MessageCheck.h>
 
+#include <set>
+
 ANA_MSG_HEADER(msgIParticleHists)
 
 class IParticleHists : public HistogramManager
@@ -29,6 +32,14 @@ class IParticleHists : public HistogramManager
 
     //StatusCode execute( const xAH::ParticleContainer* particles, float eventWeight, const xAH::EventInfo* eventInfo = 0 );
     virtual StatusCode execute( const xAH::Particle* particle, float eventWeight, const xAH::EventInfo* eventInfo = 0);
+
+    /**
+        @brief Add the IDs of the aux variables that ``execute`` reads from the xAOD particles to auxids
+        @rst
+            Taken from the accessors of the details that are filled. :cpp:class:`IParticleHistsAlgo` loads these, and only these, before filling the systematics on threads. A class that reads more variables adds its own to those of its base class.
+        @endrst
+     */
+    virtual void auxIDs( std::set< SG::auxid_t >& auxids ) const;
     using HistogramManager::book; // make other overloaded version of book() to show up in subclass
     using HistogramManager::execute; // overload
 
@@ -9,6 +9,8 @@
 #include <xAODAnaHelpers/IParticleHists.h>
 #include <xAODAnaHelpers/HelperFunctions.h>
 #include <xAODAnaHelpers/HelperClasses.h>
+#include <xAODAnaHelpers/TaskPool.h>
+#include <xAODAnaHelpers/SystematicRegistry.h>
 
 class IParticleHistsAlgo : public xAH::Algorithm
 {
@@ -26,9 +28,63 @@ public:
   std::string m_histPrefix;
   /** Histogram xaxis title when using IParticleHistsAlgo directly */
   std::string m_histTitle;
+  /**
+      @rst
+          Number of threads used to fill the histograms of the systematic variations of one event concurrently. Each variation has its own set of histograms, so the output is identical to the serial mode. ``1`` (default) fills them one after the other.
+
+          The systematic containers share the aux store of the input, which loads a variable on first use. Before the threads start, the aux variables the histograms read are loaded for the containers the particles live in and for the event info, and the four-momenta are computed. Which variables those are is taken from the accessors of the histogram class, :cpp:func:`IParticleHists::auxIDs`, when a set is booked; nothing else is read, so ``xAH_run.py --recordAuxReads`` records the same variables as without threads, and a list recorded either way can be used with ``--auxReadList`` in both modes. Histograms that follow links into other containers cannot be filled this way; :cpp:func:`IParticleHistsAlgo::concurrentFillSafe` says which details of ``m_detailStr`` do, and ``initialize`` fails for those.
+      @endrst
+   */
+  int m_nSystThreads = 1;
+  /**
+      @rst
+          Number of values queued per histogram before they are filled in one go, see :cpp:func:`HistogramManager::fill`. ``0`` (default) fills every value right away.
+      @endrst
+   */
+  int m_fillBufferSize = 0;
+  /**
+      @rst
+          Count the histograms with fixed-width bins in a :cpp:class:`xAH::UniformHist` and copy them to the output histograms at the end, see :cpp:func:`HistogramManager::setFastFill`.
+      @endrst
+   */
+  bool m_fastFill = false;
+  /**
+      @rst
+          Only make the bins of a histogram when it is first filled, see :cpp:func:`HistogramManager::setLazyBooking`. Histograms that are never filled are left out of the output.
+      @endrst
+   */
+  bool m_lazyBooking = false;
 
 private:
-  std::map< std::string, IParticleHists* > m_plots; //!
+  /** histogram sets, indexed by xAH::SystematicRegistry ID */
+  std::vector< IParticleHists* > m_plots; //!
+  /** input container name of each systematic, indexed by xAH::SystematicRegistry ID */
+  xAH::SystematicKeys m_inContainerKeys; //!
+
+  /** Store the histogram set of the systematic with the given name under its ID */
+  void setPlots( const std::string& systName, IParticleHists* plots );
+  /** Book the histogram set of the systematic with the given ID if it is not there yet and return it */
+  IParticleHists* getPlots( unsigned int systID );
+  /** Apply the fill options of the algorithm to a newly booked histogram set, before it is recorded; both AddHists call it */
+  void configureHists( IParticleHists* plots ) const;
+
+  /** Threads filling the systematics concurrently when m_nSystThreads > 1 */
+  xAH::TaskPool* m_systTaskPool = nullptr; //!
+
+  /** aux variables read by the booked histogram sets, loaded before the threads fill them */
+  std::set< SG::auxid_t > m_auxIDs; //!
+
+  /** Load the aux variables in m_auxIDs and the cached four-momenta of the particles, see m_nSystThreads */
+  void loadAuxData( const std::vector< const xAOD::IParticleContainer* >& containers, const xAOD::EventInfo* eventInfo ) const;
+
+protected:
+  /**
+      @brief Whether the histograms of m_detailStr read nothing but aux variables of the particles and of the event info
+      @rst
+          Only then can they be filled with ``m_nSystThreads > 1``. True for :cpp:class:`IParticleHists`; algorithms with a histogram class that follows links, for all or some of its details, override it.
+      @endrst
+   */
+  virtual bool concurrentFillSafe() const { return true; }
 
   // variables that don't get filled at submission time should be
   // protected from being send from the submission node to the worker
@@ -67,6 +123,8 @@ public:
   */
   template<class HIST_T, class CONT_T> EL::StatusCode execute ()
   {
+    xAH::ExecuteProfiler profiler(this);
+
     static SG::AuxElement::Accessor< float > mcEvtWeightAcc("mcEventWeight");
 
     const xAOD::EventInfo* eventInfo(nullptr);
@@ -93,7 +151,7 @@ public:
       ANA_CHECK( HelperFunctions::retrieve(inParticles, m_inContainerName, m_event, m_store, msg()) );
 
       // pass the photon collection
-      ANA_CHECK( static_cast<HIST_T*>(m_plots[""])->execute( inParticles, eventWeight, eventInfo ));
+      ANA_CHECK( static_cast<HIST_T*>(m_plots[0])->execute( inParticles, eventWeight, eventInfo ));
     }
     else { // get the list of systematics to run over
 
@@ -101,11 +159,39 @@ public:
       std::vector<std::string>* systNames(nullptr);
       ANA_CHECK( HelperFunctions::retrieve(systNames, m_inputAlgo, 0, m_store, msg()) );
 
-      // loop over systematics
-      for( auto systName : *systNames ) {
-	ANA_CHECK( HelperFunctions::retrieve(inParticles, m_inContainerName+systName, m_event, m_store, msg()) );
-	if( m_plots.find( systName ) == m_plots.end() ) { this->AddHists( systName ); }
-	ANA_CHECK( static_cast<HIST_T*>(m_plots[systName])->execute( inParticles, eventWeight, eventInfo ));
+      xAH::SystematicRegistry& systRegistry = xAH::SystematicRegistry::instance();
+
+      if( m_systTaskPool ) {
+        // TStore access and histogram booking are not thread-safe, only the filling is shared out
+        std::vector< const CONT_T* > systParticles( systNames->size(), nullptr );
+        std::vector< HIST_T* >       systPlots( systNames->size(), nullptr );
+        for( size_t i = 0; i < systNames->size(); ++i ) {
+          unsigned int systID = systRegistry.id( systNames->at(i) );
+          ANA_CHECK( HelperFunctions::retrieve(systParticles[i], m_inContainerKeys.key(systID), m_event, m_store, msg()) );
+          systPlots[i] = static_cast<HIST_T*>( getPlots( systID ) );
+        }
+        // nothing may be loaded from the input while the threads read it
+        loadAuxData( std::vector< const xAOD::IParticleContainer* >( systParticles.begin(), systParticles.end() ), eventInfo );
+
+        std::vector< char > systPassed( systNames->size(), 0 );
+        m_systTaskPool->run( systNames->size(), [&](std::size_t i) {
+          systPassed[i] = systPlots[i]->execute( systParticles[i], eventWeight, eventInfo ).isSuccess();
+        });
+
+        // report in the order of the systematics list, whatever order the threads finished in
+        for( size_t i = 0; i < systNames->size(); ++i ) {
+          if( !systPassed[i] ) {
+            ANA_MSG_ERROR( "Failed to fill histograms for systematic '" << systNames->at(i) << "'" );
+            return EL::StatusCode::FAILURE;
+          }
+        }
+      } else {
+        // loop over systematics
+        for( const auto& systName : *systNames ) {
+          unsigned int systID = systRegistry.id( systName );
+          ANA_CHECK( HelperFunctions::retrieve(inParticles, m_inContainerKeys.key(systID), m_event, m_store, msg()) );
+          ANA_CHECK( static_cast<HIST_T*>( getPlots( systID ) )->execute( inParticles, eventWeight, eventInfo ));
+        }
       }
     }
 
@@ -135,8 +221,9 @@ public:
     HIST_T* particleHists = new HIST_T( fullname, m_detailStr ); // add systematic
     particleHists->m_debug = msgLvl(MSG::DEBUG);
     ANA_CHECK( particleHists->initialize());
+    configureHists( particleHists );
     particleHists->record( wk() );
-    m_plots[name] = particleHists;
+    setPlots( name, particleHists );
 
     return EL::StatusCode::SUCCESS;
   }
@@ -25,6 +25,9 @@ class JetHists : public IParticleHists
     virtual StatusCode execute( const xAH::Jet* jet,  float eventWeight, const xAH::EventInfo* eventInfo = 0);
     virtual StatusCode finalize();
 
+    /** Adds the accessors of the details that can be filled on threads, see JetHistsAlgo::concurrentFillSafe */
+    virtual void auxIDs( std::set< SG::auxid_t >& auxids ) const;
+
     using HistogramManager::book; // make other overloaded version of book() to show up in subclass
     using IParticleHists::execute; // overload
     virtual void record(EL::Worker* wk);
@@ -42,14 +45,15 @@ class JetHists : public IParticleHists
     std::string m_titlePrefix;
     xAH::OnlineBeamSpotTool      m_onlineBSTool;  //!
 
+    // jet variables booked from the table in JetHists.cxx, only those whose detail is on
+    std::vector< TH1F* > m_variableHists;                                    //!
+    std::vector< SG::AuxElement::ConstAccessor<float> > m_variableAccessors; //!
+    std::vector< float xAH::Jet::* > m_variableMembers;                      //!
+    std::vector< TH1F* > m_intVariableHists;                                 //!
+    std::vector< SG::AuxElement::ConstAccessor<int> > m_intVariableAccessors; //!
+    std::vector< int xAH::Jet::* > m_intVariableMembers;                     //!
+
     // clean
-    TH1F* m_jetTime;                //!
-    TH1F* m_LArQuality;             //!
-    TH1F* m_hecq;                   //!
-    TH1F* m_negE;                   //!
-    TH1F* m_avLArQF;                //!
-    TH1F* m_bchCorrCell;            //!
-    TH1F* m_N90Const;               //!
     //TH1F* m_LArQmean;
     //TH1F* m_LArBadHVEFrac;
     //TH1F* m_LArBadHVNCell;
@@ -65,31 +69,8 @@ class JetHists : public IParticleHists
     //TH1F* m_clean_passTightBadUgly;
 
 
-    //layer
-    TH1F* m_PreSamplerB;
-    TH1F* m_EMB1;
-    TH1F* m_EMB2;
-    TH1F* m_EMB3;
-    TH1F* m_PreSamplerE;            //!
-    TH1F* m_EME1;                   //!
-    TH1F* m_EME2;                   //!
-    TH1F* m_EME3;                   //!
-    TH1F* m_HEC0;                   //!
-    TH1F* m_HEC1;                   //!
-    TH1F* m_HEC2;                   //!
-    TH1F* m_HEC3;                   //!
-    TH1F* m_TileBar0;               //!
-    TH1F* m_TileBar1;               //!
-    TH1F* m_TileBar2;               //!
-    TH1F* m_TileGap1;               //!
-    TH1F* m_TileGap2;               //!
-    TH1F* m_TileGap3;               //!
-    TH1F* m_TileExt0;               //!
-    TH1F* m_TileExt1;               //!
-    TH1F* m_TileExt2;               //!
-    TH1F* m_FCAL0;                  //!
-    TH1F* m_FCAL1;                  //!
-    TH1F* m_FCAL2;                  //!
+    //layer, indexed by sampling
+    std::vector< TH1F* > m_layerHists; //!
 
     // area
     TH1F* m_actArea;                //!
@@ -98,9 +79,6 @@ class JetHists : public IParticleHists
     TH1F* m_chf;                    //!
 
     //energy
-    TH1F* m_HECf;                   //!
-    TH1F* m_EMf;                    //!
-    TH1F* m_centroidR;              //!
     TH1F* m_fracSampMax;            //!
     TH1F* m_fracSampMaxIdx;         //!
     TH1F* m_lowEtFrac;              //!
@@ -115,38 +93,14 @@ class JetHists : public IParticleHists
 
     // truth jets
     TH1F* m_truthLabelID;          //!
-    TH1F* m_hadronConeExclTruthLabelID;          //!
     TH1F* m_partonTruthLabelID;          //!
-    TH1F* m_truthCount;            //!
     TH1F* m_truthPt;               //!
     TH1F* m_truthPt_m;               //!
     TH1F* m_truthPt_l;               //!
     TH1F* m_truthEta;               //!
     TH1F* m_truthPhi;               //!
-    TH1F* m_truthDr_B;             //!
-    TH1F* m_truthDr_C;             //!
-    TH1F* m_truthDr_T;             //!
     //TH1F *m_GhostTruthAssociationFraction;
 
-    // Detailed truth jet plots
-    TH1F* m_truthCount_BhadFinal;  //!
-    TH1F* m_truthCount_BhadInit ;  //!
-    TH1F* m_truthCount_BQFinal  ;  //!
-    TH1F* m_truthPt_BhadFinal;  //!
-    TH1F* m_truthPt_BhadInit ;  //!
-    TH1F* m_truthPt_BQFinal  ;  //!
-
-    TH1F* m_truthCount_ChadFinal;  //!
-    TH1F* m_truthCount_ChadInit ;  //!
-    TH1F* m_truthCount_CQFinal  ;  //!
-    TH1F* m_truthPt_ChadFinal;  //!
-    TH1F* m_truthPt_ChadInit ;  //!
-    TH1F* m_truthPt_CQFinal  ;  //!
-
-
-    TH1F* m_truthCount_TausFinal; //!
-    TH1F* m_truthPt_TausFinal   ; //!
-
     // JVC
     TH1F* m_JVC; //!
 
@@ -269,14 +223,8 @@ class JetHists : public IParticleHists
     TH1F* m_IP3D_cu                  ; //!
 
     // substructure
-    TH1F* m_tau1; //!
-    TH1F* m_tau2; //!
-    TH1F* m_tau3; //!
     TH1F* m_tau21; //!
     TH1F* m_tau32; //!
-    TH1F* m_tau1_wta; //!
-    TH1F* m_tau2_wta; //!
-    TH1F* m_tau3_wta; //!
     TH1F* m_tau21_wta; //!
     TH1F* m_tau32_wta; //!
     TH1F* m_numConstituents; //!
@@ -29,6 +29,12 @@ public:
   // these are the functions not inherited from Algorithm
   EL::StatusCode AddHists( std::string name );
 
+protected:
+  /** False for the details that read b-tagging objects, matched tracks or vertices */
+  virtual bool concurrentFillSafe() const;
+
+public:
+
   /// @cond
   // this is needed to distribute the algorithm to the workers
   ClassDef(JetHistsAlgo, 1);
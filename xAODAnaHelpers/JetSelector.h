@@ -22,6 +22,9 @@
 
 // algorithm wrapper
 #include "xAODAnaHelpers/Algorithm.h"
+#include "xAODAnaHelpers/SystematicRegistry.h"
+#include "xAODAnaHelpers/KinematicPreFilter.h"
+#include "xAODAnaHelpers/CutflowCounter.h"
 
 // external tools include(s):
 #include "AsgTools/AnaToolHandle.h"
@@ -59,6 +62,13 @@ public:
   bool m_createSelectedContainer = false;
   /// @brief look at n objects
   int m_nToProcess = -1;
+  /**
+      @rst
+          Apply the :math:`p_T` and :math:`\eta` cuts to the whole container in one vectorized pass and run :cpp:func:`JetSelector::PassCuts` only on the jets passing them. Selection results and the cutflow are unchanged.
+
+      @endrst
+   */
+  bool m_doKinematicPreFilter = false;
   /// @brief require cleanJet decoration to not be set and false
   bool m_cleanJets = true;
   /// @brief kill event if any of the N leading jets are not clean
@@ -242,9 +252,16 @@ private:
   std::vector<std::string> m_passKeys;  //!
   std::vector<std::string> m_failKeys;  //!
 
+  /// @brief input/output container name of each systematic, indexed by xAH::SystematicRegistry ID
+  xAH::SystematicKeys m_inContainerKeys;  //!
+  xAH::SystematicKeys m_outContainerKeys; //!
+
+  xAH::KinematicPreFilter m_kinematicPreFilter; //!
+
   /* object-level cutflow */
 
   TH1D* m_jet_cutflowHist_1 = nullptr;  //!
+  xAH::CutflowCounter m_jet_cutflowCounter_1; //!
 
   int   m_jet_cutflow_all;           //!
   int   m_jet_cutflow_cleaning_cut;  //!
@@ -0,0 +1,80 @@
+#ifndef xAODAnaHelpers_KinematicPreFilter_H
+#define xAODAnaHelpers_KinematicPreFilter_H
+
+#include <cmath>
+#include <cstddef>
+#include <vector>
+
+namespace xAH {
+
+  /**
+      @rst
+          Applies the cheap kinematic cuts of an object selector (:math:`p_T` max, :math:`p_T` min, :math:`|\eta|` window) to a whole container at once, so the expensive per-object selection only has to run on the objects that survive.
+
+          :cpp:func:`~xAH::KinematicPreFilter::apply` first copies :math:`p_T` and :math:`|\eta|` of every object into contiguous arrays and then evaluates all cuts in a single branch-free loop over those arrays, which the compiler can vectorize. Cut values follow the selectors' convention that ``1e8`` means the cut is not applied, and an object passes a cut exactly when the selector's own ``passCuts`` would let it through.
+
+          For every object the filter records how many of the cuts it passed, in the order :math:`p_T` max, :math:`p_T` min, :math:`|\eta|`, so selectors that apply these cuts first can still fill their cutflow exactly.
+
+      @endrst
+   */
+  class KinematicPreFilter
+  {
+
+  public:
+
+    /// @brief Number of cuts; an object that passes all of them has reached this stage
+    static const unsigned int nStages = 3;
+
+    /** @brief Set the cut values. A value of ``1e8`` switches the corresponding cut off. */
+    void setCuts(float pT_min, float pT_max, float eta_max, float eta_min = 1e8);
+
+    /** @brief Whether any cut is switched on, if not there is nothing to gain from calling apply() */
+    bool active() const { return m_active; }
+
+    /**
+        @brief Evaluate the cuts for every object of ``container``
+        @param etaFunc  callable returning the :math:`\eta` the selector cuts on for an object, e.g. the cluster :math:`\eta` for electrons
+     */
+    template<typename CONT_T, typename ETA_T>
+    void apply(const CONT_T& container, ETA_T etaFunc)
+    {
+      const std::size_t n = container.size();
+      m_pt.resize(n);
+      m_absEta.resize(n);
+      m_stage.resize(n);
+
+      std::size_t i(0);
+      for(const auto obj : container){
+        m_pt[i]     = obj->pt();
+        m_absEta[i] = std::fabs(etaFunc(obj));
+        ++i;
+      }
+
+      evaluate();
+    }
+
+    /** @brief Number of cuts passed by the ``i``-th object of the last container given to apply() */
+    unsigned int stage(std::size_t i) const { return m_stage[i]; }
+
+    /** @brief Whether the ``i``-th object of the last container given to apply() passed all cuts */
+    bool passed(std::size_t i) const { return m_stage[i] == nStages; }
+
+  private:
+
+    void evaluate();
+
+    bool  m_active = false;
+    float m_pT_min = 0;
+    float m_pT_max = 0;
+    float m_eta_min = 0;
+    float m_eta_max = 0;
+
+    std::vector<float>         m_pt;
+    std::vector<float>         m_absEta;
+    std::vector<unsigned char> m_stage;
+
+  };
+
+}
+
+#endif
@@ -0,0 +1,83 @@
+#ifndef xAODAnaHelpers_LazyBranches_H
+#define xAODAnaHelpers_LazyBranches_H
+
+#include <string>
+#include <typeinfo>
+#include <unordered_map>
+#include <vector>
+
+#include <TTree.h>
+#include <TBranch.h>
+
+namespace xAH {
+
+  /**
+      @rst
+          The branches a :cpp:class:`~xAH::ParticleContainer` reads in reader mode, by the variable they are read into.
+
+          In lazy mode the branches are switched off with ``SetBranchStatus`` as soon as they are connected, so ``TTree::GetEntry`` skips them, and each one is only read, for the entry the tree is at, the first time one of its values is asked for. Branches nobody looks at are never read.
+
+          Without lazy mode the table is only used to look the columns up by name.
+
+      @endrst
+   */
+  class LazyBranches
+  {
+
+  public:
+
+    void setLazy(bool lazy) { m_lazy = lazy; }
+    bool lazy() const { return m_lazy; }
+
+    /** @brief Register the branch connected to ``variable``, a ``std::vector<T>**``. Called right after ``SetBranchAddress``. */
+    void connect(TTree* tree, const std::string& branch, const std::string& varName, void* variable, const std::type_info& type);
+
+    /** @brief Make sure the column read into ``variable`` holds the current entry */
+    void load(const void* variable)
+    {
+      if(!m_lazy) return;
+      auto found = m_byVariable.find(variable);
+      if(found != m_byVariable.end()) load(m_columns[found->second]);
+    }
+
+    /** @brief Read every connected branch that does not hold the current entry yet */
+    void loadAll();
+
+    /** @brief The column of ``varName``, loaded for the current entry, or a null pointer if it was not connected with type ``std::vector<T>`` */
+    template<typename T>
+    const std::vector<T>* find(const std::string& varName)
+    {
+      auto found = m_byName.find(varName);
+      if(found == m_byName.end()) return nullptr;
+      Column& column = m_columns[found->second];
+      if(*column.type != typeid(std::vector<T>)) return nullptr;
+      if(m_lazy) load(column);
+      return *static_cast<std::vector<T>**>(column.variable);
+    }
+
+  private:
+
+    struct Column {
+      std::string branchName;
+      void* variable;
+      const std::type_info* type;
+      // where the branch is read from, redone whenever a chain moves to the next tree
+      TBranch* branch = nullptr;
+      int treeNumber = -1;
+      Long64_t loadedEntry = -1;
+    };
+
+    void load(Column& column);
+
+    bool   m_lazy = false;
+    TTree* m_tree = nullptr;
+
+    std::vector<Column> m_columns;
+    std::unordered_map<std::string, std::size_t> m_byName;
+    std::unordered_map<const void*, std::size_t> m_byVariable;
+
+  };
+
+}
+
+#endif
@@ -21,6 +21,7 @@
 
 // algorithm wrapper
 #include "xAODAnaHelpers/Algorithm.h"
+#include "xAODAnaHelpers/SystematicRegistry.h"
 
 namespace CP {
   class MuonEfficiencyScaleFactors;
@@ -88,6 +89,9 @@ public:
 
 private:
 
+  /// @brief input container name of each systematic, indexed by xAH::SystematicRegistry ID
+  xAH::SystematicKeys m_inContainerKeys;  //!
+
   xAOD::TEvent *m_event;  //!
   xAOD::TStore *m_store;  //!
 
@@ -19,6 +19,10 @@ class MuonHists : public IParticleHists
     virtual StatusCode initialize();
     virtual StatusCode execute( const xAOD::Muon* muon, float eventWeight, const xAOD::EventInfo* eventInfo = 0);
     virtual StatusCode execute( const xAH::Muon*  muon, float eventWeight, const xAH::EventInfo*  eventInfo = 0);
+
+    /** Adds the accessors of the isolation and quality details */
+    virtual void auxIDs( std::set< SG::auxid_t >& auxids ) const;
+
     using HistogramManager::book; // make other overloaded version of book() to show up in subclass
     using IParticleHists::execute; // overload
 
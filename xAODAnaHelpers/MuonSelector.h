@@ -24,6 +24,9 @@
 
 // algorithm wrapper
 #include "xAODAnaHelpers/Algorithm.h"
+#include "xAODAnaHelpers/SystematicRegistry.h"
+#include "xAODAnaHelpers/KinematicPreFilter.h"
+#include "xAODAnaHelpers/CutflowCounter.h"
 
 // forward-declare for now until IsolationSelectionTool interface is updated
 namespace CP {
@@ -55,6 +58,15 @@ public:
   bool       	 m_createSelectedContainer = false;
   /** look at n objects */
   int            m_nToProcess = -1;
+  /**
+      @rst
+          Apply the :math:`p_T` cuts to the whole container in one vectorized pass and run :cpp:func:`MuonSelector::passCuts`, and with it the ``MuonSelectionTool``, only on the muons passing them.
+
+          Muons rejected this way only enter the ``all`` bin of the object cutflow, and do not get the decorations :cpp:func:`MuonSelector::passCuts` adds (quality flags, ``d0sig``, isolation decisions, ...).
+
+      @endrst
+   */
+  bool           m_doKinematicPreFilter = false;
   /** minimum number of objects passing cuts */
   int            m_pass_min = -1;
   /** maximum number of objects passing cuts */
@@ -108,6 +120,10 @@ public:
 
 private:
 
+  /// @brief input/output container name of each systematic, indexed by xAH::SystematicRegistry ID
+  xAH::SystematicKeys m_inContainerKeys;  //!
+  xAH::SystematicKeys m_outContainerKeys; //!
+
   int            m_muonQuality; //!
 
   int m_numEvent;           //!
@@ -123,9 +139,13 @@ private:
 
   bool  m_isUsedBefore;     //!
 
+  xAH::KinematicPreFilter m_kinematicPreFilter; //!
+
   // object cutflow
   TH1D* m_mu_cutflowHist_1 = nullptr;                 //!
+  xAH::CutflowCounter m_mu_cutflowCounter_1; //!
   TH1D* m_mu_cutflowHist_2 = nullptr;                 //!
+  xAH::CutflowCounter m_mu_cutflowCounter_2; //!
 
   int   m_mu_cutflow_all;		    //!
   int   m_mu_cutflow_eta_and_quaility_cut;  //!
@@ -16,6 +16,10 @@
 #include "xAODJet/JetContainer.h"
 #include "xAODEgamma/PhotonContainer.h"
 #include "xAODTau/TauJetContainer.h"
+#include "AthContainers/ConstDataVector.h"
+#include "AthLinks/ElementLink.h"
+
+#include <unordered_map>
 
 // external tools include(s):
 #include "AssociationUtils/OverlapRemovalInit.h"
@@ -25,6 +29,9 @@
 
 // algorithm wrapper
 #include "xAODAnaHelpers/Algorithm.h"
+#include "xAODAnaHelpers/SystematicRegistry.h"
+#include "xAODAnaHelpers/CutflowCounter.h"
+#include "xAODAnaHelpers/EtaPhiGrid.h"
 
 // ROOT include(s):
 #include "TH1D.h"
@@ -110,6 +117,26 @@ class OverlapRemover : public xAH::Algorithm
   bool m_useBoostedLeptons = false;
   /** @brief Do overlap removal between electrons (HSG2 prescription) */
   bool m_doEleEleOR = false;
+  /**
+     @rst
+        Before calling the OLR tool, look up every object's neighbours in an :cpp:class:`xAH::EtaPhiGrid` and only give the tool the objects that have another object they could overlap with within :cpp:member:`~OverlapRemover::m_spatialIndexMaxDeltaR`. The others are decorated as passing the OLR straight away.
+
+        The result is the same as without the index, as long as :cpp:member:`~OverlapRemover::m_spatialIndexMaxDeltaR` is not smaller than the largest cone used by the tool.
+     @endrst
+  */
+  bool m_useSpatialIndex = false;
+  /** @brief Largest :math:`\Delta R` (using rapidity) at which the OLR tool can find an overlap, see :cpp:member:`~OverlapRemover::m_useSpatialIndex` */
+  float m_spatialIndexMaxDeltaR = 0.4;
+  /**
+     @rst
+        When running the OLR for a systematic variation, reuse the nominal decision of every group of nearby objects (see :cpp:member:`~OverlapRemover::m_useSpatialIndex`, which this switches on) in which no object differs from the nominal one. Only the groups touched by the variation go through the OLR tool again.
+
+        Objects are matched to their nominal counterpart through their original object, and count as changed if their :math:`p_T`, rapidity, :math:`\phi` or b-tagging decision differ, or if they are not in the nominal input at all. Neighbours of nominal objects missing from the varied input are redone too.
+
+        The ``overlapObject`` link of a reused decision points to the partner's counterpart in the varied containers, found through the same original object.
+     @endrst
+  */
+  bool m_reuseNominalOR = false;
 
   /** @brief Output systematics list container name */
   std::string  m_outputAlgoSystNames = "ORAlgo_Syst";
@@ -204,6 +231,49 @@ class OverlapRemover : public xAH::Algorithm
   /** @brief Pointer to the CP Tool which performs the actual OLR. */
   ORUtils::ToolBox m_ORToolbox;        //!
 
+  /** @brief Spatial index of the OLR input objects, see :cpp:member:`~m_useSpatialIndex` */
+  xAH::EtaPhiGrid m_ORGrid;            //!
+  /** @brief What happens to the objects in m_ORGrid */
+  enum ORAction {
+    OR_PASS  = 0, ///< no possible overlap partner, passes
+    OR_RUN   = 1, ///< given to the OLR tool
+    OR_REUSE = 2  ///< takes the nominal decision
+  };
+  /** @brief The objects in m_ORGrid, in the order they were added */
+  std::vector<const xAOD::IParticle*> m_ORGridObjects; //!
+  /** @brief For every object in m_ORGrid, one of ORAction */
+  std::vector<char> m_ORAction;  //!
+  /** @brief Union-find forest of the groups of objects connected by possible overlaps, indexed like m_ORGrid */
+  std::vector<std::size_t> m_ORGroup; //!
+  /** @brief For the root of every group in m_ORGroup, whether it contains an object that differs from nominal */
+  std::vector<char> m_ORGroupChanged; //!
+
+  /** @brief OLR input of an object in the nominal run and its decision, see :cpp:member:`~m_reuseNominalOR` */
+  struct NominalORResult {
+    float rapidity;
+    float phi;
+    float pt;
+    int   type;
+    char  bTagged;
+    char  passOR;
+    const xAOD::IParticle* overlapPartner; ///< original object of the ``overlapObject`` partner, if any
+    unsigned long matched; ///< last systematic run in which a matching object was found
+  };
+  /** @brief Nominal OLR results of this event, keyed by original object */
+  std::unordered_map<const xAOD::IParticle*, NominalORResult> m_ORNominalResults; //!
+  /** @brief The objects of the current systematic run, keyed by original object, to relink the partners of reused decisions */
+  std::unordered_map<const xAOD::IParticle*, const xAOD::IParticle*> m_ORSystObjects; //!
+  /** @brief Whether m_ORNominalResults belong to this event */
+  bool m_ORNominalResultsValid = false; //!
+  /** @brief Counter of the systematic runs, to tell which nominal results were matched in the current one */
+  unsigned long m_ORRunCount = 0; //!
+  /** @brief The objects given to the OLR tool when using m_ORGrid */
+  ConstDataVector<xAOD::ElectronContainer> m_ORElectrons; //!
+  ConstDataVector<xAOD::MuonContainer>     m_ORMuons;     //!
+  ConstDataVector<xAOD::JetContainer>      m_ORJets;      //!
+  ConstDataVector<xAOD::TauJetContainer>   m_ORTaus;      //!
+  ConstDataVector<xAOD::PhotonContainer>   m_ORPhotons;   //!
+
   /** @brief An enum encoding systematics according to the various objects */
   enum SystType {
     NOMINAL = 0,
@@ -227,6 +297,13 @@ class OverlapRemover : public xAH::Algorithm
   /**  @brief Pointer to the histogram for the tau cutflow */
   TH1D* m_tau_cutflowHist_1 = nullptr;   //!
 
+  /**  @brief Counts of objects removed by the overlap removal, added to the object cutflows in finalize() */
+  xAH::CutflowCounter m_el_cutflowCounter_1;  //!
+  xAH::CutflowCounter m_mu_cutflowCounter_1;  //!
+  xAH::CutflowCounter m_jet_cutflowCounter_1; //!
+  xAH::CutflowCounter m_ph_cutflowCounter_1;  //!
+  xAH::CutflowCounter m_tau_cutflowCounter_1; //!
+
   int m_el_cutflow_OR_cut;     //!
   int m_mu_cutflow_OR_cut;     //!
   int m_jet_cutflow_OR_cut;    //!
@@ -282,11 +359,59 @@ public:
 				    SystType syst_type = NOMINAL,
 				    std::vector<std::string>* sysVec = nullptr);
 
+  /**
+     @brief Call the OLR tool for the input containers, through the spatial index if :cpp:member:`~m_useSpatialIndex` is set
+  */
+  EL::StatusCode removeOverlaps( const xAOD::ElectronContainer* inElectrons,
+                                 const xAOD::MuonContainer* inMuons,
+                                 const xAOD::JetContainer* inJets,
+                                 const xAOD::TauJetContainer* inTaus,
+                                 const xAOD::PhotonContainer* inPhotons,
+                                 SystType syst_type = NOMINAL);
+
   /** @brief Setup cutflow histograms */
   EL::StatusCode setCutFlowHist();
   /** @brief Initialise counters for events/objects */
   EL::StatusCode setCounters();
 
+private:
+
+  /// @brief input/output container names of each systematic, indexed by xAH::SystematicRegistry ID
+  xAH::SystematicKeys m_inContainerKeys_Electrons;  //!
+  xAH::SystematicKeys m_inContainerKeys_Muons;  //!
+  xAH::SystematicKeys m_inContainerKeys_Jets;  //!
+  xAH::SystematicKeys m_inContainerKeys_Photons;  //!
+  xAH::SystematicKeys m_inContainerKeys_Taus;  //!
+  xAH::SystematicKeys m_outContainerKeys_Electrons; //!
+  xAH::SystematicKeys m_outContainerKeys_Muons; //!
+  xAH::SystematicKeys m_outContainerKeys_Jets; //!
+  xAH::SystematicKeys m_outContainerKeys_Photons; //!
+  xAH::SystematicKeys m_outContainerKeys_Taus; //!
+
+  /** @brief Whether the OLR tool considers ``obj`` at all (see :cpp:member:`~m_useSelected`) */
+  bool isORInput(const xAOD::IParticle* obj) const;
+
+  /** @brief Whether the OLR tool can find an overlap between objects of these two types */
+  bool canOverlap(int type1, int type2) const;
+
+  /** @brief Add the OLR input objects of ``inCont`` to m_ORGrid */
+  void fillORGrid(const xAOD::IParticleContainer* inCont);
+
+  /** @brief Root of the group of object ``index`` in m_ORGroup */
+  std::size_t findORGroup(std::size_t index);
+
+  /** @brief Whether the b-tagging decision the OLR tool uses is set for ``obj`` */
+  char isORBTagged(const xAOD::IParticle* obj) const;
+
+  /** @brief Link to the object of the current systematic run with the original ``nominalPartner``, empty if there is none */
+  ElementLink<xAOD::IParticleContainer> systOverlapLink(const xAOD::IParticle* nominalPartner) const;
+
+  /** @brief Fill ``view`` with the objects of ``inCont`` the OLR tool has to look at and decorate the others according to m_ORAction */
+  template<typename CONT_T>
+  void selectORCandidates(const CONT_T* inCont, ConstDataVector<CONT_T>& view, std::size_t& gridIndex);
+
+public:
+
   /// @cond
   // this is needed to distribute the algorithm to the workers
   ClassDef(OverlapRemover, 1);
@@ -4,11 +4,17 @@
 #include <TTree.h>
 #include <TLorentzVector.h>
 
+#include <stdexcept>
+#include <typeinfo>
 #include <vector>
 #include <string>
 
 #include <xAODAnaHelpers/HelperClasses.h>
 #include <xAODAnaHelpers/HelperFunctions.h>
+#include <xAODAnaHelpers/ColumnBuffers.h>
+#include <xAODAnaHelpers/AuxColumnTable.h>
+#include <xAODAnaHelpers/AuxColumnExport.h>
+#include <xAODAnaHelpers/LazyBranches.h>
 
 #include <xAODAnaHelpers/Particle.h>
 #include <xAODBase/IParticle.h>
@@ -43,6 +49,27 @@ namespace xAH {
         m_phi =new std::vector<float>();
         m_E   =new std::vector<float>();
         m_M   =new std::vector<float>();
+
+        // aux variables exported for the whole container at once
+        for(const auto& var : m_infoSwitch.get_working_points("auxFloat_"))
+          m_auxExport.add(var, branchName(var), AuxColumnExport::FLOAT);
+        for(const auto& var : m_infoSwitch.get_working_points("auxMeV_"))
+          m_auxExport.add(var, branchName(var), AuxColumnExport::FLOAT, m_units);
+        for(const auto& var : m_infoSwitch.get_working_points("auxInt_"))
+          m_auxExport.add(var, branchName(var), AuxColumnExport::INT);
+
+        // reduced precision of the float branches
+        if(m_infoSwitch.has_exact("precision16")) m_mantissaBits = 10;
+        for(const auto& point : m_infoSwitch.get_working_points("mantissaBits")){
+          // mantissaBitsXX or mantissaBits=XX
+          const std::string bits = (!point.empty() && point[0] == '=') ? point.substr(1) : point;
+          std::size_t used(0);
+          int value(-1);
+          try { value = std::stoi(bits, &used); } catch(const std::exception&) {}
+          if(used != bits.size() || value < 1 || value > 23)
+            throw std::invalid_argument("mantissaBits" + point + " in the details of " + m_name + ": the number of mantissa bits must be an integer from 1 to 23");
+          m_mantissaBits = value;
+        }
       }
 
       virtual ~ParticleContainer()
@@ -98,12 +125,18 @@ namespace xAH {
 	  setBranch<float>(tree,"phi",                      m_phi              );
 	  setBranch<float>(tree,"eta",                      m_eta              );
 	}
+
+	m_auxExport.setBranches(tree);
       }
 
       virtual void clear()
       {
 	m_n = 0;
 
+	// the containers of the next event are different ones
+	m_auxColumns.reset();
+	m_auxExport.clear();
+
         if(m_infoSwitch.m_kinematic) {
 	  if(m_useMass)  m_M->clear();
 	  else           m_E->clear();
@@ -124,10 +157,48 @@ namespace xAH {
 	  if(m_useMass) m_M->push_back  ( particle->m() / m_units );
 	  else          m_E->push_back  ( particle->e() / m_units );
 	}
+
+	m_auxColumns.fill( *particle );
+      }
+
+      /**
+       * @brief Round the float branches to the precision asked for with ``precision16`` or ``mantissaBitsN``. Called
+       *        once per entry, right before the tree is filled.
+       */
+      void reducePrecision()
+      {
+        if(m_mantissaBits >= 23) return;
+        for(auto column : m_floatColumns)       roundColumn(*column, m_mantissaBits);
+        for(auto column : m_nestedFloatColumns) roundColumn(*column, m_mantissaBits);
       }
 
+      /**
+       * @brief Write the aux variables declared with ``auxFloat_``, ``auxMeV_`` or ``auxInt_`` for every object of
+       *        the container in one go. Has to be given the same objects, in the same order, as the per-object fills.
+       */
+      template<class T_CONT>
+      void FillAuxColumns(const T_CONT* container)
+      {
+        m_auxExport.fill(*container);
+      }
+
+      /**
+       * @brief Read the branches lazily: they are switched off and only read, for the current entry, when one of their
+       *        values is used. The objects are only built by ``at()``, one at a time, and ``view()`` reads single columns
+       *        without building them at all. Has to be called before ``setTree()``.
+       */
+      void setLazy(bool lazy)
+      { m_lazyBranches.setLazy(lazy); }
+
       void updateEntry()
       {
+        if(m_lazyBranches.lazy()){
+          // built on demand by at(), reusing the objects of the previous entries
+          if(m_particles.size() < static_cast<std::size_t>(m_n)) m_particles.resize(m_n);
+          m_built.assign(m_n, false);
+          return;
+        }
+
         m_particles.clear();
 
         for(int i=0;i<m_n;i++)
@@ -139,16 +210,71 @@ namespace xAH {
       }
 
       T_PARTICLE& at_nonConst(uint idx)
-	{ return m_particles[idx]; }
+      {
+        if(m_lazyBranches.lazy() && !m_built[idx]){
+          m_lazyBranches.loadAll();
+          m_particles[idx] = T_PARTICLE();
+          updateParticle(idx, m_particles[idx]);
+          m_built[idx] = true;
+        }
+        return m_particles[idx];
+      }
 
       const T_PARTICLE& at(uint idx) const
-      { return m_particles[idx]; }
+      { return const_cast<ParticleContainer*>(this)->at_nonConst(idx); }
 
       const T_PARTICLE& operator[](uint idx) const
-      { return m_particles[idx]; }
+      { return at(idx); }
 
       uint size() const
-      { return m_particles.size(); }
+      { return m_lazyBranches.lazy() ? m_n : m_particles.size(); }
+
+      /**
+       * @brief A single object of the current entry, read straight from the columns. Only the columns of the values
+       *        that are asked for are read, which in lazy mode makes it much cheaper than ``at()``.
+       */
+      class View
+      {
+      public:
+        View(ParticleContainer* container, uint idx) : m_container(container), m_idx(idx) {}
+
+        float pt()  const { return value(m_container->m_pt);  }
+        float eta() const { return value(m_container->m_eta); }
+        float phi() const { return value(m_container->m_phi); }
+        float E()   const { return m_container->m_useMass ? p4().E() : value(m_container->m_E); }
+        float m()   const { return m_container->m_useMass ? value(m_container->m_M) : p4().M(); }
+
+        TLorentzVector p4() const
+        {
+          TLorentzVector vec;
+          if(m_container->m_useMass) vec.SetPtEtaPhiM(pt(), eta(), phi(), value(m_container->m_M));
+          else                       vec.SetPtEtaPhiE(pt(), eta(), phi(), value(m_container->m_E));
+          return vec;
+        }
+
+        /** @brief Any other column read by the container, by the name it was connected with (e.g. ``"Timing"``) */
+        template<typename T>
+        T get(const std::string& varName) const
+        {
+          const std::vector<T>* column = m_container->m_lazyBranches.template find<T>(varName);
+          if(!column) throw std::invalid_argument("no column " + varName + " of the requested type in " + m_container->m_name);
+          return column->at(m_idx);
+        }
+
+      private:
+        template<typename T>
+        T value(std::vector<T>* const& column) const
+        {
+          m_container->m_lazyBranches.load(&column);
+          return column->at(m_idx);
+        }
+
+        ParticleContainer* m_container;
+        uint m_idx;
+      };
+
+      View view(uint idx)
+      { return View(this, idx); }
 
 
     protected:
@@ -164,13 +290,20 @@ namespace xAH {
 	std::string name = branchName(branch);
         tree->SetBranchStatus  (name.c_str()  , 1);
         tree->SetBranchAddress (name.c_str()  , variable);
+        m_lazyBranches.connect (tree, name, branch, variable, typeid(std::vector<T_BR>));
       }
 
       template<typename T> void setBranch(TTree* tree, std::string varName, std::vector<T>* localVectorPtr){
 	std::string name = branchName(varName);
 	tree->Branch(name.c_str(),        localVectorPtr);
+	addFloatColumn(localVectorPtr);
       }
 
+      // the float branches, to be rounded by reducePrecision
+      template<typename T> void addFloatColumn(std::vector<T>*) {}
+      void addFloatColumn(std::vector<float>* column)                 { m_floatColumns.push_back(column); }
+      void addFloatColumn(std::vector<std::vector<float> >* column)   { m_nestedFloatColumns.push_back(column); }
+
       template<typename T, typename U, typename V> void safeFill(const V* xAODObj, SG::AuxElement::ConstAccessor<T>& accessor, std::vector<U>* destination, U defaultValue, int units = 1){
 	if ( accessor.isAvailable( *xAODObj ) ) {
 	  destination->push_back( accessor( *xAODObj ) / units );
@@ -181,10 +314,10 @@ namespace xAH {
 
 
       template<typename T, typename U, typename V> void safeVecFill(const V* xAODObj, SG::AuxElement::ConstAccessor<std::vector<T> >& accessor, std::vector<std::vector<U> >* destination, int units = 1){
-	destination->push_back( std::vector<U>() );
+	std::vector<U>& row = newRow( destination );
 
 	if ( accessor.isAvailable( *xAODObj ) ) {
-	  for(U itemInVec : accessor(*xAODObj))        destination->back().push_back(itemInVec / units);
+	  for(U itemInVec : accessor(*xAODObj))        row.push_back(itemInVec / units);
 	}
 	return;
       }
@@ -192,12 +325,12 @@ namespace xAH {
       template<typename T, typename V> void safeSFVecFill(const V* xAODObj, SG::AuxElement::ConstAccessor<std::vector<T> >& accessor, std::vector<std::vector<T> >* destination, const std::vector<T> &defaultValue) {
         if ( accessor.isAvailable( *xAODObj ) ) {
           if ( m_storeSystSFs ) {
-            destination->push_back( accessor(*xAODObj) );
+            pushRow( destination, accessor(*xAODObj) );
           } else {
-            destination->push_back( std::vector< float > ({accessor(*xAODObj)[0]}) );
+            newRow( destination ).push_back( accessor(*xAODObj)[0] );
           }
         } else {
-          destination->push_back( defaultValue );
+          pushRow( destination, defaultValue );
         }
       }
 
@@ -224,6 +357,21 @@ namespace xAH {
 
       std::vector<T_PARTICLE> m_particles;
 
+      // branches read in reader mode, and which objects of the entry at() has built in lazy mode
+      LazyBranches      m_lazyBranches;
+      std::vector<bool> m_built;
+
+      // scalar aux variables copied by FillParticle, added by the derived classes
+      AuxColumnTable m_auxColumns;
+
+      // aux variables written out for a whole container by FillAuxColumns
+      AuxColumnExport m_auxExport;
+
+      // mantissa bits kept in the float branches, 23 is full precision
+      int m_mantissaBits = 23;
+      std::vector<std::vector<float>*> m_floatColumns;
+      std::vector<std::vector<std::vector<float> >*> m_nestedFloatColumns;
+
     public:
       T_INFOSWITCH m_infoSwitch;
       bool m_mc;
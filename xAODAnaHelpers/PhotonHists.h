@@ -18,6 +18,10 @@ class PhotonHists : public IParticleHists
 
     virtual StatusCode initialize();
     virtual StatusCode execute( const xAOD::Photon* photon, float eventWeight, const xAOD::EventInfo* eventInfo = 0);
+
+    /** Adds the accessors of the isolation detail */
+    virtual void auxIDs( std::set< SG::auxid_t >& auxids ) const;
+
     using HistogramManager::book; // make other overloaded version of book() to show up in subclass
     using IParticleHists::execute; // overload
 
@@ -3,6 +3,9 @@
 
 // algorithm wrapper
 #include <xAODAnaHelpers/Algorithm.h>
+#include <xAODAnaHelpers/SystematicRegistry.h>
+#include <xAODAnaHelpers/KinematicPreFilter.h>
+#include <xAODAnaHelpers/CutflowCounter.h>
 #include <xAODTracking/VertexContainer.h>
 #include <xAODEgamma/PhotonContainer.h>
 
@@ -32,6 +35,15 @@ public:
   bool       	 m_createSelectedContainer = true;
   /** look at n objects */
   int        	 m_nToProcess = -1;
+  /**
+      @rst
+          Apply the :math:`p_T` and cluster :math:`|\eta|` cuts to the whole container in one vectorized pass and run :cpp:func:`PhotonSelector::passCuts` only on the photons passing them.
+
+          Photons rejected this way only enter the ``all`` bin of the object cutflow, and do not get the isolation decisions :cpp:func:`PhotonSelector::passCuts` adds.
+
+      @endrst
+   */
+  bool       	 m_doKinematicPreFilter = false;
   /** minimum number of objects passing cuts */
   int        	 m_pass_min = -1;
   /** maximum number of objects passing cuts */
@@ -58,6 +70,11 @@ public:
   std::string    m_IsoWPList = "FixedCutTightCaloOnly,FixedCutTight,FixedCutLoose";
 
 private:
+
+  /// @brief input/output container name of each systematic, indexed by xAH::SystematicRegistry ID
+  xAH::SystematicKeys m_inContainerKeys;  //!
+  xAH::SystematicKeys m_outContainerKeys; //!
+
   std::string    m_outAuxContainerName; //!
 
   int m_numEvent;           //!
@@ -72,9 +89,12 @@ private:
   TH1D* m_cutflowHistW = nullptr;     //!
   int   m_cutflow_bin;      //!
 
+  xAH::KinematicPreFilter m_kinematicPreFilter; //!
+
   /* object-level cutflow */
 
   TH1D* m_ph_cutflowHist_1 = nullptr;            //!
+  xAH::CutflowCounter m_ph_cutflowCounter_1; //!
 
   int   m_ph_cutflow_all;              //!
   int   m_ph_cutflow_author_cut;       //!
@@ -0,0 +1,99 @@
+#ifndef xAODAnaHelpers_SystematicRegistry_H
+#define xAODAnaHelpers_SystematicRegistry_H
+
+#include <deque>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+// CP interface includes
+#include "PATInterfaces/SystematicSet.h"
+
+namespace xAH {
+
+  /**
+      @rst
+          Job-wide table giving every systematic variation a small, dense integer ID.
+
+          Algorithms pass systematics to each other as ``std::vector<std::string>`` in the ``xAOD::TStore``. Looking a name up here once per event turns it into an index, so that anything kept per systematic (container keys, histogram sets, ...) can live in a ``std::vector`` instead of being rebuilt or looked up by string. The nominal (empty name) is always ID ``0``.
+
+          IDs are handed out in the order names are first seen and never change for the rest of the job.
+
+      @endrst
+   */
+  class SystematicRegistry
+  {
+
+  public:
+
+    /** @brief The one registry shared by all algorithms of the job */
+    static SystematicRegistry& instance();
+
+    /** @brief ID of the given systematic name, registering it if it is new */
+    unsigned int id( const std::string& systName );
+    /** @overload */
+    unsigned int id( const CP::SystematicSet& syst ) { return id( syst.name() ); }
+
+    /** @brief Name of the systematic with the given ID */
+    const std::string& name( unsigned int id ) const { return m_names.at(id); }
+
+    /** @brief Number of systematics registered so far, all IDs are below this */
+    unsigned int size() const { return m_names.size(); }
+
+  private:
+
+    SystematicRegistry();
+
+    std::unordered_map< std::string, unsigned int > m_ids;
+    // a deque so that registering new names keeps the references handed out by name() valid
+    std::deque< std::string > m_names;
+
+  };
+
+  /**
+      @rst
+          Container (or any other store) keys of the form ``prefix + systName``, built the first time a systematic is seen and looked up by :cpp:class:`xAH::SystematicRegistry` ID afterwards::
+
+              xAH::SystematicKeys inKeys( m_inContainerName );
+              // once per event and systematic
+              unsigned int systID = xAH::SystematicRegistry::instance().id( systName );
+              ANA_CHECK( HelperFunctions::retrieve(inJets, inKeys.key(systID), m_event, m_store, msg()) );
+
+      @endrst
+   */
+  class SystematicKeys
+  {
+
+  public:
+
+    SystematicKeys( const std::string& prefix = "" ) : m_prefix(prefix) {}
+
+    /** @brief Change the prefix, forgetting all keys built so far */
+    void setPrefix( const std::string& prefix ) { m_prefix = prefix; m_keys.clear(); m_built.clear(); }
+    const std::string& prefix() const { return m_prefix; }
+
+    /** @brief ``prefix + name(systID)`` */
+    const std::string& key( unsigned int systID ) {
+      if ( systID >= m_built.size() ) {
+        m_keys.resize( systID+1 );
+        m_built.resize( systID+1, false );
+      }
+      if ( !m_built[systID] ) {
+        m_keys[systID]  = m_prefix + SystematicRegistry::instance().name( systID );
+        m_built[systID] = true;
+      }
+      return m_keys[systID];
+    }
+
+  private:
+
+    std::string m_prefix;
+    // a deque so that growing it keeps the references handed out so far valid
+    std::deque< std::string > m_keys;
+    std::vector< bool > m_built;
+
+  };
+
+}
+
+#endif
@@ -0,0 +1,67 @@
+#ifndef xAODAnaHelpers_TaskPool_H
+#define xAODAnaHelpers_TaskPool_H
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace xAH {
+
+  /**
+      @rst
+          A small pool of persistent threads used to run independent pieces of work of a single event concurrently, such as filling the histograms of every systematic variation.
+
+          :cpp:func:`~xAH::TaskPool::run` hands out task indices one at a time from a shared counter, so a thread that finishes early simply grabs the next index and the load balances itself. The calling thread takes part in the work as well, so a pool of size ``N`` starts ``N-1`` threads.
+
+          Tasks must only touch state that belongs to their own index. Anything that is not thread-safe (``xAOD::TStore``, ``EL::Worker``, CP tools) has to be done before or after calling :cpp:func:`~xAH::TaskPool::run`.
+
+      @endrst
+   */
+  class TaskPool
+  {
+
+  public:
+
+    /** @param nThreads  total number of threads working on a call to run(), including the caller */
+    TaskPool(unsigned int nThreads);
+    ~TaskPool();
+
+    TaskPool(const TaskPool&) = delete;
+    TaskPool& operator=(const TaskPool&) = delete;
+
+    /** @brief Number of threads working on a call to run(), including the caller */
+    unsigned int size() const { return m_workers.size() + 1; }
+
+    /** @brief Call ``task(i)`` for every ``i`` in ``[0, nTasks)`` and return once all of them are done */
+    void run(std::size_t nTasks, const std::function<void(std::size_t)>& task);
+
+  private:
+
+    void workerLoop();
+    void drain(const std::function<void(std::size_t)>& task, std::size_t nTasks);
+
+    std::vector<std::thread> m_workers;
+
+    std::mutex              m_mutex;
+    std::condition_variable m_wake;
+    std::condition_variable m_done;
+
+    // the batch currently being worked on, guarded by m_mutex
+    const std::function<void(std::size_t)>* m_task = nullptr;
+    std::size_t   m_nTasks     = 0;
+    unsigned long m_generation = 0;
+    unsigned int  m_pending    = 0;
+    bool          m_stop       = false;
+
+    // next task index to hand out
+    std::atomic<std::size_t> m_next{0};
+
+  };
+
+}
+
+#endif
@@ -14,6 +14,8 @@
 
 // algorithm wrapper
 #include "xAODAnaHelpers/Algorithm.h"
+#include "xAODAnaHelpers/SystematicRegistry.h"
+#include "xAODAnaHelpers/CutflowCounter.h"
 
 class TauSelector : public xAH::Algorithm
 {
@@ -57,6 +59,10 @@ public:
 
 private:
 
+  /// @brief input/output container name of each systematic, indexed by xAH::SystematicRegistry ID
+  xAH::SystematicKeys m_inContainerKeys;  //!
+  xAH::SystematicKeys m_outContainerKeys; //!
+
   int m_numEvent;           //!
   int m_numObject;          //!
   int m_numEventPass;       //!
@@ -72,7 +78,9 @@ private:
 
   // object cutflow
   TH1D* m_tau_cutflowHist_1;                //!
+  xAH::CutflowCounter m_tau_cutflowCounter_1; //!
   TH1D* m_tau_cutflowHist_2;                //!
+  xAH::CutflowCounter m_tau_cutflowCounter_2; //!
 
   int   m_tau_cutflow_all;		    //!
   int   m_tau_cutflow_selected;             //!
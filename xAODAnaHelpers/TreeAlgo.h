@@ -2,11 +2,14 @@
 #define xAODAnaHelpers_TreeAlgo_H
 
 #include "TTree.h"
+#include "TStopwatch.h"
 
 #include <xAODAnaHelpers/HelpTreeBase.h>
+#include <xAODAnaHelpers/TreeOutputPolicy.h>
 
 // algorithm wrapper
 #include "xAODAnaHelpers/Algorithm.h"
+#include "xAODAnaHelpers/SystematicRegistry.h"
 
 class TreeAlgo : public xAH::Algorithm
 {
@@ -60,6 +63,37 @@ public:
   /// @brief unit conversion from MeV, default is GeV
   float m_units = 1e3;
 
+  /**
+    @rst
+      Fill the output trees on a background I/O thread, so that basket compression and writing no longer hold up the event loop. While one systematic tree is being written out, the next one is already being filled.
+
+      The writer is shared by all the ``TreeAlgo`` instances of the job, since they write to the same file. Either all of them or none of them must turn this on, ``initialize`` fails otherwise.
+    @endrst
+   */
+  bool m_asyncWrite = false;
+  /// @brief maximum number of tree fills waiting for the I/O thread before the event loop is held back (the first ``TreeAlgo`` with ``m_asyncWrite`` sets it)
+  int m_asyncWriteQueueSize = 64;
+
+  /**
+    @rst
+      Write to each systematic tree only the collections that the systematic varies, together with ``runNumber``, ``eventNumber`` and whether the event is in the ``nominal`` tree (``inNominal``). Event, trigger and all unvaried collections are written once, to ``nominal``, and left empty in the systematic tree.
+
+      Events that ``nominal`` rejected have ``inNominal == false`` and are written in full to the systematic tree, as without this option. The branches read from ``nominal`` otherwise are listed in the ``nominalBranches`` object of the tree's ``GetUserInfo()``.
+
+      ``xAH.trees.systematic_tree`` reads the systematic tree as if it had been written in full, taking the rest of an ``inNominal`` entry from the ``nominal`` entry with the same ``runNumber`` and ``eventNumber``. The link does not depend on entry numbers, so it holds after ``hadd`` or in a ``TChain``, as long as both trees come from the same files.
+    @endrst
+   */
+  bool m_deltaSystTrees = false;
+
+  /**
+    @rst
+      Compression algorithm and level, basket size and auto-flush interval of the output trees, by tree and branch name, e.g. ``"*:algo=LZMA,level=8 nominal/:algo=LZ4,level=4"``. See :cpp:class:`xAH::TreeOutputPolicy` for the format. Branches no rule applies to keep the ROOT defaults.
+
+      When set, the size of every tree before and after compression and the time the event loop spent filling it are printed at the end of the job.
+    @endrst
+   */
+  std::string m_branchPolicy = "";
+
 protected:
   std::vector<std::string> m_jetDetails; //!
 
@@ -69,8 +103,26 @@ protected:
   std::vector<std::string> m_jetBranches; //!
   std::vector<std::string> m_truthJetBranches; //!
 
+  // store keys of the collections with systematics, indexed by xAH::SystematicRegistry ID; jets are the first of m_jetContainers
+  xAH::SystematicKeys m_muContainerKeys;     //!
+  xAH::SystematicKeys m_elContainerKeys;     //!
+  xAH::SystematicKeys m_jetContainerKeys;    //!
+  xAH::SystematicKeys m_photonContainerKeys; //!
+  xAH::SystematicKeys m_METContainerKeys;    //!
+  // one per container of m_fatJetContainerName, the prefix is the container name
+  std::vector<xAH::SystematicKeys> m_fatJetContainerKeys; //!
+
   std::map<std::string, HelpTreeBase*> m_trees;            //!
 
+  std::shared_ptr<xAH::AsyncTreeWriter> m_treeWriter;      //!
+
+  xAH::TreeOutputPolicy m_outputPolicy;                    //!
+  // time spent in filling each tree, for the summary of m_branchPolicy
+  std::map<std::string, TStopwatch> m_fillWatch;           //!
+
+  // reset the branches of all the collections in helpTree, for a delta systematic tree entry that links to nominal
+  void clearTree(HelpTreeBase* helpTree);
+
 public:
 
   // this is a standard constructor
@@ -0,0 +1,63 @@
+#ifndef xAODAnaHelpers_TreeOutputPolicy_H
+#define xAODAnaHelpers_TreeOutputPolicy_H
+
+#include <string>
+#include <vector>
+
+#include <TTree.h>
+
+namespace xAH {
+
+  /**
+      @rst
+          Compression and buffering settings for the branches of the output trees, chosen by tree and branch name.
+
+          The policy is a space-separated list of rules ``[tree/]branch:key=value[,key=value...]``, where ``tree`` and ``branch`` are shell wildcard patterns. A rule without ``tree/`` applies to every tree, one with an empty ``branch`` to every branch of the tree. The keys are
+
+          ===========  ==================================================================
+          ``algo``     compression algorithm: ``ZLIB``, ``LZMA``, ``LZ4`` or ``ZSTD``
+          ``level``    compression level, 0 (no compression) to 9
+          ``basket``   basket size in bytes
+          ``flush``    auto-flush interval of the tree, in entries (or in bytes if negative), see ``TTree::SetAutoFlush``; only the tree pattern matters
+          ===========  ==================================================================
+
+          Rules are applied in order and a later rule only overrides the keys it sets, so general rules go first::
+
+              *:algo=LZMA,level=8  nominal/:algo=LZ4,level=4,flush=1000  nominal/jet_*:basket=256000
+
+          Anything no rule sets keeps the ROOT default. ``ZSTD`` needs ROOT 6.20 or newer.
+
+      @endrst
+   */
+  class TreeOutputPolicy
+  {
+
+  public:
+
+    /** @brief Parse ``rules``, replacing the current ones. Returns false and describes the problem in ``error`` if they cannot be parsed. */
+    bool parse(const std::string& rules, std::string& error);
+
+    bool empty() const { return m_rules.empty(); }
+
+    /** @brief Apply the settings to ``tree`` and the branches it already has. Must be called before the first fill. */
+    void apply(TTree* tree) const;
+
+  private:
+
+    struct Rule {
+      std::string treePattern;
+      std::string branchPattern;
+      int algorithm  = -1;
+      int level      = -1;
+      int basketSize = -1;
+      Long64_t autoFlush = 0;
+      bool setAutoFlush  = false;
+    };
+
+    std::vector<Rule> m_rules;
+
+  };
+
+}
+
+#endif
@@ -9,6 +9,7 @@
 
 // algorithm wrapper
 #include <xAODAnaHelpers/Algorithm.h>
+#include <xAODAnaHelpers/SystematicRegistry.h>
 
 #include <AsgTools/AnaToolHandle.h>
 #include <TriggerMatchingTool/MatchingTool.h>
@@ -73,6 +74,9 @@ public:
 
 private:
 
+  /// @brief input container name of each systematic, indexed by xAH::SystematicRegistry ID
+  xAH::SystematicKeys m_inContainerKeys;  //!
+
   /* tools */
   Trig::MatchingTool* m_trigMatchTool = nullptr; //!
 
@@ -92,6 +96,7 @@ public:
   virtual EL::StatusCode initialize ();
   virtual EL::StatusCode execute ();
   virtual EL::StatusCode finalize ();
+  virtual EL::StatusCode histFinalize ();
 
   /* these are the functions not inherited from Algorithm */
   EL::StatusCode executeMatching( const xAOD::IParticleContainer* inParticles );
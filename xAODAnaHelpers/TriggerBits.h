@@ -0,0 +1,96 @@
+#ifndef xAODAnaHelpers_TriggerBits_H
+#define xAODAnaHelpers_TriggerBits_H
+
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include <TTree.h>
+
+namespace xAH {
+
+  /**
+      @rst
+          Compact encoding of the trigger decisions, written instead of the ``passedTriggers`` and ``triggerPrescales`` string and float vectors.
+
+          Per event the ``passedTriggerBits`` branch, a bitset with bit ``i`` set if chain ``i`` passed, the ``triggerL1PSKey`` and ``triggerHLTPSKey`` prescale keys and ``triggerMenuHash`` are written. The chain names and the prescales of each key pair are stored once, when the job ends, in the ``triggerMenu`` histogram of the user info of the tree: x bins are the chains, y bins the prescale key pairs, and the content the prescale (0 if the chain never passed with those keys).
+
+          The chains are indexed from the list of all configured chains (``isPassedBitsNames``, written by :cpp:class:`BasicEventSelection` with ``m_storeTrigDecisions``), sorted by name, so that jobs with the same trigger selection and menu give the same indices. Chains that only appear later in the job, after a menu change, are added after the others, again sorted by name.
+
+          ``hadd`` keeps the ``triggerMenu`` of the first file only. ``triggerMenuHash`` is a hash of the chain list the event was written with, and reading an event whose chains are not indexed as in the stored menu, or whose prescale keys are not in it, throws ``std::runtime_error``: files written with different menus must be read separately.
+
+          To read the decisions back, connect the tree with :cpp:func:`~xAH::TriggerBits::setTree` and ask :cpp:func:`~xAH::TriggerBits::passed` after each ``GetEntry``::
+
+              xAH::TriggerBits trigger;
+              trigger.setTree(tree);
+              for(Long64_t i = 0; i < tree->GetEntries(); ++i) {
+                tree->GetEntry(i);
+                if(trigger.passed("HLT_j380")) ...
+              }
+
+      @endrst
+   */
+  class TriggerBits
+  {
+
+  public:
+
+    TriggerBits() = default;
+
+    TriggerBits(const TriggerBits&) = delete;
+    TriggerBits& operator=(const TriggerBits&) = delete;
+
+    /** @brief Book the per-event branches */
+    void setBranches(TTree* tree);
+    void clear();
+    /**
+        @brief Encode the decisions of one event
+        @param chains     all configured chains, to fix the index order; may be empty, in which case chains are indexed as they pass
+        @param passed     the chains that passed
+        @param prescales  the prescales of the chains in ``passed``, in the same order; may be empty
+     */
+    void fill(const std::vector<std::string>& chains, const std::vector<std::string>& passed, const std::vector<float>& prescales, int l1PSKey, int hltPSKey);
+    /** @brief Store the chain names and prescales in the user info of ``tree``, replacing what is there. Call once all events are filled. */
+    void writeMenu(TTree* tree) const;
+
+    /** @brief Connect the branches of ``tree`` and load the menu it was written with. Returns false if the tree has no encoded decisions. */
+    bool setTree(TTree* tree);
+    /** @brief Whether ``chain`` passed in the current entry */
+    bool passed(const std::string& chain) const;
+    /** @brief Prescale of ``chain`` for the keys of the current entry, 0 if the chain is unknown or never passed with these keys */
+    float prescale(const std::string& chain) const;
+    /** @brief All known chains, in index order */
+    const std::vector<std::string>& chains() const { return m_chains; }
+
+  private:
+
+    void addChain(const std::string& chain);
+    int findChain(const std::string& chain) const;
+    int findSet() const;
+    void checkMenu() const;
+
+    std::vector<std::string> m_chains;
+    std::unordered_map<std::string, unsigned int> m_index;
+    // m_hashes[i] is the hash of the first i+1 chains
+    std::vector<UInt_t> m_hashes;
+
+    // (L1, HLT) prescale keys of each set, and the prescale of each chain in it
+    std::vector<std::pair<int, int> > m_setKeys;
+    std::vector<std::vector<float> > m_prescales;
+
+    // last menu hash found in m_hashes when reading
+    mutable UInt_t m_checkedHash = 2166136261u;
+
+    // branches
+    std::vector<ULong64_t>  m_bits;
+    std::vector<ULong64_t>* m_bitsPtr = &m_bits;
+    int m_l1PSKey = -999;
+    int m_hltPSKey = -999;
+    UInt_t m_menuHash = 2166136261u; // hash of no chains
+
+  };
+
+}
+
+#endif
@@ -10,6 +10,7 @@
 
 // algorithm wrapper
 #include "xAODAnaHelpers/Algorithm.h"
+#include "xAODAnaHelpers/CutflowCounter.h"
 
 // external tools include(s):
 #include "xAODBTaggingEfficiency/BTaggingSelectionTool.h"
@@ -70,6 +71,7 @@ private:
   /* object-level cutflow */
 
   TH1D* m_truth_cutflowHist_1 = nullptr;  //!
+  xAH::CutflowCounter m_truth_cutflowCounter_1; //!
 
   int   m_truth_cutflow_all;           //!
   int   m_truth_cutflow_ptmax_cut;     //!
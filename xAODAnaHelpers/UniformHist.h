@@ -0,0 +1,92 @@
+#ifndef xAODAnaHelpers_UniformHist_H
+#define xAODAnaHelpers_UniformHist_H
+
+#include <vector>
+
+#include <TH1.h>
+
+namespace xAH {
+
+  /**
+      @rst
+          Counts of a 1D or 2D histogram with fixed-width bins, filled without going through ``TAxis::FindBin`` and the virtual ``TH1::Fill``.
+
+          The bin is computed from the axis range with the same expression ``TAxis::FindBin`` uses, contents and squared weights are kept in contiguous ``double`` arrays, and the statistics (sum of weights, of ``w*x``, ...) are accumulated like ``TH1::Fill`` does, so that :cpp:func:`~xAH::UniformHist::flush` leaves the ``TH1`` it was made for as if it had been filled directly (up to the ``float`` rounding of a ``TH1F``, which is applied once per bin here).
+
+          Only histograms that :cpp:func:`~xAH::UniformHist::supports` can be counted this way. :cpp:class:`HistogramManager` uses it for :cpp:func:`HistogramManager::fill` with :cpp:func:`HistogramManager::setFastFill`.
+
+      @endrst
+   */
+  class UniformHist
+  {
+
+  public:
+
+    /** @brief Whether ``hist`` is a plain 1D or 2D histogram with fixed-width bins and ``Sumw2`` */
+    static bool supports(const TH1* hist);
+
+    explicit UniformHist(TH1* hist);
+
+    void fill(double x, double w)
+    {
+      const int bin = findBin(x, m_nx, m_xlow, m_xhigh);
+      m_sumw[bin]  += w;
+      m_sumw2[bin] += w*w;
+      m_entries    += 1;
+      if(!m_statOverflows && (bin == 0 || bin > m_nx)) return;
+      m_stats[0] += w;
+      m_stats[1] += w*w;
+      m_stats[2] += w*x;
+      m_stats[3] += w*x*x;
+    }
+
+    void fill(double x, double y, double w)
+    {
+      const int binx = findBin(x, m_nx, m_xlow, m_xhigh);
+      const int biny = findBin(y, m_ny, m_ylow, m_yhigh);
+      const int bin  = binx + (m_nx+2)*biny;
+      m_sumw[bin]  += w;
+      m_sumw2[bin] += w*w;
+      m_entries    += 1;
+      if(!m_statOverflows && (binx == 0 || binx > m_nx || biny == 0 || biny > m_ny)) return;
+      m_stats[0] += w;
+      m_stats[1] += w*w;
+      m_stats[2] += w*x;
+      m_stats[3] += w*x*x;
+      m_stats[4] += w*y;
+      m_stats[5] += w*y*y;
+      m_stats[6] += w*x*y;
+    }
+
+    /** @brief Add the counts to the histogram and start over */
+    void flush();
+
+    /** @brief bytes held by the counts */
+    std::size_t bytes() const { return (m_sumw.capacity() + m_sumw2.capacity()) * sizeof(double); }
+
+  private:
+
+    // same as TAxis::FindBin for fixed bins, NaN ends up in the overflow
+    static int findBin(double x, int n, double low, double high)
+    {
+      if(x < low) return 0;
+      if(!(x < high)) return n+1;
+      return 1 + int(n*(x-low)/(high-low));
+    }
+
+    TH1* m_hist;
+    int    m_nx, m_ny;
+    double m_xlow, m_xhigh, m_ylow, m_yhigh;
+    bool   m_statOverflows;
+
+    std::vector<double> m_sumw;
+    std::vector<double> m_sumw2;
+    // sum of w, w^2, w*x, w*x^2, w*y, w*y^2, w*x*y, as TH1::GetStats
+    double m_stats[7] = {0.};
+    double m_entries  = 0.;
+
+  };
+
+}
+
+#endif